@@ -1,8 +1,7 @@
 // Header files
-#include <iomanip>
+#include <algorithm>
 #include <jni.h>
 #include <memory>
-#include <sstream>
 #include "secp256k1-zkp-react.h"
 
 using namespace std;
@@ -16,6 +15,9 @@ static const size_t HEX_CHARACTER_LENGTH = (sizeof("FF") - sizeof('\0'));
 // Bits in a byte
 static const int BITS_IN_A_BYTE = 8;
 
+// Hex characters
+static const char HEX_CHARACTERS[] = "0123456789abcdef";
+
 
 // Function prototypes
 
@@ -115,14 +117,137 @@ extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReac
 // Native verify message hash signature
 extern "C" JNIEXPORT jboolean JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeVerifyMessageHashSignature(JNIEnv *environment, jclass type, jstring contextSeed, jstring signature, jstring messageHash, jstring publicKey);
 
+// Native create bulletproof session
+extern "C" JNIEXPORT jlong JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateBulletproofSession(JNIEnv *environment, jclass type, jstring contextSeed, jstring blind, jstring value, jstring commit, jstring nonce, jstring privateNonce, jstring extraCommit, jstring message);
+
+// Native bulletproof session round one
+extern "C" JNIEXPORT jobjectArray JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBulletproofSessionRoundOne(JNIEnv *environment, jclass type, jstring contextSeed, jlong session);
+
+// Native bulletproof session round two
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBulletproofSessionRoundTwo(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring tOne, jstring tTwo);
+
+// Native bulletproof session finalize
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBulletproofSessionFinalize(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring tauX);
+
+// Native destroy bulletproof session
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDestroyBulletproofSession(JNIEnv *environment, jclass type, jlong session);
+
+// Native create aggsig session
+extern "C" JNIEXPORT jlong JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateAggsigSession(JNIEnv *environment, jclass type, jstring contextSeed, jstring message, jstring publicKeyTotal, jstring publicNonceTotal);
+
+// Native aggsig session partial sign
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggsigSessionPartialSign(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring secretKey, jstring secretNonce);
+
+// Native aggsig session partial verify
+extern "C" JNIEXPORT jboolean JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggsigSessionPartialVerify(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring signature, jstring publicKey);
+
+// Native aggsig session aggregate
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggsigSessionAggregate(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jobjectArray signatures);
+
+// Native aggsig session verify
+extern "C" JNIEXPORT jboolean JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggsigSessionVerify(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring signature);
+
+// Native destroy aggsig session
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDestroyAggsigSession(JNIEnv *environment, jclass type, jlong session);
+
+// Native create nonce pair
+extern "C" JNIEXPORT jobjectArray JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateNoncePair(JNIEnv *environment, jclass type, jstring contextSeed);
+
+// Native derive child secret keys
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDeriveChildSecretKeys(JNIEnv *environment, jclass type, jstring contextSeed, jstring secretKey, jstring chainCode, jlong startIndex, jlong numberOfIndices, jboolean isHardened);
+
+// Native derive child public keys
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDeriveChildPublicKeys(JNIEnv *environment, jclass type, jstring contextSeed, jstring publicKey, jstring chainCode, jlong startIndex, jlong numberOfIndices);
+
+// Native public keys from secret keys
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePublicKeysFromSecretKeys(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray secretKeys);
+
+// Native Pedersen commits
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommits(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray blinds, jobjectArray values);
+
+// Native blind switches
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBlindSwitches(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray blinds, jobjectArray values);
+
+// Native shared secret keys from secret key and public keys
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSharedSecretKeysFromSecretKeyAndPublicKeys(JNIEnv *environment, jclass type, jstring contextSeed, jstring secretKey, jobjectArray publicKeys);
+
+// Native create commit accumulator
+extern "C" JNIEXPORT jlong JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateCommitAccumulator(JNIEnv *environment, jclass type, jstring contextSeed);
+
+// Native commit accumulator add
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorAdd(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator, jobjectArray commits);
+
+// Native commit accumulator subtract
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorSubtract(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator, jobjectArray commits);
+
+// Native commit accumulator checkpoint
+extern "C" JNIEXPORT jlong JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorCheckpoint(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator);
+
+// Native commit accumulator restore
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorRestore(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator, jlong checkpoint);
+
+// Native commit accumulator total
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorTotal(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator);
+
+// Native destroy commit accumulator
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDestroyCommitAccumulator(JNIEnv *environment, jclass type, jlong accumulator);
+
+// Native multi scalar multiply
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeMultiScalarMultiply(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray points, jobjectArray scalars);
+
+// Native scalar batch inverse
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeScalarBatchInverse(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray scalars);
+
+// Native evaluate scalar program
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeEvaluateScalarProgram(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray scalars, jstring program);
+
+// Native execute commands
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeExecuteCommands(JNIEnv *environment, jclass type, jstring contextSeed, jstring commands);
+
+// Native set verification cache capacity
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSetVerificationCacheCapacity(JNIEnv *environment, jclass type, jlong capacity);
+
+// Native get verification cache statistics
+extern "C" JNIEXPORT jlongArray JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeGetVerificationCacheStatistics(JNIEnv *environment, jclass type);
+
+// Native set thread count
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSetThreadCount(JNIEnv *environment, jclass type, jlong count);
+
+// Native open rewind cache
+extern "C" JNIEXPORT jlong JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeOpenRewindCache(JNIEnv *environment, jclass type, jstring contextSeed, jstring path, jstring key);
+
+// Native rewind bulletproof with cache
+extern "C" JNIEXPORT jobjectArray JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeRewindBulletproofWithCache(JNIEnv *environment, jclass type, jstring contextSeed, jlong cache, jstring proof, jstring commit, jstring nonce);
+
+// Native close rewind cache
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCloseRewindCache(JNIEnv *environment, jclass type, jlong cache);
+
+// Native scan outputs
+extern "C" JNIEXPORT jlongArray JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeScanOutputs(JNIEnv *environment, jclass type, jstring contextSeed, jstring inputPath, jlong startOffset, jstring outputPath, jstring nonce);
+
+// Native aggregate transactions
+extern "C" JNIEXPORT jobjectArray JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggregateTransactions(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray inputs, jobjectArray outputs, jobjectArray kernelExcesses, jobjectArray offsets, jobjectArray fees);
+
+// Native validate block
+extern "C" JNIEXPORT jlongArray JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeValidateBlock(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray inputs, jobjectArray outputs, jobjectArray proofs, jobjectArray kernelExcesses, jobjectArray signatures, jobjectArray messages, jstring offset, jstring reward);
+
+// Native get stats
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeGetStats(JNIEnv *environment, jclass type);
+
+// Native reset stats
+extern "C" JNIEXPORT void JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeResetStats(JNIEnv *environment, jclass type);
+
+// Native SHA-256 hashes
+extern "C" JNIEXPORT jstring JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSha256Hashes(JNIEnv *environment, jclass type, jobjectArray messages);
+
 // Native seed size
 extern "C" JNIEXPORT jint JNICALL Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSeedSize(JNIEnv *environment, jclass type);
 
 // From hex string
-static vector<uint8_t> fromHexString(JNIEnv *environment, jstring hexString);
+static SecureBytes fromHexString(JNIEnv *environment, jstring hexString);
 
 // To hex string
-static jstring toHexString(JNIEnv *environment, const vector<uint8_t> &input);
+template<typename Allocator> static jstring toHexString(JNIEnv *environment, const vector<uint8_t, Allocator> &input);
 
 // Character to number
 static uint8_t characterToNumber(char character);
@@ -143,10 +268,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBlindSwitch(JNI
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from blind
-		const vector<uint8_t> blindData = fromHexString(environment, blind);
+		const SecureBytes blindData = fromHexString(environment, blind);
 		
 		// Initialize release value data
 		auto releaseValueData = [environment, value](const char *valueData) {
@@ -189,14 +314,14 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBlindSum(JNIEnv
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get number of positive blinds
 		const jsize numberOfPositiveBlinds = environment->GetArrayLength(positiveBlinds);
 		
 		// Initialize positive blinds data and positive blinds sizes
-		vector<uint8_t> positiveBlindsData;
-		size_t positiveBlindsSizes[numberOfPositiveBlinds];
+		SecureBytes positiveBlindsData;
+		vector<size_t> positiveBlindsSizes(numberOfPositiveBlinds);
 		
 		// Go through all positive blinds
 		for(jsize i = 0; i < numberOfPositiveBlinds; ++i) {
@@ -210,7 +335,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBlindSum(JNIEnv
 			}
 			
 			// Get data from blind
-			const vector<uint8_t> blindData = fromHexString(environment, blind);
+			const SecureBytes blindData = fromHexString(environment, blind);
+			
+			// Delete blind local reference
+			environment->DeleteLocalRef(blind);
 			
 			// Append blind data to positive blinds data
 			positiveBlindsData.insert(positiveBlindsData.cend(), blindData.cbegin(), blindData.cend());
@@ -223,8 +351,8 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBlindSum(JNIEnv
 		const jsize numberOfNegativeBlinds = environment->GetArrayLength(negativeBlinds);
 		
 		// Initialize negative blinds data and negative blinds sizes
-		vector<uint8_t> negativeBlindsData;
-		size_t negativeBlindsSizes[numberOfNegativeBlinds];
+		SecureBytes negativeBlindsData;
+		vector<size_t> negativeBlindsSizes(numberOfNegativeBlinds);
 		
 		// Go through all negative blinds
 		for(jsize i = 0; i < numberOfNegativeBlinds; ++i) {
@@ -238,7 +366,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBlindSum(JNIEnv
 			}
 			
 			// Get data from blind
-			const vector<uint8_t> blindData = fromHexString(environment, blind);
+			const SecureBytes blindData = fromHexString(environment, blind);
+			
+			// Delete blind local reference
+			environment->DeleteLocalRef(blind);
 			
 			// Append blind data to negative blinds data
 			negativeBlindsData.insert(negativeBlindsData.cend(), blindData.cbegin(), blindData.cend());
@@ -248,7 +379,7 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBlindSum(JNIEnv
 		}
 		
 		// Return performing blind sum
-		return toHexString(environment, blindSum(contextSeedData.data(), contextSeedData.size(), positiveBlindsData.data(), positiveBlindsSizes, numberOfPositiveBlinds, negativeBlindsData.data(), negativeBlindsSizes, numberOfNegativeBlinds));
+		return toHexString(environment, blindSum(contextSeedData.data(), contextSeedData.size(), positiveBlindsData.data(), positiveBlindsSizes.data(), numberOfPositiveBlinds, negativeBlindsData.data(), negativeBlindsSizes.data(), numberOfNegativeBlinds));
 	}
 	
 	// Catch errors
@@ -273,10 +404,10 @@ jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeIsValidSecretK
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(environment, secretKey);
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
 
 		// Return if secret key is a valid secret key
 		return toBool(isValidSecretKey(contextSeedData.data(), contextSeedData.size(), secretKeyData.data(), secretKeyData.size()));
@@ -304,10 +435,10 @@ jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeIsValidPublicK
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 
 		// Return if public key is a valid public key
 		return toBool(isValidPublicKey(contextSeedData.data(), contextSeedData.size(), publicKeyData.data(), publicKeyData.size()));
@@ -335,10 +466,10 @@ jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeIsValidCommit(
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(environment, commit);
+		const SecureBytes commitData = fromHexString(environment, commit);
 
 		// Return if commit is a valid commit
 		return toBool(isValidCommit(contextSeedData.data(), contextSeedData.size(), commitData.data(), commitData.size()));
@@ -366,10 +497,10 @@ jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeIsValidSingleS
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(environment, signature);
+		const SecureBytes signatureData = fromHexString(environment, signature);
 
 		// Return if signature is a valid single-signer signature
 		return toBool(isValidSingleSignerSignature(contextSeedData.data(), contextSeedData.size(), signatureData.data(), signatureData.size()));
@@ -397,10 +528,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateBulletpro
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from blind
-		const vector<uint8_t> blindData = fromHexString(environment, blind);
+		const SecureBytes blindData = fromHexString(environment, blind);
 		
 		// Initialize release value data
 		auto releaseValueData = [environment, value](const char *valueData) {
@@ -418,16 +549,16 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateBulletpro
 		}
 		
 		// Get data from nonce
-		const vector<uint8_t> nonceData = fromHexString(environment, nonce);
+		const SecureBytes nonceData = fromHexString(environment, nonce);
 		
 		// Get data from private nonce
-		const vector<uint8_t> privateNonceData = fromHexString(environment, privateNonce);
+		const SecureBytes privateNonceData = fromHexString(environment, privateNonce);
 		
 		// Get data from extra commit
-		const vector<uint8_t> extraCommitData = fromHexString(environment, extraCommit);
+		const SecureBytes extraCommitData = fromHexString(environment, extraCommit);
 		
 		// Get data from message
-		const vector<uint8_t> messageData = fromHexString(environment, message);
+		const SecureBytes messageData = fromHexString(environment, message);
 		
 		// Return creating bulletproof
 		return toHexString(environment, createBulletproof(contextSeedData.data(), contextSeedData.size(), blindData.data(), blindData.size(), valueData.get(), nonceData.data(), nonceData.size(), privateNonceData.data(), privateNonceData.size(), extraCommitData.data(), extraCommitData.size(), messageData.data(), messageData.size()));
@@ -455,19 +586,19 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateBulletpro
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from tau X
-		vector<uint8_t> tauXData = fromHexString(environment, tauX);
+		SecureBytes tauXData = fromHexString(environment, tauX);
 		
 		// Get data from t one
-		const vector<uint8_t> tOneData = fromHexString(environment, tOne);
+		const SecureBytes tOneData = fromHexString(environment, tOne);
 		
 		// Get data from t two
-		const vector<uint8_t> tTwoData = fromHexString(environment, tTwo);
+		const SecureBytes tTwoData = fromHexString(environment, tTwo);
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(environment, commit);
+		const SecureBytes commitData = fromHexString(environment, commit);
 		
 		// Initialize release value data
 		auto releaseValueData = [environment, value](const char *valueData) {
@@ -485,13 +616,13 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateBulletpro
 		}
 		
 		// Get data from nonce
-		const vector<uint8_t> nonceData = fromHexString(environment, nonce);
+		const SecureBytes nonceData = fromHexString(environment, nonce);
 		
 		// Get data from extra commit
-		const vector<uint8_t> extraCommitData = fromHexString(environment, extraCommit);
+		const SecureBytes extraCommitData = fromHexString(environment, extraCommit);
 		
 		// Get data from message
-		const vector<uint8_t> messageData = fromHexString(environment, message);
+		const SecureBytes messageData = fromHexString(environment, message);
 		
 		// Return creating bulletproof blindless
 		return toHexString(environment, createBulletproofBlindless(contextSeedData.data(), contextSeedData.size(), tauXData.data(), tauXData.size(), tOneData.data(), tOneData.size(), tTwoData.data(), tTwoData.size(), commitData.data(), commitData.size(), valueData.get(), nonceData.data(), nonceData.size(), extraCommitData.data(), extraCommitData.size(), messageData.data(), messageData.size()));
@@ -519,19 +650,19 @@ jobjectArray Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeRewindBull
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from proof
-		const vector<uint8_t> proofData = fromHexString(environment, proof);
+		const SecureBytes proofData = fromHexString(environment, proof);
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(environment, commit);
+		const SecureBytes commitData = fromHexString(environment, commit);
 		
 		// Get data from nonce
-		const vector<uint8_t> nonceData = fromHexString(environment, nonce);
+		const SecureBytes nonceData = fromHexString(environment, nonce);
 
 		// Performing rewind bulletproof
-		const tuple<string, vector<uint8_t>, vector<uint8_t>> bulletproofData = rewindBulletproof(contextSeedData.data(), contextSeedData.size(), proofData.data(), proofData.size(), commitData.data(), commitData.size(), nonceData.data(), nonceData.size());
+		const tuple<string, SecureBytes, vector<uint8_t>> bulletproofData = rewindBulletproof(contextSeedData.data(), contextSeedData.size(), proofData.data(), proofData.size(), commitData.data(), commitData.size(), nonceData.data(), nonceData.size());
 		
 		// Check if getting value as a string failed
 		const jstring valueString = environment->NewStringUTF(get<0>(bulletproofData).c_str());
@@ -580,16 +711,16 @@ jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeVerifyBulletpr
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from proof
-		const vector<uint8_t> proofData = fromHexString(environment, proof);
+		const SecureBytes proofData = fromHexString(environment, proof);
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(environment, commit);
+		const SecureBytes commitData = fromHexString(environment, commit);
 		
 		// Get data from extra commit
-		const vector<uint8_t> extraCommitData = fromHexString(environment, extraCommit);
+		const SecureBytes extraCommitData = fromHexString(environment, extraCommit);
 
 		// Return if bulletproof is verified
 		return toBool(verifyBulletproof(contextSeedData.data(), contextSeedData.size(), proofData.data(), proofData.size(), commitData.data(), commitData.size(), extraCommitData.data(), extraCommitData.size()));
@@ -617,10 +748,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePublicKeyFromSe
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(environment, secretKey);
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
 
 		// Return getting public key from secret key
 		return toHexString(environment, publicKeyFromSecretKey(contextSeedData.data(), contextSeedData.size(), secretKeyData.data(), secretKeyData.size()));
@@ -649,10 +780,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePublicKeyFromDa
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from data
-		const vector<uint8_t> dataData = fromHexString(environment, data);
+		const SecureBytes dataData = fromHexString(environment, data);
 
 		// Return getting public key from data
 		return toHexString(environment, publicKeyFromData(contextSeedData.data(), contextSeedData.size(), dataData.data(), dataData.size()));
@@ -680,10 +811,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeUncompressPubli
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 
 		// Return uncompressing the public key
 		return toHexString(environment, uncompressPublicKey(contextSeedData.data(), contextSeedData.size(), publicKeyData.data(), publicKeyData.size()));
@@ -711,13 +842,13 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSecretKeyTweakA
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(environment, secretKey);
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
 		
 		// Get data from tweak
-		const vector<uint8_t> tweakData = fromHexString(environment, tweak);
+		const SecureBytes tweakData = fromHexString(environment, tweak);
 
 		// Return performing secret key tweak add
 		return toHexString(environment, secretKeyTweakAdd(contextSeedData.data(), contextSeedData.size(), secretKeyData.data(), secretKeyData.size(), tweakData.data(), tweakData.size()));
@@ -745,13 +876,13 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePublicKeyTweakA
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 		
 		// Get data from tweak
-		const vector<uint8_t> tweakData = fromHexString(environment, tweak);
+		const SecureBytes tweakData = fromHexString(environment, tweak);
 
 		// Return performing public key tweak add
 		return toHexString(environment, publicKeyTweakAdd(contextSeedData.data(), contextSeedData.size(), publicKeyData.data(), publicKeyData.size(), tweakData.data(), tweakData.size()));
@@ -779,13 +910,13 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSecretKeyTweakM
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(environment, secretKey);
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
 		
 		// Get data from tweak
-		const vector<uint8_t> tweakData = fromHexString(environment, tweak);
+		const SecureBytes tweakData = fromHexString(environment, tweak);
 
 		// Return performing secret key tweak multiply
 		return toHexString(environment, secretKeyTweakMultiply(contextSeedData.data(), contextSeedData.size(), secretKeyData.data(), secretKeyData.size(), tweakData.data(), tweakData.size()));
@@ -813,13 +944,13 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePublicKeyTweakM
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 		
 		// Get data from tweak
-		const vector<uint8_t> tweakData = fromHexString(environment, tweak);
+		const SecureBytes tweakData = fromHexString(environment, tweak);
 
 		// Return performing public key tweak multiply
 		return toHexString(environment, publicKeyTweakMultiply(contextSeedData.data(), contextSeedData.size(), publicKeyData.data(), publicKeyData.size(), tweakData.data(), tweakData.size()));
@@ -847,13 +978,13 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSharedSecretKey
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(environment, secretKey);
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 		
 		// Return getting shared secret key from secret key and public key
 		return toHexString(environment, sharedSecretKeyFromSecretKeyAndPublicKey(contextSeedData.data(), contextSeedData.size(), secretKeyData.data(), secretKeyData.size(), publicKeyData.data(), publicKeyData.size()));
@@ -881,10 +1012,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommit(
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from blind
-		const vector<uint8_t> blindData = fromHexString(environment, blind);
+		const SecureBytes blindData = fromHexString(environment, blind);
 		
 		// Initialize release value data
 		auto releaseValueData = [environment, value](const char *valueData) {
@@ -927,14 +1058,14 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommitS
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get number of positive commits
 		const jsize numberOfPositiveCommits = environment->GetArrayLength(positiveCommits);
 		
 		// Initialize positive commits data and positive commits sizes
-		vector<uint8_t> positiveCommitsData;
-		size_t positiveCommitsSizes[numberOfPositiveCommits];
+		SecureBytes positiveCommitsData;
+		vector<size_t> positiveCommitsSizes(numberOfPositiveCommits);
 		
 		// Go through all positive commits
 		for(jsize i = 0; i < numberOfPositiveCommits; ++i) {
@@ -948,7 +1079,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommitS
 			}
 			
 			// Get data from commit
-			const vector<uint8_t> commitData = fromHexString(environment, commit);
+			const SecureBytes commitData = fromHexString(environment, commit);
+			
+			// Delete commit local reference
+			environment->DeleteLocalRef(commit);
 			
 			// Append commit data to positive commits data
 			positiveCommitsData.insert(positiveCommitsData.cend(), commitData.cbegin(), commitData.cend());
@@ -961,8 +1095,8 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommitS
 		const jsize numberOfNegativeCommits = environment->GetArrayLength(negativeCommits);
 		
 		// Initialize negative commits data and negative commits sizes
-		vector<uint8_t> negativeCommitsData;
-		size_t negativeCommitsSizes[numberOfNegativeCommits];
+		SecureBytes negativeCommitsData;
+		vector<size_t> negativeCommitsSizes(numberOfNegativeCommits);
 		
 		// Go through all negative commits
 		for(jsize i = 0; i < numberOfNegativeCommits; ++i) {
@@ -976,7 +1110,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommitS
 			}
 			
 			// Get data from commit
-			const vector<uint8_t> commitData = fromHexString(environment, commit);
+			const SecureBytes commitData = fromHexString(environment, commit);
+			
+			// Delete commit local reference
+			environment->DeleteLocalRef(commit);
 			
 			// Append commit data to negative commits data
 			negativeCommitsData.insert(negativeCommitsData.cend(), commitData.cbegin(), commitData.cend());
@@ -986,7 +1123,7 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommitS
 		}
 		
 		// Return performing Pedersen commit sum
-		return toHexString(environment, pedersenCommitSum(contextSeedData.data(), contextSeedData.size(), positiveCommitsData.data(), positiveCommitsSizes, numberOfPositiveCommits, negativeCommitsData.data(), negativeCommitsSizes, numberOfNegativeCommits));
+		return toHexString(environment, pedersenCommitSum(contextSeedData.data(), contextSeedData.size(), positiveCommitsData.data(), positiveCommitsSizes.data(), numberOfPositiveCommits, negativeCommitsData.data(), negativeCommitsSizes.data(), numberOfNegativeCommits));
 	}
 	
 	// Catch errors
@@ -1011,10 +1148,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommitT
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(environment, commit);
+		const SecureBytes commitData = fromHexString(environment, commit);
 
 		// Return getting public key from Pedersen commit
 		return toHexString(environment, pedersenCommitToPublicKey(contextSeedData.data(), contextSeedData.size(), commitData.data(), commitData.size()));
@@ -1042,10 +1179,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePublicKeyToPede
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 
 		// Return getting Pedersen commit from public key
 		return toHexString(environment, publicKeyToPedersenCommit(contextSeedData.data(), contextSeedData.size(), publicKeyData.data(), publicKeyData.size()));
@@ -1073,28 +1210,28 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateSingleSig
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from message
-		const vector<uint8_t> messageData = fromHexString(environment, message);
+		const SecureBytes messageData = fromHexString(environment, message);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(environment, secretKey);
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
 		
 		// Get data from secret nonce
-		const vector<uint8_t> secretNonceData = secretNonce ? fromHexString(environment, secretNonce) : vector<uint8_t>();
+		const SecureBytes secretNonceData = secretNonce ? fromHexString(environment, secretNonce) : SecureBytes();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 		
 		// Get data from public nonce
-		const vector<uint8_t> publicNonceData = publicNonce ? fromHexString(environment, publicNonce) : vector<uint8_t>();
+		const SecureBytes publicNonceData = publicNonce ? fromHexString(environment, publicNonce) : SecureBytes();
 		
 		// Get data from public nonce total
-		const vector<uint8_t> publicNonceTotalData = publicNonceTotal ? fromHexString(environment, publicNonceTotal) : vector<uint8_t>();
+		const SecureBytes publicNonceTotalData = publicNonceTotal ? fromHexString(environment, publicNonceTotal) : SecureBytes();
 		
 		// Get data from seed
-		const vector<uint8_t> seedData = fromHexString(environment, seed);
+		const SecureBytes seedData = fromHexString(environment, seed);
 
 		// Return creating single-signer signature
 		return toHexString(environment, createSingleSignerSignature(contextSeedData.data(), contextSeedData.size(), messageData.data(), messageData.size(), secretKeyData.data(), secretKeyData.size(), secretNonce ? secretNonceData.data() : nullptr, secretNonceData.size(), publicKeyData.data(), publicKeyData.size(), publicNonce ? publicNonceData.data() : nullptr, publicNonceData.size(), publicNonceTotal ? publicNonceTotalData.data() : nullptr, publicNonceTotalData.size(), seedData.data(), seedData.size()));
@@ -1122,14 +1259,14 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAddSingleSigner
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get number of signatures
 		const jsize numberOfSignatures = environment->GetArrayLength(signatures);
 		
 		// Initialize signatures data and signatures sizes
-		vector<uint8_t> signaturesData;
-		size_t signaturesSizes[numberOfSignatures];
+		SecureBytes signaturesData;
+		vector<size_t> signaturesSizes(numberOfSignatures);
 		
 		// Go through all signatures
 		for(jsize i = 0; i < numberOfSignatures; ++i) {
@@ -1143,7 +1280,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAddSingleSigner
 			}
 			
 			// Get data from signature
-			const vector<uint8_t> signatureData = fromHexString(environment, signature);
+			const SecureBytes signatureData = fromHexString(environment, signature);
+			
+			// Delete signature local reference
+			environment->DeleteLocalRef(signature);
 			
 			// Append signature data to signatures data
 			signaturesData.insert(signaturesData.cend(), signatureData.cbegin(), signatureData.cend());
@@ -1153,10 +1293,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAddSingleSigner
 		}
 		
 		// Get data from public nonce total
-		const vector<uint8_t> publicNonceTotalData = fromHexString(environment, publicNonceTotal);
+		const SecureBytes publicNonceTotalData = fromHexString(environment, publicNonceTotal);
 		
 		// Return adding single-signer signatures
-		return toHexString(environment, addSingleSignerSignatures(contextSeedData.data(), contextSeedData.size(), signaturesData.data(), signaturesSizes, numberOfSignatures, publicNonceTotalData.data(), publicNonceTotalData.size()));
+		return toHexString(environment, addSingleSignerSignatures(contextSeedData.data(), contextSeedData.size(), signaturesData.data(), signaturesSizes.data(), numberOfSignatures, publicNonceTotalData.data(), publicNonceTotalData.size()));
 	}
 	
 	// Catch errors
@@ -1181,22 +1321,22 @@ jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeVerifySingleSi
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(environment, signature);
+		const SecureBytes signatureData = fromHexString(environment, signature);
 		
 		// Get data from message
-		const vector<uint8_t> messageData = fromHexString(environment, message);
+		const SecureBytes messageData = fromHexString(environment, message);
 		
 		// Get data from public nonce
-		const vector<uint8_t> publicNonceData = publicNonce ? fromHexString(environment, publicNonce) : vector<uint8_t>();
+		const SecureBytes publicNonceData = publicNonce ? fromHexString(environment, publicNonce) : SecureBytes();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 		
 		// Get data from public key total
-		const vector<uint8_t> publicKeyTotalData = fromHexString(environment, publicKeyTotal);
+		const SecureBytes publicKeyTotalData = fromHexString(environment, publicKeyTotal);
 
 		// Return if single-signer signature is verified
 		return toBool(verifySingleSignerSignature(contextSeedData.data(), contextSeedData.size(), signatureData.data(), signatureData.size(), messageData.data(), messageData.size(), publicNonce ? publicNonceData.data() : nullptr, publicNonceData.size(), publicKeyData.data(), publicKeyData.size(), publicKeyTotalData.data(), publicKeyTotalData.size(), fromBool(isPartial)));
@@ -1224,10 +1364,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSingleSignerSig
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from data
-		const vector<uint8_t> dataData = fromHexString(environment, data);
+		const SecureBytes dataData = fromHexString(environment, data);
 
 		// Return getting single-signer signature from data
 		return toHexString(environment, singleSignerSignatureFromData(contextSeedData.data(), contextSeedData.size(), dataData.data(), dataData.size()));
@@ -1255,10 +1395,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCompactSingleSi
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(environment, signature);
+		const SecureBytes signatureData = fromHexString(environment, signature);
 
 		// Return compacting single-signer signature
 		return toHexString(environment, compactSingleSignerSignature(contextSeedData.data(), contextSeedData.size(), signatureData.data(), signatureData.size()));
@@ -1286,10 +1426,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeUncompactSingle
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(environment, signature);
+		const SecureBytes signatureData = fromHexString(environment, signature);
 
 		// Return uncompacting single-signer signature
 		return toHexString(environment, uncompactSingleSignerSignature(contextSeedData.data(), contextSeedData.size(), signatureData.data(), signatureData.size()));
@@ -1317,14 +1457,14 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCombinePublicKe
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get number of public keys
 		const jsize numberOfPublicKeys = environment->GetArrayLength(publicKeys);
 		
 		// Initialize public keys data and public keys sizes
-		vector<uint8_t> publicKeysData;
-		size_t publicKeysSizes[numberOfPublicKeys];
+		SecureBytes publicKeysData;
+		vector<size_t> publicKeysSizes(numberOfPublicKeys);
 		
 		// Go through all public keys
 		for(jsize i = 0; i < numberOfPublicKeys; ++i) {
@@ -1338,7 +1478,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCombinePublicKe
 			}
 			
 			// Get data from public key
-			const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+			const SecureBytes publicKeyData = fromHexString(environment, publicKey);
+			
+			// Delete public key local reference
+			environment->DeleteLocalRef(publicKey);
 			
 			// Append public key data to public keys data
 			publicKeysData.insert(publicKeysData.cend(), publicKeyData.cbegin(), publicKeyData.cend());
@@ -1348,7 +1491,7 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCombinePublicKe
 		}
 		
 		// Return combining public keys
-		return toHexString(environment, combinePublicKeys(contextSeedData.data(), contextSeedData.size(), publicKeysData.data(), publicKeysSizes, numberOfPublicKeys));
+		return toHexString(environment, combinePublicKeys(contextSeedData.data(), contextSeedData.size(), publicKeysData.data(), publicKeysSizes.data(), numberOfPublicKeys));
 	}
 	
 	// Catch errors
@@ -1373,10 +1516,10 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateSecretNon
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from seed
-		const vector<uint8_t> seedData = fromHexString(environment, seed);
+		const SecureBytes seedData = fromHexString(environment, seed);
 		
 		// Return creating secure nonce
 		return toHexString(environment, createSecretNonce(contextSeedData.data(), contextSeedData.size(), seedData.data(), seedData.size()));
@@ -1404,13 +1547,13 @@ jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateMessageHa
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from message hash
-		const vector<uint8_t> messageHashData = fromHexString(environment, messageHash);
+		const SecureBytes messageHashData = fromHexString(environment, messageHash);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(environment, secretKey);
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
 
 		// Return creating message hash signature
 		return toHexString(environment, createMessageHashSignature(contextSeedData.data(), contextSeedData.size(), messageHashData.data(), messageHashData.size(), secretKeyData.data(), secretKeyData.size()));
@@ -1438,16 +1581,16 @@ jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeVerifyMessageH
 	try {
 	
 		// Get data from context seed
-		const vector<uint8_t> contextSeedData = fromHexString(environment, contextSeed);
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(environment, signature);
+		const SecureBytes signatureData = fromHexString(environment, signature);
 		
 		// Get data from message hash
-		const vector<uint8_t> messageHashData = fromHexString(environment, messageHash);
+		const SecureBytes messageHashData = fromHexString(environment, messageHash);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(environment, publicKey);
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
 
 		// Return if message hash signature is verified
 		return toBool(verifyMessageHashSignature(contextSeedData.data(), contextSeedData.size(), signatureData.data(), signatureData.size(), messageHashData.data(), messageHashData.size(), publicKeyData.data(), publicKeyData.size()));
@@ -1468,14 +1611,50 @@ jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeVerifyMessageH
 	}
 }
 
-// Native seed size
-jint Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSeedSize(JNIEnv *environment, jclass type) {
+// Native create bulletproof session
+jlong Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateBulletproofSession(JNIEnv *environment, jclass type, jstring contextSeed, jstring blind, jstring value, jstring commit, jstring nonce, jstring privateNonce, jstring extraCommit, jstring message) {
 
 	// Try
 	try {
 	
-		// Return seedSize
-		return seedSize();
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from blind
+		const SecureBytes blindData = blind ? fromHexString(environment, blind) : SecureBytes();
+		
+		// Initialize release value data
+		auto releaseValueData = [environment, value](const char *valueData) {
+		
+			// Release value data
+			environment->ReleaseStringUTFChars(value, valueData);
+		};
+
+		// Check if getting data from value failed
+		const unique_ptr<const char,  decltype(releaseValueData)> valueData(environment->GetStringUTFChars(value, nullptr), releaseValueData);
+		if(!valueData) {
+		
+			// Throw error
+			throw runtime_error("Getting data from value failed");
+		}
+		
+		// Get data from commit
+		const SecureBytes commitData = fromHexString(environment, commit);
+		
+		// Get data from nonce
+		const SecureBytes nonceData = fromHexString(environment, nonce);
+		
+		// Get data from private nonce
+		const SecureBytes privateNonceData = privateNonce ? fromHexString(environment, privateNonce) : SecureBytes();
+		
+		// Get data from extra commit
+		const SecureBytes extraCommitData = fromHexString(environment, extraCommit);
+		
+		// Get data from message
+		const SecureBytes messageData = fromHexString(environment, message);
+		
+		// Return creating bulletproof session
+		return createBulletproofSession(contextSeedData.data(), contextSeedData.size(), blind ? blindData.data() : nullptr, blindData.size(), valueData.get(), commitData.data(), commitData.size(), nonceData.data(), nonceData.size(), privateNonceData.data(), privateNonceData.size(), extraCommitData.data(), extraCommitData.size(), messageData.data(), messageData.size());
 	}
 	
 	// Catch errors
@@ -1493,66 +1672,2269 @@ jint Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSeedSize(JNIEnv *e
 	}
 }
 
-// From hex string
-vector<uint8_t> fromHexString(JNIEnv *environment, jstring hexString) {
+// Native bulletproof session round one
+jobjectArray Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBulletproofSessionRoundOne(JNIEnv *environment, jclass type, jstring contextSeed, jlong session) {
 
-	// Initialize release input
-	auto releaseInput = [environment, hexString](const char *input) {
+	// Try
+	try {
 	
-		// Release input
-		environment->ReleaseStringUTFChars(hexString, input);
-	};
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Perform round one with the bulletproof session
+		const tuple<vector<uint8_t>, vector<uint8_t>> roundOneData = bulletproofSessionRoundOne(contextSeedData.data(), contextSeedData.size(), session);
+		
+		// Check if creating result failed
+		jobjectArray result = environment->NewObjectArray(2, environment->FindClass("java/lang/String"), nullptr);
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Set round one data in the result
+		environment->SetObjectArrayElement(result, 0, toHexString(environment, get<0>(roundOneData)));
+		environment->SetObjectArrayElement(result, 1, toHexString(environment, get<1>(roundOneData)));
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
 
-	// Check if getting input from hex string failed
-	const unique_ptr<const char,  decltype(releaseInput)> input(environment->GetStringUTFChars(hexString, nullptr), releaseInput);
-	if(!input) {
+// Native bulletproof session round two
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBulletproofSessionRoundTwo(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring tOne, jstring tTwo) {
+
+	// Try
+	try {
 	
-		// Throw error
-		throw runtime_error("Getting input from hex string failed");
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from t one
+		const SecureBytes tOneData = fromHexString(environment, tOne);
+		
+		// Get data from t two
+		const SecureBytes tTwoData = fromHexString(environment, tTwo);
+		
+		// Return performing round two with the bulletproof session
+		return toHexString(environment, bulletproofSessionRoundTwo(contextSeedData.data(), contextSeedData.size(), session, tOneData.data(), tOneData.size(), tTwoData.data(), tTwoData.size()));
 	}
 	
-	// Get input length
-	const size_t inputLength = strlen(input.get());
+	// Catch errors
+	catch(const exception &error) {
 	
-	// Check if input length is invalid
-	if(inputLength % HEX_CHARACTER_LENGTH) {
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native bulletproof session finalize
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBulletproofSessionFinalize(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring tauX) {
+
+	// Try
+	try {
 	
-		// Throw error
-		throw runtime_error("Input length is invalid");
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from tau X
+		const SecureBytes tauXData = fromHexString(environment, tauX);
+		
+		// Return finalizing the bulletproof session
+		return toHexString(environment, bulletproofSessionFinalize(contextSeedData.data(), contextSeedData.size(), session, tauXData.data(), tauXData.size()));
 	}
 	
-	// Initialize result
-	vector<uint8_t> result(inputLength / HEX_CHARACTER_LENGTH);
+	// Catch errors
+	catch(const exception &error) {
 	
-	// Go through all character pairs in the input
-	for(size_t i = 0; i < inputLength; i += HEX_CHARACTER_LENGTH) {
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native destroy bulletproof session
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDestroyBulletproofSession(JNIEnv *environment, jclass type, jlong session) {
+
+	// Try
+	try {
 	
-		// Set value in result
-		result[i / HEX_CHARACTER_LENGTH] = (characterToNumber(input.get()[i]) << BITS_IN_A_BYTE / 2) | characterToNumber(input.get()[i + 1]);
+		// Destroy bulletproof session
+		destroyBulletproofSession(session);
 	}
 	
-	// Return result
-	return result;
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
 }
 
-// To hex string
-jstring toHexString(JNIEnv *environment, const vector<uint8_t> &input) {
+// Native create aggsig session
+jlong Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateAggsigSession(JNIEnv *environment, jclass type, jstring contextSeed, jstring message, jstring publicKeyTotal, jstring publicNonceTotal) {
 
-	// Initialize result
-	ostringstream result;
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from message
+		const SecureBytes messageData = fromHexString(environment, message);
+		
+		// Get data from public key total
+		const SecureBytes publicKeyTotalData = fromHexString(environment, publicKeyTotal);
+		
+		// Get data from public nonce total
+		const SecureBytes publicNonceTotalData = fromHexString(environment, publicNonceTotal);
+		
+		// Return creating aggsig session
+		return createAggsigSession(contextSeedData.data(), contextSeedData.size(), messageData.data(), messageData.size(), publicKeyTotalData.data(), publicKeyTotalData.size(), publicNonceTotalData.data(), publicNonceTotalData.size());
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return zero
+		return 0;
+	}
+}
+
+// Native aggsig session partial sign
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggsigSessionPartialSign(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring secretKey, jstring secretNonce) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from secret key
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
+		
+		// Get data from secret nonce
+		const SecureBytes secretNonceData = fromHexString(environment, secretNonce);
+		
+		// Return creating partial signature with the aggsig session
+		return toHexString(environment, aggsigSessionPartialSign(contextSeedData.data(), contextSeedData.size(), session, secretKeyData.data(), secretKeyData.size(), secretNonceData.data(), secretNonceData.size()));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native aggsig session partial verify
+jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggsigSessionPartialVerify(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring signature, jstring publicKey) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from signature
+		const SecureBytes signatureData = fromHexString(environment, signature);
+		
+		// Get data from public key
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
+		
+		// Return if partial signature is verified with the aggsig session
+		return toBool(aggsigSessionPartialVerify(contextSeedData.data(), contextSeedData.size(), session, signatureData.data(), signatureData.size(), publicKeyData.data(), publicKeyData.size()));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return false
+		return JNI_FALSE;
+	}
+}
+
+// Native aggsig session aggregate
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggsigSessionAggregate(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jobjectArray signatures) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of signatures
+		const jsize numberOfSignatures = environment->GetArrayLength(signatures);
+		
+		// Initialize signatures data and signatures sizes
+		SecureBytes signaturesData;
+		vector<size_t> signaturesSizes(numberOfSignatures);
+		
+		// Go through all signatures
+		for(jsize i = 0; i < numberOfSignatures; ++i) {
+		
+			// Check if getting signature failed
+			const jstring signature = reinterpret_cast<jstring>(environment->GetObjectArrayElement(signatures, i));
+			if(!signature) {
+			
+				// Throw error
+				throw runtime_error("Getting signature failed");
+			}
+			
+			// Get data from signature
+			const SecureBytes signatureData = fromHexString(environment, signature);
+			
+			// Delete signature local reference
+			environment->DeleteLocalRef(signature);
+			
+			// Append signature data to signatures data
+			signaturesData.insert(signaturesData.cend(), signatureData.cbegin(), signatureData.cend());
+			
+			// Append signature data's size to signatures sizes
+			signaturesSizes[i] = signatureData.size();
+		}
+		
+		// Return aggregating signatures with the aggsig session
+		return toHexString(environment, aggsigSessionAggregate(contextSeedData.data(), contextSeedData.size(), session, signaturesData.data(), signaturesSizes.data(), numberOfSignatures));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native aggsig session verify
+jboolean Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggsigSessionVerify(JNIEnv *environment, jclass type, jstring contextSeed, jlong session, jstring signature) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from signature
+		const SecureBytes signatureData = fromHexString(environment, signature);
+		
+		// Return if signature is verified with the aggsig session
+		return toBool(aggsigSessionVerify(contextSeedData.data(), contextSeedData.size(), session, signatureData.data(), signatureData.size()));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return false
+		return JNI_FALSE;
+	}
+}
+
+// Native destroy aggsig session
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDestroyAggsigSession(JNIEnv *environment, jclass type, jlong session) {
+
+	// Try
+	try {
+	
+		// Destroy aggsig session
+		destroyAggsigSession(session);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native create nonce pair
+jobjectArray Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateNoncePair(JNIEnv *environment, jclass type, jstring contextSeed) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get nonce pair
+		tuple<SecureBytes, vector<uint8_t>> noncePair = createNoncePair(contextSeedData.data(), contextSeedData.size());
+		
+		// Get nonce pair as hex strings
+		const jstring secretNonce = toHexString(environment, get<0>(noncePair));
+		const jstring publicNonce = toHexString(environment, get<1>(noncePair));
+		
+		// Clear secret nonce
+		fill(get<0>(noncePair).begin(), get<0>(noncePair).end(), 0);
+		
+		// Check if creating result failed
+		jobjectArray result = environment->NewObjectArray(2, environment->FindClass("java/lang/String"), nullptr);
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Set nonce pair in the result
+		environment->SetObjectArrayElement(result, 0, secretNonce);
+		environment->SetObjectArrayElement(result, 1, publicNonce);
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native derive child secret keys
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDeriveChildSecretKeys(JNIEnv *environment, jclass type, jstring contextSeed, jstring secretKey, jstring chainCode, jlong startIndex, jlong numberOfIndices, jboolean isHardened) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from secret key
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
+		
+		// Get data from chain code
+		const SecureBytes chainCodeData = fromHexString(environment, chainCode);
+		
+		// Check if indices are invalid
+		if(startIndex < 0 || startIndex > UINT32_MAX || numberOfIndices < 0 || numberOfIndices > UINT32_MAX) {
+		
+			// Throw error
+			throw runtime_error("Indices are invalid");
+		}
+		
+		// Return deriving child secret keys
+		return toHexString(environment, deriveChildSecretKeys(contextSeedData.data(), contextSeedData.size(), secretKeyData.data(), secretKeyData.size(), chainCodeData.data(), chainCodeData.size(), startIndex, numberOfIndices, fromBool(isHardened)));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native derive child public keys
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDeriveChildPublicKeys(JNIEnv *environment, jclass type, jstring contextSeed, jstring publicKey, jstring chainCode, jlong startIndex, jlong numberOfIndices) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from public key
+		const SecureBytes publicKeyData = fromHexString(environment, publicKey);
+		
+		// Get data from chain code
+		const SecureBytes chainCodeData = fromHexString(environment, chainCode);
+		
+		// Check if indices are invalid
+		if(startIndex < 0 || startIndex > UINT32_MAX || numberOfIndices < 0 || numberOfIndices > UINT32_MAX) {
+		
+			// Throw error
+			throw runtime_error("Indices are invalid");
+		}
+		
+		// Return deriving child public keys
+		return toHexString(environment, deriveChildPublicKeys(contextSeedData.data(), contextSeedData.size(), publicKeyData.data(), publicKeyData.size(), chainCodeData.data(), chainCodeData.size(), startIndex, numberOfIndices));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native public keys from secret keys
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePublicKeysFromSecretKeys(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray secretKeys) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of secret keys
+		const jsize numberOfSecretKeys = environment->GetArrayLength(secretKeys);
+		
+		// Initialize secret keys data and secret keys sizes
+		SecureBytes secretKeysData;
+		vector<size_t> secretKeysSizes(numberOfSecretKeys);
+		
+		// Go through all secret keys
+		for(jsize i = 0; i < numberOfSecretKeys; ++i) {
+		
+			// Check if getting secret key failed
+			const jstring secretKey = reinterpret_cast<jstring>(environment->GetObjectArrayElement(secretKeys, i));
+			if(!secretKey) {
+			
+				// Throw error
+				throw runtime_error("Getting secret key failed");
+			}
+			
+			// Get data from secret key
+			const SecureBytes secretKeyData = fromHexString(environment, secretKey);
+			
+			// Delete secret key local reference
+			environment->DeleteLocalRef(secretKey);
+			
+			// Append secret key data to secret keys data
+			secretKeysData.insert(secretKeysData.cend(), secretKeyData.cbegin(), secretKeyData.cend());
+			
+			// Append secret key data's size to secret keys sizes
+			secretKeysSizes[i] = secretKeyData.size();
+		}
+		
+		// Return getting public keys from secret keys
+		return toHexString(environment, publicKeysFromSecretKeys(contextSeedData.data(), contextSeedData.size(), secretKeysData.data(), secretKeysSizes.data(), numberOfSecretKeys));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native Pedersen commits
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativePedersenCommits(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray blinds, jobjectArray values) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of blinds
+		const jsize numberOfBlinds = environment->GetArrayLength(blinds);
+		
+		// Initialize blinds data and blinds sizes
+		SecureBytes blindsData;
+		vector<size_t> blindsSizes(numberOfBlinds);
+		
+		// Go through all blinds
+		for(jsize i = 0; i < numberOfBlinds; ++i) {
+		
+			// Check if getting blind failed
+			const jstring blind = reinterpret_cast<jstring>(environment->GetObjectArrayElement(blinds, i));
+			if(!blind) {
+			
+				// Throw error
+				throw runtime_error("Getting blind failed");
+			}
+			
+			// Get data from blind
+			const SecureBytes blindData = fromHexString(environment, blind);
+			
+			// Delete blind local reference
+			environment->DeleteLocalRef(blind);
+			
+			// Append blind data to blinds data
+			blindsData.insert(blindsData.cend(), blindData.cbegin(), blindData.cend());
+			
+			// Append blind data's size to blinds sizes
+			blindsSizes[i] = blindData.size();
+		}
+		
+		// Get number of values
+		const jsize numberOfValues = environment->GetArrayLength(values);
+		
+		// Initialize values data
+		vector<string> valuesData(numberOfValues);
+		vector<const char *> valuesPointers(numberOfValues);
+		
+		// Go through all values
+		for(jsize i = 0; i < numberOfValues; ++i) {
+		
+			// Check if getting value failed
+			const jstring value = reinterpret_cast<jstring>(environment->GetObjectArrayElement(values, i));
+			if(!value) {
+			
+				// Throw error
+				throw runtime_error("Getting value failed");
+			}
+			
+			// Check if getting data from value failed
+			const char *valueData = environment->GetStringUTFChars(value, nullptr);
+			if(!valueData) {
+			
+				// Throw error
+				throw runtime_error("Getting data from value failed");
+			}
+			
+			// Set value data in values data
+			valuesData[i] = valueData;
+			valuesPointers[i] = valuesData[i].c_str();
+			
+			// Release value data
+			environment->ReleaseStringUTFChars(value, valueData);
+			
+			// Delete value local reference
+			environment->DeleteLocalRef(value);
+		}
+		
+		// Check if the number of blinds and values differ
+		if(numberOfBlinds != numberOfValues) {
+		
+			// Throw error
+			throw runtime_error("Number of blinds and values differ");
+		}
+		
+		// Return performing Pedersen commits
+		return toHexString(environment, pedersenCommits(contextSeedData.data(), contextSeedData.size(), blindsData.data(), blindsSizes.data(), valuesPointers.data(), numberOfBlinds));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native blind switches
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeBlindSwitches(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray blinds, jobjectArray values) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of blinds
+		const jsize numberOfBlinds = environment->GetArrayLength(blinds);
+		
+		// Initialize blinds data and blinds sizes
+		SecureBytes blindsData;
+		vector<size_t> blindsSizes(numberOfBlinds);
+		
+		// Go through all blinds
+		for(jsize i = 0; i < numberOfBlinds; ++i) {
+		
+			// Check if getting blind failed
+			const jstring blind = reinterpret_cast<jstring>(environment->GetObjectArrayElement(blinds, i));
+			if(!blind) {
+			
+				// Throw error
+				throw runtime_error("Getting blind failed");
+			}
+			
+			// Get data from blind
+			const SecureBytes blindData = fromHexString(environment, blind);
+			
+			// Delete blind local reference
+			environment->DeleteLocalRef(blind);
+			
+			// Append blind data to blinds data
+			blindsData.insert(blindsData.cend(), blindData.cbegin(), blindData.cend());
+			
+			// Append blind data's size to blinds sizes
+			blindsSizes[i] = blindData.size();
+		}
+		
+		// Get number of values
+		const jsize numberOfValues = environment->GetArrayLength(values);
+		
+		// Initialize values data
+		vector<string> valuesData(numberOfValues);
+		vector<const char *> valuesPointers(numberOfValues);
+		
+		// Go through all values
+		for(jsize i = 0; i < numberOfValues; ++i) {
+		
+			// Check if getting value failed
+			const jstring value = reinterpret_cast<jstring>(environment->GetObjectArrayElement(values, i));
+			if(!value) {
+			
+				// Throw error
+				throw runtime_error("Getting value failed");
+			}
+			
+			// Check if getting data from value failed
+			const char *valueData = environment->GetStringUTFChars(value, nullptr);
+			if(!valueData) {
+			
+				// Throw error
+				throw runtime_error("Getting data from value failed");
+			}
+			
+			// Set value data in values data
+			valuesData[i] = valueData;
+			valuesPointers[i] = valuesData[i].c_str();
+			
+			// Release value data
+			environment->ReleaseStringUTFChars(value, valueData);
+			
+			// Delete value local reference
+			environment->DeleteLocalRef(value);
+		}
+		
+		// Check if the number of blinds and values differ
+		if(numberOfBlinds != numberOfValues) {
+		
+			// Throw error
+			throw runtime_error("Number of blinds and values differ");
+		}
+		
+		// Return performing blind switches
+		return toHexString(environment, blindSwitches(contextSeedData.data(), contextSeedData.size(), blindsData.data(), blindsSizes.data(), valuesPointers.data(), numberOfBlinds));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native shared secret keys from secret key and public keys
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSharedSecretKeysFromSecretKeyAndPublicKeys(JNIEnv *environment, jclass type, jstring contextSeed, jstring secretKey, jobjectArray publicKeys) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from secret key
+		const SecureBytes secretKeyData = fromHexString(environment, secretKey);
+		
+		// Get number of public keys
+		const jsize numberOfPublicKeys = environment->GetArrayLength(publicKeys);
+		
+		// Initialize public keys data and public keys sizes
+		SecureBytes publicKeysData;
+		vector<size_t> publicKeysSizes(numberOfPublicKeys);
+		
+		// Go through all public keys
+		for(jsize i = 0; i < numberOfPublicKeys; ++i) {
+		
+			// Check if getting public key failed
+			const jstring publicKey = reinterpret_cast<jstring>(environment->GetObjectArrayElement(publicKeys, i));
+			if(!publicKey) {
+			
+				// Throw error
+				throw runtime_error("Getting public key failed");
+			}
+			
+			// Get data from public key
+			const SecureBytes publicKeyData = fromHexString(environment, publicKey);
+			
+			// Delete public key local reference
+			environment->DeleteLocalRef(publicKey);
+			
+			// Append public key data to public keys data
+			publicKeysData.insert(publicKeysData.cend(), publicKeyData.cbegin(), publicKeyData.cend());
+			
+			// Append public key data's size to public keys sizes
+			publicKeysSizes[i] = publicKeyData.size();
+		}
+		
+		// Return getting shared secret keys from secret key and public keys
+		return toHexString(environment, sharedSecretKeysFromSecretKeyAndPublicKeys(contextSeedData.data(), contextSeedData.size(), secretKeyData.data(), secretKeyData.size(), publicKeysData.data(), publicKeysSizes.data(), numberOfPublicKeys));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native create commit accumulator
+jlong Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCreateCommitAccumulator(JNIEnv *environment, jclass type, jstring contextSeed) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Return creating commit accumulator
+		return createCommitAccumulator(contextSeedData.data(), contextSeedData.size());
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return zero
+		return 0;
+	}
+}
+
+// Native commit accumulator add
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorAdd(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator, jobjectArray commits) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of commits
+		const jsize numberOfCommits = environment->GetArrayLength(commits);
+		
+		// Initialize commits data and commits sizes
+		SecureBytes commitsData;
+		vector<size_t> commitsSizes(numberOfCommits);
+		
+		// Go through all commits
+		for(jsize i = 0; i < numberOfCommits; ++i) {
+		
+			// Check if getting commit failed
+			const jstring commit = reinterpret_cast<jstring>(environment->GetObjectArrayElement(commits, i));
+			if(!commit) {
+			
+				// Throw error
+				throw runtime_error("Getting commit failed");
+			}
+			
+			// Get data from commit
+			const SecureBytes commitData = fromHexString(environment, commit);
+			
+			// Delete commit local reference
+			environment->DeleteLocalRef(commit);
+			
+			// Append commit data to commits data
+			commitsData.insert(commitsData.cend(), commitData.cbegin(), commitData.cend());
+			
+			// Append commit data's size to commits sizes
+			commitsSizes[i] = commitData.size();
+		}
+		
+		// Add commits to the commit accumulator
+		commitAccumulatorAdd(contextSeedData.data(), contextSeedData.size(), accumulator, commitsData.data(), commitsSizes.data(), numberOfCommits);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native commit accumulator subtract
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorSubtract(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator, jobjectArray commits) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of commits
+		const jsize numberOfCommits = environment->GetArrayLength(commits);
+		
+		// Initialize commits data and commits sizes
+		SecureBytes commitsData;
+		vector<size_t> commitsSizes(numberOfCommits);
+		
+		// Go through all commits
+		for(jsize i = 0; i < numberOfCommits; ++i) {
+		
+			// Check if getting commit failed
+			const jstring commit = reinterpret_cast<jstring>(environment->GetObjectArrayElement(commits, i));
+			if(!commit) {
+			
+				// Throw error
+				throw runtime_error("Getting commit failed");
+			}
+			
+			// Get data from commit
+			const SecureBytes commitData = fromHexString(environment, commit);
+			
+			// Delete commit local reference
+			environment->DeleteLocalRef(commit);
+			
+			// Append commit data to commits data
+			commitsData.insert(commitsData.cend(), commitData.cbegin(), commitData.cend());
+			
+			// Append commit data's size to commits sizes
+			commitsSizes[i] = commitData.size();
+		}
+		
+		// Subtract commits from the commit accumulator
+		commitAccumulatorSubtract(contextSeedData.data(), contextSeedData.size(), accumulator, commitsData.data(), commitsSizes.data(), numberOfCommits);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native commit accumulator checkpoint
+jlong Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorCheckpoint(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Return creating commit accumulator checkpoint
+		return commitAccumulatorCheckpoint(contextSeedData.data(), contextSeedData.size(), accumulator);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return zero
+		return 0;
+	}
+}
+
+// Native commit accumulator restore
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorRestore(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator, jlong checkpoint) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Restore commit accumulator
+		commitAccumulatorRestore(contextSeedData.data(), contextSeedData.size(), accumulator, checkpoint);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native commit accumulator total
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCommitAccumulatorTotal(JNIEnv *environment, jclass type, jstring contextSeed, jlong accumulator) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Return getting commit accumulator total
+		return toHexString(environment, commitAccumulatorTotal(contextSeedData.data(), contextSeedData.size(), accumulator));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native destroy commit accumulator
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeDestroyCommitAccumulator(JNIEnv *environment, jclass type, jlong accumulator) {
+
+	// Try
+	try {
+	
+		// Destroy commit accumulator
+		destroyCommitAccumulator(accumulator);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native multi scalar multiply
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeMultiScalarMultiply(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray points, jobjectArray scalars) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of points
+		const jsize numberOfPoints = environment->GetArrayLength(points);
+		
+		// Initialize points data and points sizes
+		SecureBytes pointsData;
+		vector<size_t> pointsSizes(numberOfPoints);
+		
+		// Go through all points
+		for(jsize i = 0; i < numberOfPoints; ++i) {
+		
+			// Check if getting point failed
+			const jstring point = reinterpret_cast<jstring>(environment->GetObjectArrayElement(points, i));
+			if(!point) {
+			
+				// Throw error
+				throw runtime_error("Getting point failed");
+			}
+			
+			// Get data from point
+			const SecureBytes pointData = fromHexString(environment, point);
+			
+			// Delete point local reference
+			environment->DeleteLocalRef(point);
+			
+			// Append point data to points data
+			pointsData.insert(pointsData.cend(), pointData.cbegin(), pointData.cend());
+			
+			// Append point data's size to points sizes
+			pointsSizes[i] = pointData.size();
+		}
+		
+		// Get number of scalars
+		const jsize numberOfScalars = environment->GetArrayLength(scalars);
+		
+		// Initialize scalars data and scalars sizes
+		SecureBytes scalarsData;
+		vector<size_t> scalarsSizes(numberOfScalars);
+		
+		// Go through all scalars
+		for(jsize i = 0; i < numberOfScalars; ++i) {
+		
+			// Check if getting scalar failed
+			const jstring scalar = reinterpret_cast<jstring>(environment->GetObjectArrayElement(scalars, i));
+			if(!scalar) {
+			
+				// Throw error
+				throw runtime_error("Getting scalar failed");
+			}
+			
+			// Get data from scalar
+			const SecureBytes scalarData = fromHexString(environment, scalar);
+			
+			// Delete scalar local reference
+			environment->DeleteLocalRef(scalar);
+			
+			// Append scalar data to scalars data
+			scalarsData.insert(scalarsData.cend(), scalarData.cbegin(), scalarData.cend());
+			
+			// Append scalar data's size to scalars sizes
+			scalarsSizes[i] = scalarData.size();
+		}
+		
+		// Check if the number of points and scalars differ
+		if(numberOfPoints != numberOfScalars) {
+		
+			// Throw error
+			throw runtime_error("Number of points and scalars differ");
+		}
+		
+		// Return performing multi scalar multiply
+		return toHexString(environment, multiScalarMultiply(contextSeedData.data(), contextSeedData.size(), pointsData.data(), pointsSizes.data(), scalarsData.data(), scalarsSizes.data(), numberOfPoints));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native scalar batch inverse
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeScalarBatchInverse(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray scalars) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of scalars
+		const jsize numberOfScalars = environment->GetArrayLength(scalars);
+		
+		// Initialize scalars data and scalars sizes
+		SecureBytes scalarsData;
+		vector<size_t> scalarsSizes(numberOfScalars);
+		
+		// Go through all scalars
+		for(jsize i = 0; i < numberOfScalars; ++i) {
+		
+			// Check if getting scalar failed
+			const jstring scalar = reinterpret_cast<jstring>(environment->GetObjectArrayElement(scalars, i));
+			if(!scalar) {
+			
+				// Throw error
+				throw runtime_error("Getting scalar failed");
+			}
+			
+			// Get data from scalar
+			const SecureBytes scalarData = fromHexString(environment, scalar);
+			
+			// Delete scalar local reference
+			environment->DeleteLocalRef(scalar);
+			
+			// Append scalar data to scalars data
+			scalarsData.insert(scalarsData.cend(), scalarData.cbegin(), scalarData.cend());
+			
+			// Append scalar data's size to scalars sizes
+			scalarsSizes[i] = scalarData.size();
+		}
+		
+		// Return performing scalar batch inverse
+		return toHexString(environment, scalarBatchInverse(contextSeedData.data(), contextSeedData.size(), scalarsData.data(), scalarsSizes.data(), numberOfScalars));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native evaluate scalar program
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeEvaluateScalarProgram(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray scalars, jstring program) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of scalars
+		const jsize numberOfScalars = environment->GetArrayLength(scalars);
+		
+		// Initialize scalars data and scalars sizes
+		SecureBytes scalarsData;
+		vector<size_t> scalarsSizes(numberOfScalars);
+		
+		// Go through all scalars
+		for(jsize i = 0; i < numberOfScalars; ++i) {
+		
+			// Check if getting scalar failed
+			const jstring scalar = reinterpret_cast<jstring>(environment->GetObjectArrayElement(scalars, i));
+			if(!scalar) {
+			
+				// Throw error
+				throw runtime_error("Getting scalar failed");
+			}
+			
+			// Get data from scalar
+			const SecureBytes scalarData = fromHexString(environment, scalar);
+			
+			// Delete scalar local reference
+			environment->DeleteLocalRef(scalar);
+			
+			// Append scalar data to scalars data
+			scalarsData.insert(scalarsData.cend(), scalarData.cbegin(), scalarData.cend());
+			
+			// Append scalar data's size to scalars sizes
+			scalarsSizes[i] = scalarData.size();
+		}
+		
+		// Get data from program
+		const SecureBytes programData = fromHexString(environment, program);
+		
+		// Return evaluating scalar program
+		return toHexString(environment, evaluateScalarProgram(contextSeedData.data(), contextSeedData.size(), scalarsData.data(), scalarsSizes.data(), numberOfScalars, programData.data(), programData.size()));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native execute commands
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeExecuteCommands(JNIEnv *environment, jclass type, jstring contextSeed, jstring commands) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from commands
+		const SecureBytes commandsData = fromHexString(environment, commands);
+		
+		// Return executing commands
+		return toHexString(environment, executeCommands(contextSeedData.data(), contextSeedData.size(), commandsData.data(), commandsData.size()));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native set verification cache capacity
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSetVerificationCacheCapacity(JNIEnv *environment, jclass type, jlong capacity) {
+
+	// Try
+	try {
+	
+		// Check if capacity is invalid
+		if(capacity < 0) {
+		
+			// Throw error
+			throw runtime_error("Capacity is invalid");
+		}
+		
+		// Set verification cache capacity
+		setVerificationCacheCapacity(capacity);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native get verification cache statistics
+jlongArray Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeGetVerificationCacheStatistics(JNIEnv *environment, jclass type) {
+
+	// Try
+	try {
+	
+		// Get verification cache statistics
+		const tuple<uint64_t, uint64_t, uint64_t> statistics = getVerificationCacheStatistics();
+		
+		// Check if creating result failed
+		jlongArray result = environment->NewLongArray(3);
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Set statistics in the result
+		const jlong statisticsData[] = {static_cast<jlong>(get<0>(statistics)), static_cast<jlong>(get<1>(statistics)), static_cast<jlong>(get<2>(statistics))};
+		environment->SetLongArrayRegion(result, 0, 3, statisticsData);
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native set thread count
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSetThreadCount(JNIEnv *environment, jclass type, jlong count) {
+
+	// Try
+	try {
+	
+		// Check if count is invalid
+		if(count < 0) {
+		
+			// Throw error
+			throw runtime_error("Count is invalid");
+		}
+		
+		// Set thread count
+		setThreadCount(count);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native open rewind cache
+jlong Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeOpenRewindCache(JNIEnv *environment, jclass type, jstring contextSeed, jstring path, jstring key) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from key
+		const SecureBytes keyData = fromHexString(environment, key);
+		
+		// Initialize release path data
+		auto releasePathData = [environment, path](const char *pathData) {
+		
+			// Release path data
+			environment->ReleaseStringUTFChars(path, pathData);
+		};
+		
+		// Check if getting data from path failed
+		const unique_ptr<const char, decltype(releasePathData)> pathData(environment->GetStringUTFChars(path, nullptr), releasePathData);
+		if(!pathData) {
+		
+			// Throw error
+			throw runtime_error("Getting data from path failed");
+		}
+		
+		// Return opening rewind cache
+		return openRewindCache(contextSeedData.data(), contextSeedData.size(), pathData.get(), keyData.data(), keyData.size());
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return zero
+		return 0;
+	}
+}
+
+// Native rewind bulletproof with cache
+jobjectArray Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeRewindBulletproofWithCache(JNIEnv *environment, jclass type, jstring contextSeed, jlong cache, jstring proof, jstring commit, jstring nonce) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get data from proof
+		const SecureBytes proofData = fromHexString(environment, proof);
+		
+		// Get data from commit
+		const SecureBytes commitData = fromHexString(environment, commit);
+		
+		// Get data from nonce
+		const SecureBytes nonceData = fromHexString(environment, nonce);
+		
+		// Performing rewind bulletproof with cache
+		const tuple<string, SecureBytes, vector<uint8_t>> bulletproofData = rewindBulletproofWithCache(contextSeedData.data(), contextSeedData.size(), cache, proofData.data(), proofData.size(), commitData.data(), commitData.size(), nonceData.data(), nonceData.size());
+		
+		// Check if getting value as a string failed
+		const jstring valueString = environment->NewStringUTF(get<0>(bulletproofData).c_str());
+		if(!valueString) {
+		
+			// Throw error
+			throw runtime_error("Getting value as a string failed");
+		}
+		
+		// Check if creating result failed
+		jobjectArray result = environment->NewObjectArray(3, environment->FindClass("java/lang/String"), nullptr);
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Set bulletproof data in the result
+		environment->SetObjectArrayElement(result, 0, valueString);
+		environment->SetObjectArrayElement(result, 1, toHexString(environment, get<1>(bulletproofData)));
+		environment->SetObjectArrayElement(result, 2, toHexString(environment, get<2>(bulletproofData)));
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native close rewind cache
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeCloseRewindCache(JNIEnv *environment, jclass type, jlong cache) {
+
+	// Try
+	try {
+	
+		// Close rewind cache
+		closeRewindCache(cache);
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native scan outputs
+jlongArray Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeScanOutputs(JNIEnv *environment, jclass type, jstring contextSeed, jstring inputPath, jlong startOffset, jstring outputPath, jstring nonce) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Initialize release input path data
+		auto releaseInputPathData = [environment, inputPath](const char *inputPathData) {
+		
+			// Release input path data
+			environment->ReleaseStringUTFChars(inputPath, inputPathData);
+		};
+		
+		// Check if getting data from input path failed
+		const unique_ptr<const char, decltype(releaseInputPathData)> inputPathData(environment->GetStringUTFChars(inputPath, nullptr), releaseInputPathData);
+		if(!inputPathData) {
+		
+			// Throw error
+			throw runtime_error("Getting data from input path failed");
+		}
+		
+		// Initialize release output path data
+		auto releaseOutputPathData = [environment, outputPath](const char *outputPathData) {
+		
+			// Release output path data
+			environment->ReleaseStringUTFChars(outputPath, outputPathData);
+		};
+		
+		// Check if getting data from output path failed
+		const unique_ptr<const char, decltype(releaseOutputPathData)> outputPathData(environment->GetStringUTFChars(outputPath, nullptr), releaseOutputPathData);
+		if(!outputPathData) {
+		
+			// Throw error
+			throw runtime_error("Getting data from output path failed");
+		}
+		
+		// Get data from nonce
+		const SecureBytes nonceData = fromHexString(environment, nonce);
+		
+		// Check if start offset is invalid
+		if(startOffset < 0) {
+		
+			// Throw error
+			throw runtime_error("Start offset is invalid");
+		}
+		
+		// Scan outputs
+		const tuple<uint64_t, uint64_t> scanResult = scanOutputs(contextSeedData.data(), contextSeedData.size(), inputPathData.get(), startOffset, outputPathData.get(), nonceData.data(), nonceData.size());
+		
+		// Check if creating result failed
+		jlongArray result = environment->NewLongArray(2);
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Set scan result in the result
+		const jlong scanResultData[] = {static_cast<jlong>(get<0>(scanResult)), static_cast<jlong>(get<1>(scanResult))};
+		environment->SetLongArrayRegion(result, 0, 2, scanResultData);
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native aggregate transactions
+jobjectArray Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeAggregateTransactions(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray inputs, jobjectArray outputs, jobjectArray kernelExcesses, jobjectArray offsets, jobjectArray fees) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of inputs
+		const jsize numberOfInputs = environment->GetArrayLength(inputs);
+		
+		// Initialize inputs data and inputs sizes
+		SecureBytes inputsData;
+		vector<size_t> inputsSizes(numberOfInputs);
+		
+		// Go through all inputs
+		for(jsize i = 0; i < numberOfInputs; ++i) {
+		
+			// Check if getting input failed
+			const jstring input = reinterpret_cast<jstring>(environment->GetObjectArrayElement(inputs, i));
+			if(!input) {
+			
+				// Throw error
+				throw runtime_error("Getting input failed");
+			}
+			
+			// Get data from input
+			const SecureBytes inputData = fromHexString(environment, input);
+			
+			// Delete input local reference
+			environment->DeleteLocalRef(input);
+			
+			// Append input data to inputs data
+			inputsData.insert(inputsData.cend(), inputData.cbegin(), inputData.cend());
+			
+			// Append input data's size to inputs sizes
+			inputsSizes[i] = inputData.size();
+		}
+		
+		// Get number of outputs
+		const jsize numberOfOutputs = environment->GetArrayLength(outputs);
+		
+		// Initialize outputs data and outputs sizes
+		SecureBytes outputsData;
+		vector<size_t> outputsSizes(numberOfOutputs);
+		
+		// Go through all outputs
+		for(jsize i = 0; i < numberOfOutputs; ++i) {
+		
+			// Check if getting output failed
+			const jstring output = reinterpret_cast<jstring>(environment->GetObjectArrayElement(outputs, i));
+			if(!output) {
+			
+				// Throw error
+				throw runtime_error("Getting output failed");
+			}
+			
+			// Get data from output
+			const SecureBytes outputData = fromHexString(environment, output);
+			
+			// Delete output local reference
+			environment->DeleteLocalRef(output);
+			
+			// Append output data to outputs data
+			outputsData.insert(outputsData.cend(), outputData.cbegin(), outputData.cend());
+			
+			// Append output data's size to outputs sizes
+			outputsSizes[i] = outputData.size();
+		}
+		
+		// Get number of kernel excesses
+		const jsize numberOfKernelExcesses = environment->GetArrayLength(kernelExcesses);
+		
+		// Initialize kernel excesses data and kernel excesses sizes
+		SecureBytes kernelExcessesData;
+		vector<size_t> kernelExcessesSizes(numberOfKernelExcesses);
+		
+		// Go through all kernel excesses
+		for(jsize i = 0; i < numberOfKernelExcesses; ++i) {
+		
+			// Check if getting kernel excess failed
+			const jstring kernelExcess = reinterpret_cast<jstring>(environment->GetObjectArrayElement(kernelExcesses, i));
+			if(!kernelExcess) {
+			
+				// Throw error
+				throw runtime_error("Getting kernel excess failed");
+			}
+			
+			// Get data from kernel excess
+			const SecureBytes kernelExcessData = fromHexString(environment, kernelExcess);
+			
+			// Delete kernel excess local reference
+			environment->DeleteLocalRef(kernelExcess);
+			
+			// Append kernel excess data to kernel excesses data
+			kernelExcessesData.insert(kernelExcessesData.cend(), kernelExcessData.cbegin(), kernelExcessData.cend());
+			
+			// Append kernel excess data's size to kernel excesses sizes
+			kernelExcessesSizes[i] = kernelExcessData.size();
+		}
+		
+		// Get number of offsets
+		const jsize numberOfOffsets = environment->GetArrayLength(offsets);
+		
+		// Initialize offsets data and offsets sizes
+		SecureBytes offsetsData;
+		vector<size_t> offsetsSizes(numberOfOffsets);
+		
+		// Go through all offsets
+		for(jsize i = 0; i < numberOfOffsets; ++i) {
+		
+			// Check if getting offset failed
+			const jstring offset = reinterpret_cast<jstring>(environment->GetObjectArrayElement(offsets, i));
+			if(!offset) {
+			
+				// Throw error
+				throw runtime_error("Getting offset failed");
+			}
+			
+			// Get data from offset
+			const SecureBytes offsetData = fromHexString(environment, offset);
+			
+			// Delete offset local reference
+			environment->DeleteLocalRef(offset);
+			
+			// Append offset data to offsets data
+			offsetsData.insert(offsetsData.cend(), offsetData.cbegin(), offsetData.cend());
+			
+			// Append offset data's size to offsets sizes
+			offsetsSizes[i] = offsetData.size();
+		}
+		
+		// Get number of fees
+		const jsize numberOfFees = environment->GetArrayLength(fees);
+		
+		// Initialize fees data
+		vector<string> feesData(numberOfFees);
+		vector<const char *> feesPointers(numberOfFees);
+		
+		// Go through all fees
+		for(jsize i = 0; i < numberOfFees; ++i) {
+		
+			// Check if getting fee failed
+			const jstring fee = reinterpret_cast<jstring>(environment->GetObjectArrayElement(fees, i));
+			if(!fee) {
+			
+				// Throw error
+				throw runtime_error("Getting fee failed");
+			}
+			
+			// Check if getting data from fee failed
+			const char *feeData = environment->GetStringUTFChars(fee, nullptr);
+			if(!feeData) {
+			
+				// Throw error
+				throw runtime_error("Getting data from fee failed");
+			}
+			
+			// Set fee data in fees data
+			feesData[i] = feeData;
+			feesPointers[i] = feesData[i].c_str();
+			
+			// Release fee data
+			environment->ReleaseStringUTFChars(fee, feeData);
+			
+			// Delete fee local reference
+			environment->DeleteLocalRef(fee);
+		}
+		
+		// Aggregate transactions
+		const tuple<vector<uint8_t>, vector<uint8_t>, vector<uint8_t>> aggregateData = aggregateTransactions(contextSeedData.data(), contextSeedData.size(), inputsData.data(), inputsSizes.data(), numberOfInputs, outputsData.data(), outputsSizes.data(), numberOfOutputs, kernelExcessesData.data(), kernelExcessesSizes.data(), numberOfKernelExcesses, offsetsData.data(), offsetsSizes.data(), numberOfOffsets, feesPointers.data(), numberOfFees);
+		
+		// Check if creating result failed
+		jobjectArray result = environment->NewObjectArray(3, environment->FindClass("java/lang/String"), nullptr);
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Set aggregate data in the result
+		environment->SetObjectArrayElement(result, 0, toHexString(environment, get<0>(aggregateData)));
+		environment->SetObjectArrayElement(result, 1, toHexString(environment, get<1>(aggregateData)));
+		environment->SetObjectArrayElement(result, 2, toHexString(environment, get<2>(aggregateData)));
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native validate block
+jlongArray Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeValidateBlock(JNIEnv *environment, jclass type, jstring contextSeed, jobjectArray inputs, jobjectArray outputs, jobjectArray proofs, jobjectArray kernelExcesses, jobjectArray signatures, jobjectArray messages, jstring offset, jstring reward) {
+
+	// Try
+	try {
+	
+		// Get data from context seed
+		const SecureBytes contextSeedData = fromHexString(environment, contextSeed);
+		
+		// Get number of inputs
+		const jsize numberOfInputs = environment->GetArrayLength(inputs);
+		
+		// Initialize inputs data and inputs sizes
+		SecureBytes inputsData;
+		vector<size_t> inputsSizes(numberOfInputs);
+		
+		// Go through all inputs
+		for(jsize i = 0; i < numberOfInputs; ++i) {
+		
+			// Check if getting input failed
+			const jstring input = reinterpret_cast<jstring>(environment->GetObjectArrayElement(inputs, i));
+			if(!input) {
+			
+				// Throw error
+				throw runtime_error("Getting input failed");
+			}
+			
+			// Get data from input
+			const SecureBytes inputData = fromHexString(environment, input);
+			
+			// Delete input local reference
+			environment->DeleteLocalRef(input);
+			
+			// Append input data to inputs data
+			inputsData.insert(inputsData.cend(), inputData.cbegin(), inputData.cend());
+			
+			// Append input data's size to inputs sizes
+			inputsSizes[i] = inputData.size();
+		}
+		
+		// Get number of outputs
+		const jsize numberOfOutputs = environment->GetArrayLength(outputs);
+		
+		// Initialize outputs data and outputs sizes
+		SecureBytes outputsData;
+		vector<size_t> outputsSizes(numberOfOutputs);
+		
+		// Go through all outputs
+		for(jsize i = 0; i < numberOfOutputs; ++i) {
+		
+			// Check if getting output failed
+			const jstring output = reinterpret_cast<jstring>(environment->GetObjectArrayElement(outputs, i));
+			if(!output) {
+			
+				// Throw error
+				throw runtime_error("Getting output failed");
+			}
+			
+			// Get data from output
+			const SecureBytes outputData = fromHexString(environment, output);
+			
+			// Delete output local reference
+			environment->DeleteLocalRef(output);
+			
+			// Append output data to outputs data
+			outputsData.insert(outputsData.cend(), outputData.cbegin(), outputData.cend());
+			
+			// Append output data's size to outputs sizes
+			outputsSizes[i] = outputData.size();
+		}
+		
+		// Get number of proofs
+		const jsize numberOfProofs = environment->GetArrayLength(proofs);
+		
+		// Initialize proofs data and proofs sizes
+		SecureBytes proofsData;
+		vector<size_t> proofsSizes(numberOfProofs);
+		
+		// Go through all proofs
+		for(jsize i = 0; i < numberOfProofs; ++i) {
+		
+			// Check if getting proof failed
+			const jstring proof = reinterpret_cast<jstring>(environment->GetObjectArrayElement(proofs, i));
+			if(!proof) {
+			
+				// Throw error
+				throw runtime_error("Getting proof failed");
+			}
+			
+			// Get data from proof
+			const SecureBytes proofData = fromHexString(environment, proof);
+			
+			// Delete proof local reference
+			environment->DeleteLocalRef(proof);
+			
+			// Append proof data to proofs data
+			proofsData.insert(proofsData.cend(), proofData.cbegin(), proofData.cend());
+			
+			// Append proof data's size to proofs sizes
+			proofsSizes[i] = proofData.size();
+		}
+		
+		// Get number of kernel excesses
+		const jsize numberOfKernelExcesses = environment->GetArrayLength(kernelExcesses);
+		
+		// Initialize kernel excesses data and kernel excesses sizes
+		SecureBytes kernelExcessesData;
+		vector<size_t> kernelExcessesSizes(numberOfKernelExcesses);
+		
+		// Go through all kernel excesses
+		for(jsize i = 0; i < numberOfKernelExcesses; ++i) {
+		
+			// Check if getting kernel excess failed
+			const jstring kernelExcess = reinterpret_cast<jstring>(environment->GetObjectArrayElement(kernelExcesses, i));
+			if(!kernelExcess) {
+			
+				// Throw error
+				throw runtime_error("Getting kernel excess failed");
+			}
+			
+			// Get data from kernel excess
+			const SecureBytes kernelExcessData = fromHexString(environment, kernelExcess);
+			
+			// Delete kernel excess local reference
+			environment->DeleteLocalRef(kernelExcess);
+			
+			// Append kernel excess data to kernel excesses data
+			kernelExcessesData.insert(kernelExcessesData.cend(), kernelExcessData.cbegin(), kernelExcessData.cend());
+			
+			// Append kernel excess data's size to kernel excesses sizes
+			kernelExcessesSizes[i] = kernelExcessData.size();
+		}
+		
+		// Get number of signatures
+		const jsize numberOfSignatures = environment->GetArrayLength(signatures);
+		
+		// Initialize signatures data and signatures sizes
+		SecureBytes signaturesData;
+		vector<size_t> signaturesSizes(numberOfSignatures);
+		
+		// Go through all signatures
+		for(jsize i = 0; i < numberOfSignatures; ++i) {
+		
+			// Check if getting signature failed
+			const jstring signature = reinterpret_cast<jstring>(environment->GetObjectArrayElement(signatures, i));
+			if(!signature) {
+			
+				// Throw error
+				throw runtime_error("Getting signature failed");
+			}
+			
+			// Get data from signature
+			const SecureBytes signatureData = fromHexString(environment, signature);
+			
+			// Delete signature local reference
+			environment->DeleteLocalRef(signature);
+			
+			// Append signature data to signatures data
+			signaturesData.insert(signaturesData.cend(), signatureData.cbegin(), signatureData.cend());
+			
+			// Append signature data's size to signatures sizes
+			signaturesSizes[i] = signatureData.size();
+		}
+		
+		// Get number of messages
+		const jsize numberOfMessages = environment->GetArrayLength(messages);
+		
+		// Initialize messages data and messages sizes
+		SecureBytes messagesData;
+		vector<size_t> messagesSizes(numberOfMessages);
+		
+		// Go through all messages
+		for(jsize i = 0; i < numberOfMessages; ++i) {
+		
+			// Check if getting message failed
+			const jstring message = reinterpret_cast<jstring>(environment->GetObjectArrayElement(messages, i));
+			if(!message) {
+			
+				// Throw error
+				throw runtime_error("Getting message failed");
+			}
+			
+			// Get data from message
+			const SecureBytes messageData = fromHexString(environment, message);
+			
+			// Delete message local reference
+			environment->DeleteLocalRef(message);
+			
+			// Append message data to messages data
+			messagesData.insert(messagesData.cend(), messageData.cbegin(), messageData.cend());
+			
+			// Append message data's size to messages sizes
+			messagesSizes[i] = messageData.size();
+		}
+		
+		// Get data from offset
+		const SecureBytes offsetData = fromHexString(environment, offset);
+		
+		// Initialize release reward data
+		auto releaseRewardData = [environment, reward](const char *rewardData) {
+		
+			// Release reward data
+			environment->ReleaseStringUTFChars(reward, rewardData);
+		};
+		
+		// Check if getting data from reward failed
+		const unique_ptr<const char, decltype(releaseRewardData)> rewardData(environment->GetStringUTFChars(reward, nullptr), releaseRewardData);
+		if(!rewardData) {
+		
+			// Throw error
+			throw runtime_error("Getting data from reward failed");
+		}
+		
+		// Validate block
+		const tuple<uint8_t, uint64_t> validation = validateBlock(contextSeedData.data(), contextSeedData.size(), inputsData.data(), inputsSizes.data(), numberOfInputs, outputsData.data(), outputsSizes.data(), numberOfOutputs, proofsData.data(), proofsSizes.data(), numberOfProofs, kernelExcessesData.data(), kernelExcessesSizes.data(), numberOfKernelExcesses, signaturesData.data(), signaturesSizes.data(), numberOfSignatures, messagesData.data(), messagesSizes.data(), numberOfMessages, offsetData.data(), offsetData.size(), rewardData.get());
+		
+		// Check if creating result failed
+		jlongArray result = environment->NewLongArray(2);
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Set validation in the result
+		const jlong validationData[] = {static_cast<jlong>(get<0>(validation)), static_cast<jlong>(get<1>(validation))};
+		environment->SetLongArrayRegion(result, 0, 2, validationData);
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native get stats
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeGetStats(JNIEnv *environment, jclass type) {
+
+	// Try
+	try {
+	
+		// Get stats
+		const string stats = getStats();
+		
+		// Check if getting stats as a string failed
+		const jstring result = environment->NewStringUTF(stats.c_str());
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Getting stats as a string failed");
+		}
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native reset stats
+void Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeResetStats(JNIEnv *environment, jclass type) {
+
+	// Try
+	try {
+	
+		// Reset stats
+		resetStats();
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+	}
+}
+
+// Native SHA-256 hashes
+jstring Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSha256Hashes(JNIEnv *environment, jclass type, jobjectArray messages) {
+
+	// Try
+	try {
+	
+		// Get number of messages
+		const jsize numberOfMessages = environment->GetArrayLength(messages);
+		
+		// Initialize messages data and messages sizes
+		SecureBytes messagesData;
+		vector<size_t> messagesSizes(numberOfMessages);
+		
+		// Go through all messages
+		for(jsize i = 0; i < numberOfMessages; ++i) {
+		
+			// Check if getting message failed
+			const jstring message = reinterpret_cast<jstring>(environment->GetObjectArrayElement(messages, i));
+			if(!message) {
+			
+				// Throw error
+				throw runtime_error("Getting message failed");
+			}
+			
+			// Get data from message
+			const SecureBytes messageData = fromHexString(environment, message);
+			
+			// Delete message local reference
+			environment->DeleteLocalRef(message);
+			
+			// Append message data to messages data
+			messagesData.insert(messagesData.cend(), messageData.cbegin(), messageData.cend());
+			
+			// Append message data's size to messages sizes
+			messagesSizes[i] = messageData.size();
+		}
+		
+		// Return getting SHA-256 hashes of the messages
+		return toHexString(environment, sha256Hashes(messagesData.data(), messagesSizes.data(), numberOfMessages));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Native seed size
+jint Java_com_secp256k1zkpreact_Secp256k1ZkpReactModule_nativeSeedSize(JNIEnv *environment, jclass type) {
+
+	// Try
+	try {
+	
+		// Return seedSize
+		return seedSize();
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Check if throwing error failed
+		if(environment->ThrowNew(environment->FindClass("java/lang/RuntimeException"), error.what() ? error.what() : "")) {
+		
+			// Exit
+			exit(0);
+		}
+		
+		// Return zero
+		return 0;
+	}
+}
+
+// From hex string
+SecureBytes fromHexString(JNIEnv *environment, jstring hexString) {
+
+	// Trace converting from hex
+	TRACE_SPAN("fromHexString");
+	
+	// Initialize release input
+	auto releaseInput = [environment, hexString](const char *input) {
+	
+		// Release input
+		environment->ReleaseStringUTFChars(hexString, input);
+	};
+
+	// Check if getting input from hex string failed
+	const unique_ptr<const char,  decltype(releaseInput)> input(environment->GetStringUTFChars(hexString, nullptr), releaseInput);
+	if(!input) {
+	
+		// Throw error
+		throw runtime_error("Getting input from hex string failed");
+	}
+	
+	// Get input length
+	const size_t inputLength = strlen(input.get());
+	
+	// Check if input length is invalid
+	if(inputLength % HEX_CHARACTER_LENGTH) {
+	
+		// Throw error
+		throw runtime_error("Input length is invalid");
+	}
+	
+	// Initialize result
+	SecureBytes result(inputLength / HEX_CHARACTER_LENGTH);
+	
+	// Go through all character pairs in the input
+	for(size_t i = 0; i < inputLength; i += HEX_CHARACTER_LENGTH) {
+	
+		// Set value in result
+		result[i / HEX_CHARACTER_LENGTH] = (characterToNumber(input.get()[i]) << BITS_IN_A_BYTE / 2) | characterToNumber(input.get()[i + 1]);
+	}
+	
+	// Return result
+	return result;
+}
+
+// To hex string
+template<typename Allocator> jstring toHexString(JNIEnv *environment, const vector<uint8_t, Allocator> &input) {
+
+	// Trace converting to hex
+	TRACE_SPAN("toHexString");
 	
-	// Configure result
-	result << hex << setfill('0');
+	// Initialize result in secure memory so that it's cleared after use
+	vector<char, SecureAllocator<char>> result(input.size() * HEX_CHARACTER_LENGTH + sizeof('\0'));
 	
 	// Go through all bytes in the input
-	for(const uint8_t byte : input) {
+	for(size_t i = 0; i < input.size(); ++i) {
 	
-		// Append byte to result
-		result << setw(HEX_CHARACTER_LENGTH) << static_cast<unsigned>(byte);
+		// Set byte's characters in result
+		result[i * HEX_CHARACTER_LENGTH] = HEX_CHARACTERS[input[i] >> BITS_IN_A_BYTE / 2];
+		result[i * HEX_CHARACTER_LENGTH + 1] = HEX_CHARACTERS[input[i] & ((1 << BITS_IN_A_BYTE / 2) - 1)];
 	}
 	
 	// Check if getting result as a string failed
-	const jstring resultString = environment->NewStringUTF(result.str().c_str());
+	const jstring resultString = environment->NewStringUTF(result.data());
 	if(!resultString) {
 	
 		// Throw error
@@ -782,6 +782,990 @@ public class Secp256k1ZkpReactModule extends ReactContextBaseJavaModule {
 		}
 	}
 	
+	// Create bulletproof session
+	@ReactMethod
+	public void createBulletproofSession(String blind, String value, String commit, String nonce, String privateNonce, String extraCommit, String message, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native create bulletproof session
+			promise.resolve((double)nativeCreateBulletproofSession(toHexString(contextSeed), blind, value, commit, nonce, privateNonce, extraCommit, message));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Bulletproof session round one
+	@ReactMethod
+	public void bulletproofSessionRoundOne(double session, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Get round one data from native bulletproof session round one
+			String[] roundOneData = nativeBulletproofSessionRoundOne(toHexString(contextSeed), (long)session);
+			
+			// Initialize result
+			WritableMap result = Arguments.createMap();
+			
+			// Add round one data to result
+			result.putString("TOne", roundOneData[0]);
+			result.putString("TTwo", roundOneData[1]);
+			
+			// Resolve promise to result
+			promise.resolve(result);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Bulletproof session round two
+	@ReactMethod
+	public void bulletproofSessionRoundTwo(double session, String tOne, String tTwo, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native bulletproof session round two
+			promise.resolve(nativeBulletproofSessionRoundTwo(toHexString(contextSeed), (long)session, tOne, tTwo));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Bulletproof session finalize
+	@ReactMethod
+	public void bulletproofSessionFinalize(double session, String tauX, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native bulletproof session finalize
+			promise.resolve(nativeBulletproofSessionFinalize(toHexString(contextSeed), (long)session, tauX));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Destroy bulletproof session
+	@ReactMethod
+	public void destroyBulletproofSession(double session, Promise promise) {
+
+		// Try
+		try {
+			
+			// Native destroy bulletproof session
+			nativeDestroyBulletproofSession((long)session);
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Create aggsig session
+	@ReactMethod
+	public void createAggsigSession(String message, String publicKeyTotal, String publicNonceTotal, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native create aggsig session
+			promise.resolve((double)nativeCreateAggsigSession(toHexString(contextSeed), message, publicKeyTotal, publicNonceTotal));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Aggsig session partial sign
+	@ReactMethod
+	public void aggsigSessionPartialSign(double session, String secretKey, String secretNonce, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native aggsig session partial sign
+			promise.resolve(nativeAggsigSessionPartialSign(toHexString(contextSeed), (long)session, secretKey, secretNonce));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Aggsig session partial verify
+	@ReactMethod
+	public void aggsigSessionPartialVerify(double session, String signature, String publicKey, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native aggsig session partial verify
+			promise.resolve(nativeAggsigSessionPartialVerify(toHexString(contextSeed), (long)session, signature, publicKey));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Aggsig session aggregate
+	@ReactMethod
+	public void aggsigSessionAggregate(double session, ReadableArray signatures, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native aggsig session aggregate
+			promise.resolve(nativeAggsigSessionAggregate(toHexString(contextSeed), (long)session, fromReadableArray(signatures)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Aggsig session verify
+	@ReactMethod
+	public void aggsigSessionVerify(double session, String signature, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native aggsig session verify
+			promise.resolve(nativeAggsigSessionVerify(toHexString(contextSeed), (long)session, signature));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Destroy aggsig session
+	@ReactMethod
+	public void destroyAggsigSession(double session, Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Native destroy aggsig session
+			nativeDestroyAggsigSession((long)session);
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Create nonce pair
+	@ReactMethod
+	public void createNoncePair(Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Get nonce pair from native create nonce pair
+			String[] noncePair = nativeCreateNoncePair(toHexString(contextSeed));
+			
+			// Initialize result
+			WritableMap result = Arguments.createMap();
+			
+			// Add nonce pair to result
+			result.putString("SecretNonce", noncePair[0]);
+			result.putString("PublicNonce", noncePair[1]);
+			
+			// Resolve promise to result
+			promise.resolve(result);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Derive child secret keys
+	@ReactMethod
+	public void deriveChildSecretKeys(String secretKey, String chainCode, double startIndex, double numberOfIndices, boolean isHardened, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native derive child secret keys
+			promise.resolve(nativeDeriveChildSecretKeys(toHexString(contextSeed), secretKey, chainCode, (long)startIndex, (long)numberOfIndices, isHardened));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Derive child public keys
+	@ReactMethod
+	public void deriveChildPublicKeys(String publicKey, String chainCode, double startIndex, double numberOfIndices, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native derive child public keys
+			promise.resolve(nativeDeriveChildPublicKeys(toHexString(contextSeed), publicKey, chainCode, (long)startIndex, (long)numberOfIndices));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Public keys from secret keys
+	@ReactMethod
+	public void publicKeysFromSecretKeys(ReadableArray secretKeys, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native public keys from secret keys
+			promise.resolve(nativePublicKeysFromSecretKeys(toHexString(contextSeed), fromReadableArray(secretKeys)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Pedersen commits
+	@ReactMethod
+	public void pedersenCommits(ReadableArray blinds, ReadableArray values, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native Pedersen commits
+			promise.resolve(nativePedersenCommits(toHexString(contextSeed), fromReadableArray(blinds), fromReadableArray(values)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Blind switches
+	@ReactMethod
+	public void blindSwitches(ReadableArray blinds, ReadableArray values, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native blind switches
+			promise.resolve(nativeBlindSwitches(toHexString(contextSeed), fromReadableArray(blinds), fromReadableArray(values)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Shared secret keys from secret key and public keys
+	@ReactMethod
+	public void sharedSecretKeysFromSecretKeyAndPublicKeys(String secretKey, ReadableArray publicKeys, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native shared secret keys from secret key and public keys
+			promise.resolve(nativeSharedSecretKeysFromSecretKeyAndPublicKeys(toHexString(contextSeed), secretKey, fromReadableArray(publicKeys)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Create commit accumulator
+	@ReactMethod
+	public void createCommitAccumulator(Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native create commit accumulator
+			promise.resolve((double)nativeCreateCommitAccumulator(toHexString(contextSeed)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Commit accumulator add
+	@ReactMethod
+	public void commitAccumulatorAdd(double accumulator, ReadableArray commits, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Native commit accumulator add
+			nativeCommitAccumulatorAdd(toHexString(contextSeed), (long)accumulator, fromReadableArray(commits));
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Commit accumulator subtract
+	@ReactMethod
+	public void commitAccumulatorSubtract(double accumulator, ReadableArray commits, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Native commit accumulator subtract
+			nativeCommitAccumulatorSubtract(toHexString(contextSeed), (long)accumulator, fromReadableArray(commits));
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Commit accumulator checkpoint
+	@ReactMethod
+	public void commitAccumulatorCheckpoint(double accumulator, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native commit accumulator checkpoint
+			promise.resolve((double)nativeCommitAccumulatorCheckpoint(toHexString(contextSeed), (long)accumulator));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Commit accumulator restore
+	@ReactMethod
+	public void commitAccumulatorRestore(double accumulator, double checkpoint, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Native commit accumulator restore
+			nativeCommitAccumulatorRestore(toHexString(contextSeed), (long)accumulator, (long)checkpoint);
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Commit accumulator total
+	@ReactMethod
+	public void commitAccumulatorTotal(double accumulator, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native commit accumulator total
+			promise.resolve(nativeCommitAccumulatorTotal(toHexString(contextSeed), (long)accumulator));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Destroy commit accumulator
+	@ReactMethod
+	public void destroyCommitAccumulator(double accumulator, Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Native destroy commit accumulator
+			nativeDestroyCommitAccumulator((long)accumulator);
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Multi scalar multiply
+	@ReactMethod
+	public void multiScalarMultiply(ReadableArray points, ReadableArray scalars, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native multi scalar multiply
+			promise.resolve(nativeMultiScalarMultiply(toHexString(contextSeed), fromReadableArray(points), fromReadableArray(scalars)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Scalar batch inverse
+	@ReactMethod
+	public void scalarBatchInverse(ReadableArray scalars, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native scalar batch inverse
+			promise.resolve(nativeScalarBatchInverse(toHexString(contextSeed), fromReadableArray(scalars)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Evaluate scalar program
+	@ReactMethod
+	public void evaluateScalarProgram(ReadableArray scalars, String program, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native evaluate scalar program
+			promise.resolve(nativeEvaluateScalarProgram(toHexString(contextSeed), fromReadableArray(scalars), program));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Execute commands
+	@ReactMethod
+	public void executeCommands(String commands, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native execute commands
+			promise.resolve(nativeExecuteCommands(toHexString(contextSeed), commands));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Set verification cache capacity
+	@ReactMethod
+	public void setVerificationCacheCapacity(double capacity, Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Native set verification cache capacity
+			nativeSetVerificationCacheCapacity((long)capacity);
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Get verification cache statistics
+	@ReactMethod
+	public void getVerificationCacheStatistics(Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Get statistics from native get verification cache statistics
+			long[] statistics = nativeGetVerificationCacheStatistics();
+			
+			// Initialize result
+			WritableMap result = Arguments.createMap();
+			
+			// Add statistics to result
+			result.putDouble("Hits", (double)statistics[0]);
+			result.putDouble("Misses", (double)statistics[1]);
+			result.putDouble("Entries", (double)statistics[2]);
+			
+			// Resolve promise to result
+			promise.resolve(result);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Set thread count
+	@ReactMethod
+	public void setThreadCount(double count, Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Native set thread count
+			nativeSetThreadCount((long)count);
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Open rewind cache
+	@ReactMethod
+	public void openRewindCache(String path, String key, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Resolve promise to native open rewind cache
+			promise.resolve((double)nativeOpenRewindCache(toHexString(contextSeed), path, key));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Rewind bulletproof with cache
+	@ReactMethod
+	public void rewindBulletproofWithCache(double cache, String proof, String commit, String nonce, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Get bulletproof data from native rewind bulletproof with cache
+			String[] bulletproofData = nativeRewindBulletproofWithCache(toHexString(contextSeed), (long)cache, proof, commit, nonce);
+			
+			// Initialize result
+			WritableMap result = Arguments.createMap();
+			
+			// Add bulletproof data to result
+			result.putString("Value", bulletproofData[0]);
+			result.putString("Blind", bulletproofData[1]);
+			result.putString("Message", bulletproofData[2]);
+			
+			// Resolve promise to result
+			promise.resolve(result);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Close rewind cache
+	@ReactMethod
+	public void closeRewindCache(double cache, Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Native close rewind cache
+			nativeCloseRewindCache((long)cache);
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Scan outputs
+	@ReactMethod
+	public void scanOutputs(String inputPath, double startOffset, String outputPath, String nonce, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Get scan result from native scan outputs
+			long[] scanResult = nativeScanOutputs(toHexString(contextSeed), inputPath, (long)startOffset, outputPath, nonce);
+			
+			// Initialize result
+			WritableMap result = Arguments.createMap();
+			
+			// Add scan result to result
+			result.putDouble("Offset", (double)scanResult[0]);
+			result.putDouble("Matches", (double)scanResult[1]);
+			
+			// Resolve promise to result
+			promise.resolve(result);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Aggregate transactions
+	@ReactMethod
+	public void aggregateTransactions(ReadableArray inputs, ReadableArray outputs, ReadableArray kernelExcesses, ReadableArray offsets, ReadableArray fees, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Get aggregate data from native aggregate transactions
+			String[] aggregateData = nativeAggregateTransactions(toHexString(contextSeed), fromReadableArray(inputs), fromReadableArray(outputs), fromReadableArray(kernelExcesses), fromReadableArray(offsets), fromReadableArray(fees));
+			
+			// Initialize result
+			WritableMap result = Arguments.createMap();
+			
+			// Add aggregate data to result
+			result.putString("Inputs", aggregateData[0]);
+			result.putString("Outputs", aggregateData[1]);
+			result.putString("Offset", aggregateData[2]);
+			
+			// Resolve promise to result
+			promise.resolve(result);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Validate block
+	@ReactMethod
+	public void validateBlock(ReadableArray inputs, ReadableArray outputs, ReadableArray proofs, ReadableArray kernelExcesses, ReadableArray signatures, ReadableArray messages, String offset, String reward, Promise promise) {
+
+		// Try
+		try {
+
+			// Initialize context seed
+			initializeContextSeed();
+			
+			// Get validation from native validate block
+			long[] validation = nativeValidateBlock(toHexString(contextSeed), fromReadableArray(inputs), fromReadableArray(outputs), fromReadableArray(proofs), fromReadableArray(kernelExcesses), fromReadableArray(signatures), fromReadableArray(messages), offset, reward);
+			
+			// Initialize result
+			WritableMap result = Arguments.createMap();
+			
+			// Add validation to result
+			result.putDouble("Result", (double)validation[0]);
+			result.putDouble("Index", (double)validation[1]);
+			
+			// Resolve promise to result
+			promise.resolve(result);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Get stats
+	@ReactMethod
+	public void getStats(Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Resolve promise to native get stats
+			promise.resolve(nativeGetStats());
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// Reset stats
+	@ReactMethod
+	public void resetStats(Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Native reset stats
+			nativeResetStats();
+			
+			// Resolve promise to true
+			promise.resolve(true);
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
+	// SHA-256 hashes
+	@ReactMethod
+	public void sha256Hashes(ReadableArray messages, Promise promise) {
+
+		// Try
+		try {
+
+			
+			// Resolve promise to native SHA-256 hashes
+			promise.resolve(nativeSha256Hashes(fromReadableArray(messages)));
+		}
+
+		// Catch errors
+		catch(Exception error) {
+
+			// Reject promise
+			promise.reject("Error", error);
+		}
+	}
+	
 	// Hex character length
 	private static final int HEX_CHARACTER_LENGTH = 2;
 	
@@ -884,6 +1868,129 @@ public class Secp256k1ZkpReactModule extends ReactContextBaseJavaModule {
 	// Native verify message hash signature
 	private static native boolean nativeVerifyMessageHashSignature(String contextSeed, String signature, String messageHash, String publicKey);
 	
+	// Native create bulletproof session
+	private static native long nativeCreateBulletproofSession(String contextSeed, String blind, String value, String commit, String nonce, String privateNonce, String extraCommit, String message);
+	
+	// Native bulletproof session round one
+	private static native String[] nativeBulletproofSessionRoundOne(String contextSeed, long session);
+	
+	// Native bulletproof session round two
+	private static native String nativeBulletproofSessionRoundTwo(String contextSeed, long session, String tOne, String tTwo);
+	
+	// Native bulletproof session finalize
+	private static native String nativeBulletproofSessionFinalize(String contextSeed, long session, String tauX);
+	
+	// Native destroy bulletproof session
+	private static native void nativeDestroyBulletproofSession(long session);
+	
+	// Native create aggsig session
+	private static native long nativeCreateAggsigSession(String contextSeed, String message, String publicKeyTotal, String publicNonceTotal);
+	
+	// Native aggsig session partial sign
+	private static native String nativeAggsigSessionPartialSign(String contextSeed, long session, String secretKey, String secretNonce);
+	
+	// Native aggsig session partial verify
+	private static native boolean nativeAggsigSessionPartialVerify(String contextSeed, long session, String signature, String publicKey);
+	
+	// Native aggsig session aggregate
+	private static native String nativeAggsigSessionAggregate(String contextSeed, long session, String[] signatures);
+	
+	// Native aggsig session verify
+	private static native boolean nativeAggsigSessionVerify(String contextSeed, long session, String signature);
+	
+	// Native destroy aggsig session
+	private static native void nativeDestroyAggsigSession(long session);
+	
+	// Native create nonce pair
+	private static native String[] nativeCreateNoncePair(String contextSeed);
+	
+	// Native derive child secret keys
+	private static native String nativeDeriveChildSecretKeys(String contextSeed, String secretKey, String chainCode, long startIndex, long numberOfIndices, boolean isHardened);
+	
+	// Native derive child public keys
+	private static native String nativeDeriveChildPublicKeys(String contextSeed, String publicKey, String chainCode, long startIndex, long numberOfIndices);
+	
+	// Native public keys from secret keys
+	private static native String nativePublicKeysFromSecretKeys(String contextSeed, String[] secretKeys);
+	
+	// Native Pedersen commits
+	private static native String nativePedersenCommits(String contextSeed, String[] blinds, String[] values);
+	
+	// Native blind switches
+	private static native String nativeBlindSwitches(String contextSeed, String[] blinds, String[] values);
+	
+	// Native shared secret keys from secret key and public keys
+	private static native String nativeSharedSecretKeysFromSecretKeyAndPublicKeys(String contextSeed, String secretKey, String[] publicKeys);
+	
+	// Native create commit accumulator
+	private static native long nativeCreateCommitAccumulator(String contextSeed);
+	
+	// Native commit accumulator add
+	private static native void nativeCommitAccumulatorAdd(String contextSeed, long accumulator, String[] commits);
+	
+	// Native commit accumulator subtract
+	private static native void nativeCommitAccumulatorSubtract(String contextSeed, long accumulator, String[] commits);
+	
+	// Native commit accumulator checkpoint
+	private static native long nativeCommitAccumulatorCheckpoint(String contextSeed, long accumulator);
+	
+	// Native commit accumulator restore
+	private static native void nativeCommitAccumulatorRestore(String contextSeed, long accumulator, long checkpoint);
+	
+	// Native commit accumulator total
+	private static native String nativeCommitAccumulatorTotal(String contextSeed, long accumulator);
+	
+	// Native destroy commit accumulator
+	private static native void nativeDestroyCommitAccumulator(long accumulator);
+	
+	// Native multi scalar multiply
+	private static native String nativeMultiScalarMultiply(String contextSeed, String[] points, String[] scalars);
+	
+	// Native scalar batch inverse
+	private static native String nativeScalarBatchInverse(String contextSeed, String[] scalars);
+	
+	// Native evaluate scalar program
+	private static native String nativeEvaluateScalarProgram(String contextSeed, String[] scalars, String program);
+	
+	// Native execute commands
+	private static native String nativeExecuteCommands(String contextSeed, String commands);
+	
+	// Native set verification cache capacity
+	private static native void nativeSetVerificationCacheCapacity(long capacity);
+	
+	// Native get verification cache statistics
+	private static native long[] nativeGetVerificationCacheStatistics();
+	
+	// Native set thread count
+	private static native void nativeSetThreadCount(long count);
+	
+	// Native open rewind cache
+	private static native long nativeOpenRewindCache(String contextSeed, String path, String key);
+	
+	// Native rewind bulletproof with cache
+	private static native String[] nativeRewindBulletproofWithCache(String contextSeed, long cache, String proof, String commit, String nonce);
+	
+	// Native close rewind cache
+	private static native void nativeCloseRewindCache(long cache);
+	
+	// Native scan outputs
+	private static native long[] nativeScanOutputs(String contextSeed, String inputPath, long startOffset, String outputPath, String nonce);
+	
+	// Native aggregate transactions
+	private static native String[] nativeAggregateTransactions(String contextSeed, String[] inputs, String[] outputs, String[] kernelExcesses, String[] offsets, String[] fees);
+	
+	// Native validate block
+	private static native long[] nativeValidateBlock(String contextSeed, String[] inputs, String[] outputs, String[] proofs, String[] kernelExcesses, String[] signatures, String[] messages, String offset, String reward);
+	
+	// Native get stats
+	private static native String nativeGetStats();
+	
+	// Native reset stats
+	private static native void nativeResetStats();
+	
+	// Native SHA-256 hashes
+	private static native String nativeSha256Hashes(String[] messages);
+	
 	// Native seed size
 	private static native int nativeSeedSize();
 	
@@ -0,0 +1,307 @@
+// Header files
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include "secp256k1-zkp-react.h"
+
+using namespace std;
+
+
+// Constants
+
+// Default number of iterations
+static const size_t DEFAULT_NUMBER_OF_ITERATIONS = 50;
+
+// Secret size
+static const size_t SECRET_SIZE = 32;
+
+// Bulletproof message size
+static const size_t BULLETPROOF_MESSAGE_SIZE = 20;
+
+// Bulletproof value
+static const char BULLETPROOF_VALUE[] = "123456789";
+
+// Single-signer message size
+static const size_t SINGLE_SIGNER_MESSAGE_SIZE = 32;
+
+// Number of known-answer items which is enough for batch operations to split them across threads
+static const size_t NUMBER_OF_KNOWN_ANSWER_ITEMS = 1000;
+
+
+// Function prototypes
+
+// Deterministic bytes
+static vector<uint8_t> deterministicBytes(size_t size, uint8_t tag);
+
+// Check batch operations
+static void checkBatchOperations(const vector<uint8_t> &contextSeed);
+
+// Benchmark create bulletproof
+static void benchmarkCreateBulletproof(const vector<uint8_t> &contextSeed, size_t numberOfIterations);
+
+// Benchmark verify and rewind bulletproof
+static void benchmarkVerifyAndRewindBulletproof(const vector<uint8_t> &contextSeed, size_t numberOfIterations);
+
+// Benchmark single-signer signatures
+static void benchmarkSingleSignerSignatures(const vector<uint8_t> &contextSeed, size_t numberOfIterations);
+
+// Measure latencies
+static void measureLatencies(const string &name, size_t numberOfIterations, const function<void()> &operation);
+
+// Print latencies
+static void printLatencies(const string &name, vector<double> &latencies);
+
+
+// Main function
+int main(int argc, char *argv[]) {
+
+	// Try
+	try {
+
+		// Get number of iterations from arguments
+		const size_t numberOfIterations = (argc > 1) ? strtoull(argv[1], nullptr, 10) : DEFAULT_NUMBER_OF_ITERATIONS;
+		if(!numberOfIterations) {
+
+			// Throw error
+			throw runtime_error("Number of iterations is invalid");
+		}
+
+		// Check if a trace file is provided
+		if(argc > 2) {
+
+			// Start trace
+			startTrace(argv[2]);
+		}
+
+		// Create context seed
+		const vector<uint8_t> contextSeed = deterministicBytes(seedSize(), 0);
+
+		// Check batch operations
+		checkBatchOperations(contextSeed);
+
+		// Benchmark create bulletproof
+		benchmarkCreateBulletproof(contextSeed, numberOfIterations);
+
+		// Benchmark verify and rewind bulletproof
+		benchmarkVerifyAndRewindBulletproof(contextSeed, numberOfIterations);
+
+		// Benchmark single-signer signatures
+		benchmarkSingleSignerSignatures(contextSeed, numberOfIterations);
+
+		// Stop trace
+		stopTrace();
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Display error
+		cerr << "Error: " << error.what() << endl;
+
+		// Return failure
+		return EXIT_FAILURE;
+	}
+
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+
+// Supporting function implementation
+
+// Deterministic bytes
+vector<uint8_t> deterministicBytes(size_t size, uint8_t tag) {
+
+	// Initialize result
+	vector<uint8_t> result(size);
+
+	// Go through all bytes in the result
+	for(size_t i = 0; i < size; ++i) {
+
+		// Set byte to a value derived from its index and the tag
+		result[i] = static_cast<uint8_t>((i * 31 + tag * 17 + 1) & 0x7F);
+	}
+
+	// Return result
+	return result;
+}
+
+// Check batch operations
+void checkBatchOperations(const vector<uint8_t> &contextSeed) {
+
+	// Go through all known-answer items
+	vector<uint8_t> secrets;
+	vector<size_t> secretsSizes;
+	vector<string> values;
+	vector<uint8_t> publicKeys;
+	vector<uint8_t> commits;
+	for(size_t i = 0; i < NUMBER_OF_KNOWN_ANSWER_ITEMS; ++i) {
+
+		// Create item's secret that's unique to its index and value that covers zero and the largest value
+		vector<uint8_t> secret = deterministicBytes(SECRET_SIZE, static_cast<uint8_t>(i));
+		secret[0] = static_cast<uint8_t>(i >> 8);
+		secret[1] = static_cast<uint8_t>(i);
+		const string value = (i == NUMBER_OF_KNOWN_ANSWER_ITEMS - 1) ? "18446744073709551615" : to_string(i * i * i * 1000003);
+
+		// Append item's per-item public key and commit to the expected results
+		const vector<uint8_t> publicKey = publicKeyFromSecretKey(contextSeed.data(), contextSeed.size(), secret.data(), secret.size());
+		const vector<uint8_t> commit = pedersenCommit(contextSeed.data(), contextSeed.size(), secret.data(), secret.size(), value.c_str());
+		publicKeys.insert(publicKeys.end(), publicKey.begin(), publicKey.end());
+		commits.insert(commits.end(), commit.begin(), commit.end());
+
+		// Append item's secret and value to the batch inputs
+		secrets.insert(secrets.end(), secret.begin(), secret.end());
+		secretsSizes.push_back(secret.size());
+		values.push_back(value);
+	}
+
+	// Check if batch public keys aren't the per-item public keys
+	if(publicKeysFromSecretKeys(contextSeed.data(), contextSeed.size(), secrets.data(), secretsSizes.data(), secretsSizes.size()) != publicKeys) {
+
+		// Throw error
+		throw runtime_error("Batch public keys aren't the per-item public keys");
+	}
+
+	// Check if batch commits aren't the per-item commits
+	vector<const char *> valuesPointers;
+	for(const string &value : values) {
+
+		// Append value's pointer to the values pointers
+		valuesPointers.push_back(value.c_str());
+	}
+	if(pedersenCommits(contextSeed.data(), contextSeed.size(), secrets.data(), secretsSizes.data(), valuesPointers.data(), valuesPointers.size()) != commits) {
+
+		// Throw error
+		throw runtime_error("Batch commits aren't the per-item commits");
+	}
+}
+
+// Benchmark create bulletproof
+void benchmarkCreateBulletproof(const vector<uint8_t> &contextSeed, size_t numberOfIterations) {
+
+	// Create inputs
+	const vector<uint8_t> blind = deterministicBytes(SECRET_SIZE, 1);
+	const vector<uint8_t> nonce = deterministicBytes(SECRET_SIZE, 2);
+	const vector<uint8_t> privateNonce = deterministicBytes(SECRET_SIZE, 3);
+	const vector<uint8_t> message(BULLETPROOF_MESSAGE_SIZE, 0);
+
+	// Create reference proof which also initializes secp256k1-zkp outside of the measurements
+	const vector<uint8_t> referenceProof = createBulletproof(contextSeed.data(), contextSeed.size(), blind.data(), blind.size(), BULLETPROOF_VALUE, nonce.data(), nonce.size(), privateNonce.data(), privateNonce.size(), nullptr, 0, message.data(), message.size());
+
+	// Measure creating proofs
+	measureLatencies("createBulletproof", numberOfIterations, [&]() {
+
+		// Check if proof isn't byte-identical to the reference proof
+		if(createBulletproof(contextSeed.data(), contextSeed.size(), blind.data(), blind.size(), BULLETPROOF_VALUE, nonce.data(), nonce.size(), privateNonce.data(), privateNonce.size(), nullptr, 0, message.data(), message.size()) != referenceProof) {
+
+			// Throw error
+			throw runtime_error("Proof isn't byte-identical to the reference proof");
+		}
+	});
+}
+
+// Benchmark verify and rewind bulletproof
+void benchmarkVerifyAndRewindBulletproof(const vector<uint8_t> &contextSeed, size_t numberOfIterations) {
+
+	// Create inputs
+	const vector<uint8_t> blind = deterministicBytes(SECRET_SIZE, 1);
+	const vector<uint8_t> nonce = deterministicBytes(SECRET_SIZE, 2);
+	const vector<uint8_t> privateNonce = deterministicBytes(SECRET_SIZE, 3);
+	const vector<uint8_t> message(BULLETPROOF_MESSAGE_SIZE, 0);
+
+	// Create proof and its commit
+	const vector<uint8_t> proof = createBulletproof(contextSeed.data(), contextSeed.size(), blind.data(), blind.size(), BULLETPROOF_VALUE, nonce.data(), nonce.size(), privateNonce.data(), privateNonce.size(), nullptr, 0, message.data(), message.size());
+	const vector<uint8_t> commit = pedersenCommit(contextSeed.data(), contextSeed.size(), blind.data(), blind.size(), BULLETPROOF_VALUE);
+
+	// Measure verifying proofs
+	measureLatencies("verifyBulletproof", numberOfIterations, [&]() {
+
+		// Check if proof isn't valid
+		if(!verifyBulletproof(contextSeed.data(), contextSeed.size(), proof.data(), proof.size(), commit.data(), commit.size(), nullptr, 0)) {
+
+			// Throw error
+			throw runtime_error("Proof isn't valid");
+		}
+	});
+
+	// Measure rewinding proofs
+	measureLatencies("rewindBulletproof", numberOfIterations, [&]() {
+
+		// Check if rewound value isn't the proof's value
+		if(get<0>(rewindBulletproof(contextSeed.data(), contextSeed.size(), proof.data(), proof.size(), commit.data(), commit.size(), nonce.data(), nonce.size())) != BULLETPROOF_VALUE) {
+
+			// Throw error
+			throw runtime_error("Rewound value isn't the proof's value");
+		}
+	});
+}
+
+// Benchmark single-signer signatures
+void benchmarkSingleSignerSignatures(const vector<uint8_t> &contextSeed, size_t numberOfIterations) {
+
+	// Create inputs
+	const vector<uint8_t> message = deterministicBytes(SINGLE_SIGNER_MESSAGE_SIZE, 4);
+	const vector<uint8_t> secretKey = deterministicBytes(SECRET_SIZE, 5);
+	const vector<uint8_t> seed = deterministicBytes(seedSize(), 6);
+	const vector<uint8_t> publicKey = publicKeyFromSecretKey(contextSeed.data(), contextSeed.size(), secretKey.data(), secretKey.size());
+
+	// Measure creating signatures
+	vector<uint8_t> signature;
+	measureLatencies("createSingleSignerSignature", numberOfIterations, [&]() {
+
+		// Create signature
+		signature = createSingleSignerSignature(contextSeed.data(), contextSeed.size(), message.data(), message.size(), secretKey.data(), secretKey.size(), nullptr, 0, publicKey.data(), publicKey.size(), nullptr, 0, nullptr, 0, seed.data(), seed.size());
+	});
+
+	// Measure verifying signatures
+	measureLatencies("verifySingleSignerSignature", numberOfIterations, [&]() {
+
+		// Check if signature isn't valid
+		if(!verifySingleSignerSignature(contextSeed.data(), contextSeed.size(), signature.data(), signature.size(), message.data(), message.size(), nullptr, 0, publicKey.data(), publicKey.size(), publicKey.data(), publicKey.size(), false)) {
+
+			// Throw error
+			throw runtime_error("Signature isn't valid");
+		}
+	});
+}
+
+// Measure latencies
+void measureLatencies(const string &name, size_t numberOfIterations, const function<void()> &operation) {
+
+	// Go through all iterations
+	vector<double> latencies;
+	for(size_t i = 0; i < numberOfIterations; ++i) {
+
+		// Perform operation and measure its latency
+		const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		operation();
+		latencies.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+	}
+
+	// Print latencies
+	printLatencies(name, latencies);
+}
+
+// Print latencies
+void printLatencies(const string &name, vector<double> &latencies) {
+
+	// Sort latencies
+	sort(latencies.begin(), latencies.end());
+
+	// Get total latency
+	double total = 0;
+	for(const double latency : latencies) {
+
+		// Add latency to total
+		total += latency;
+	}
+
+	// Display latencies
+	cout << name << ": iterations=" << latencies.size() << " mean=" << (total / latencies.size()) << "ms min=" << latencies.front() << "ms p50=" << latencies[latencies.size() / 2] << "ms p99=" << latencies[min(latencies.size() - 1, latencies.size() * 99 / 100)] << "ms max=" << latencies.back() << "ms" << endl;
+}
@@ -0,0 +1,39 @@
+#!/bin/sh
+# Builds the benchmark without and with LTO and PGO, gathers the profile that Android release builds are optimized with, reports the speed and size of each build, and checks that the profile matches the Android arm64 library
+set -e
+
+cd "$(dirname "$0")"
+ITERATIONS="${1:-50}"
+export CC="${CC:-clang}" CXX="${CXX:-clang++}"
+
+# Build baseline, LTO, and instrumented benchmarks
+cmake -S . -B build/baseline -D CMAKE_BUILD_TYPE=Release > /dev/null
+cmake -S . -B build/lto -D CMAKE_BUILD_TYPE=Release -D ENABLE_LTO=ON > /dev/null
+cmake -S . -B build/instrumented -D CMAKE_BUILD_TYPE=Release -D PGO_GENERATE=ON > /dev/null
+for BUILD in baseline lto instrumented; do
+	cmake --build "build/$BUILD" > /dev/null
+done
+
+# Run the sign, verify, prove, and rewind workload to gather a profile
+rm -f build/instrumented/*.profraw
+LLVM_PROFILE_FILE="build/instrumented/workload-%p.profraw" "build/instrumented/Secp256k1ZkpReactBenchmark" "$ITERATIONS" > /dev/null
+llvm-profdata merge -output="../android/secp256k1-zkp-react.profdata" build/instrumented/*.profraw
+
+# Build LTO and PGO benchmark with the profile
+cmake -S . -B build/lto-pgo -D CMAKE_BUILD_TYPE=Release -D ENABLE_LTO=ON -D PGO_PROFILE="$(pwd)/../android/secp256k1-zkp-react.profdata" > /dev/null
+cmake --build build/lto-pgo > /dev/null
+
+# Report each build's speed and size
+for BUILD in baseline lto lto-pgo; do
+	echo "$BUILD: $(wc -c < "build/$BUILD/Secp256k1ZkpReactBenchmark") bytes"
+	"build/$BUILD/Secp256k1ZkpReactBenchmark" "$ITERATIONS"
+done
+
+# Check that the profile matches the Android arm64 library's functions by building it with the profile and failing on out-of-date profile data if the Android NDK is available
+if [ -n "$ANDROID_NDK_HOME" ]; then
+	cmake -S ../android -B build/android-arm64 -D CMAKE_TOOLCHAIN_FILE="$ANDROID_NDK_HOME/build/cmake/android.toolchain.cmake" -D ANDROID_ABI=arm64-v8a -D ANDROID_PLATFORM=android-21 -D CMAKE_BUILD_TYPE=Release -D CMAKE_C_FLAGS=-Werror=profile-instr-out-of-date -D CMAKE_CXX_FLAGS=-Werror=profile-instr-out-of-date > /dev/null
+	cmake --build build/android-arm64 > /dev/null
+	echo "android-arm64: $(wc -c < "build/android-arm64/libSecp256k1ZkpReact.so") bytes, profile matches"
+else
+	echo "Skipped checking the profile against the Android arm64 library since ANDROID_NDK_HOME isn't set" >&2
+fi
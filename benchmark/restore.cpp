@@ -0,0 +1,655 @@
+// Header files
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "secp256k1-zkp-react.h"
+
+using namespace std;
+
+
+// Constants
+
+// Default number of outputs
+static const size_t DEFAULT_NUMBER_OF_OUTPUTS = 200;
+
+// Default owned percent
+static const size_t DEFAULT_OWNED_PERCENT = 10;
+
+// Secret size
+static const size_t SECRET_SIZE = 32;
+
+// Chain code size
+static const size_t CHAIN_CODE_SIZE = 32;
+
+// Bulletproof message size
+static const size_t BULLETPROOF_MESSAGE_SIZE = 20;
+
+// Minimum output value
+static const uint64_t MINIMUM_OUTPUT_VALUE = 1000000;
+
+// Restore stages
+static const char *RESTORE_STAGES[] = {"rewind", "derive", "commit", "verify"};
+
+// Number of restore stages
+static const size_t NUMBER_OF_RESTORE_STAGES = sizeof(RESTORE_STAGES) / sizeof(RESTORE_STAGES[0]);
+
+
+// Classes
+
+// Synthetic chain class
+class SyntheticChain {
+
+	// Public
+	public:
+
+		// Commits
+		vector<vector<uint8_t>> commits;
+
+		// Proofs
+		vector<vector<uint8_t>> proofs;
+
+		// Number of owned outputs
+		size_t numberOfOwnedOutputs;
+};
+
+// Wallet output class
+class WalletOutput {
+
+	// Public
+	public:
+
+		// Constructor
+		WalletOutput(size_t index, const string &value, uint32_t childIndex) :
+
+			// Set index to index
+			index(index),
+
+			// Set value to value
+			value(value),
+
+			// Set child index to child index
+			childIndex(childIndex)
+		{
+		}
+
+		// Index
+		size_t index;
+
+		// Value
+		string value;
+
+		// Child index
+		uint32_t childIndex;
+};
+
+
+// Function prototypes
+
+// Deterministic bytes
+static vector<uint8_t> deterministicBytes(size_t size, uint8_t tag);
+
+// Is owned output
+static bool isOwnedOutput(size_t index, size_t ownedPercent);
+
+// Output value
+static string outputValue(size_t index);
+
+// Generate chain
+static SyntheticChain generateChain(const vector<uint8_t> &contextSeed, size_t numberOfOutputs, size_t ownedPercent);
+
+// Restore
+static size_t restore(const vector<uint8_t> &contextSeed, const SyntheticChain &chain, size_t numberOfThreads, double stageLatencies[NUMBER_OF_RESTORE_STAGES]);
+
+// Restore in child process
+static size_t restoreInChildProcess(const vector<uint8_t> &contextSeed, const SyntheticChain &chain, size_t numberOfThreads, double stageLatencies[NUMBER_OF_RESTORE_STAGES], uint64_t &peakResidentSetSize);
+
+// Run in parallel
+static void runInParallel(size_t numberOfThreads, size_t numberOfItems, const function<void(size_t worker, size_t start, size_t end)> &body);
+
+// Get peak resident set size
+static uint64_t getPeakResidentSetSize();
+
+
+// Main function
+int main(int argc, char *argv[]) {
+
+	// Try
+	try {
+
+		// Get number of outputs from arguments
+		const size_t numberOfOutputs = (argc > 1) ? strtoull(argv[1], nullptr, 10) : DEFAULT_NUMBER_OF_OUTPUTS;
+		if(!numberOfOutputs) {
+
+			// Throw error
+			throw runtime_error("Number of outputs is invalid");
+		}
+
+		// Get owned percent from arguments
+		const size_t ownedPercent = (argc > 2) ? strtoull(argv[2], nullptr, 10) : DEFAULT_OWNED_PERCENT;
+		if(ownedPercent > 100) {
+
+			// Throw error
+			throw runtime_error("Owned percent is invalid");
+		}
+
+		// Get maximum number of threads from arguments
+		const size_t maximumNumberOfThreads = (argc > 3) ? strtoull(argv[3], nullptr, 10) : max<size_t>(thread::hardware_concurrency(), 1);
+		if(!maximumNumberOfThreads) {
+
+			// Throw error
+			throw runtime_error("Maximum number of threads is invalid");
+		}
+
+		// Create context seed
+		const vector<uint8_t> contextSeed = deterministicBytes(seedSize(), 0);
+
+		// Disable verification cache so that every restore verifies its proofs
+		setVerificationCacheCapacity(0);
+
+		// Generate chain
+		const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		const SyntheticChain chain = generateChain(contextSeed, numberOfOutputs, ownedPercent);
+		cout << "generate: outputs=" << numberOfOutputs << " owned=" << chain.numberOfOwnedOutputs << " time=" << chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() << "ms peakRss=" << getPeakResidentSetSize() << "KiB" << endl;
+
+		// Go through all numbers of threads
+		double singleThreadTotal = 0;
+		for(size_t numberOfThreads = 1; numberOfThreads <= maximumNumberOfThreads; numberOfThreads = (numberOfThreads == maximumNumberOfThreads) ? numberOfThreads + 1 : min(numberOfThreads * 2, maximumNumberOfThreads)) {
+
+			// Check if restore in a child process, so that its peak resident set size isn't shared with other numbers of threads, didn't find all owned outputs
+			double stageLatencies[NUMBER_OF_RESTORE_STAGES] = {};
+			uint64_t peakResidentSetSize;
+			if(restoreInChildProcess(contextSeed, chain, numberOfThreads, stageLatencies, peakResidentSetSize) != chain.numberOfOwnedOutputs) {
+
+				// Throw error
+				throw runtime_error("Restore didn't find all owned outputs");
+			}
+
+			// Get total latency
+			double total = 0;
+			for(const double latency : stageLatencies) {
+
+				// Add latency to total
+				total += latency;
+			}
+
+			// Check if using a single thread
+			if(numberOfThreads == 1) {
+
+				// Set single thread total to the total
+				singleThreadTotal = total;
+			}
+
+			// Display latencies
+			cout << "restore: threads=" << numberOfThreads << " total=" << total << "ms";
+			for(size_t i = 0; i < NUMBER_OF_RESTORE_STAGES; ++i) {
+
+				// Display stage's latency
+				cout << " " << RESTORE_STAGES[i] << "=" << stageLatencies[i] << "ms";
+			}
+			cout << " speedup=" << (singleThreadTotal / total) << "x peakRss=" << peakResidentSetSize << "KiB" << endl;
+		}
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Display error
+		cerr << "Error: " << error.what() << endl;
+
+		// Return failure
+		return EXIT_FAILURE;
+	}
+
+	// Return success
+	return EXIT_SUCCESS;
+}
+
+
+// Supporting function implementation
+
+// Deterministic bytes
+vector<uint8_t> deterministicBytes(size_t size, uint8_t tag) {
+
+	// Initialize result
+	vector<uint8_t> result(size);
+
+	// Go through all bytes in the result
+	for(size_t i = 0; i < size; ++i) {
+
+		// Set byte to a value derived from its index and the tag
+		result[i] = static_cast<uint8_t>((i * 31 + tag * 17 + 1) & 0x7F);
+	}
+
+	// Return result
+	return result;
+}
+
+// Is owned output
+bool isOwnedOutput(size_t index, size_t ownedPercent) {
+
+	// Return if the output is one of the evenly spread owned outputs
+	return index * ownedPercent % 100 < ownedPercent;
+}
+
+// Output value
+string outputValue(size_t index) {
+
+	// Return value derived from the index
+	return to_string(MINIMUM_OUTPUT_VALUE + index * 7919);
+}
+
+// Generate chain
+SyntheticChain generateChain(const vector<uint8_t> &contextSeed, size_t numberOfOutputs, size_t ownedPercent) {
+
+	// Create wallet and foreign keys
+	const vector<uint8_t> walletSecretKey = deterministicBytes(SECRET_SIZE, 1);
+	const vector<uint8_t> foreignSecretKey = deterministicBytes(SECRET_SIZE, 2);
+	const vector<uint8_t> chainCode = deterministicBytes(CHAIN_CODE_SIZE, 3);
+	const vector<uint8_t> walletNonce = deterministicBytes(SECRET_SIZE, 4);
+	const vector<uint8_t> foreignNonce = deterministicBytes(SECRET_SIZE, 5);
+	const vector<uint8_t> privateNonce = deterministicBytes(SECRET_SIZE, 6);
+
+	// Get number of owned outputs
+	SyntheticChain chain;
+	chain.numberOfOwnedOutputs = 0;
+	for(size_t i = 0; i < numberOfOutputs; ++i) {
+
+		// Check if output is owned
+		if(isOwnedOutput(i, ownedPercent)) {
+
+			// Increment number of owned outputs
+			++chain.numberOfOwnedOutputs;
+		}
+	}
+
+	// Derive wallet and foreign child keys
+	const SecureBytes walletChildKeys = chain.numberOfOwnedOutputs ? deriveChildSecretKeys(contextSeed.data(), contextSeed.size(), walletSecretKey.data(), walletSecretKey.size(), chainCode.data(), chainCode.size(), 0, chain.numberOfOwnedOutputs, false) : SecureBytes();
+	const SecureBytes foreignChildKeys = (numberOfOutputs - chain.numberOfOwnedOutputs) ? deriveChildSecretKeys(contextSeed.data(), contextSeed.size(), foreignSecretKey.data(), foreignSecretKey.size(), chainCode.data(), chainCode.size(), 0, numberOfOutputs - chain.numberOfOwnedOutputs, false) : SecureBytes();
+	const size_t childKeySize = walletChildKeys.empty() ? 0 : walletChildKeys.size() / chain.numberOfOwnedOutputs;
+	const size_t foreignChildKeySize = foreignChildKeys.empty() ? 0 : foreignChildKeys.size() / (numberOfOutputs - chain.numberOfOwnedOutputs);
+
+	// Go through all outputs
+	uint32_t childIndex = 0;
+	for(size_t i = 0; i < numberOfOutputs; ++i) {
+
+		// Get output's value
+		const string value = outputValue(i);
+
+		// Check if output is owned
+		if(isOwnedOutput(i, ownedPercent)) {
+
+			// Get blind from the output's child key
+			const SecureBytes blind = blindSwitch(contextSeed.data(), contextSeed.size(), &walletChildKeys[childIndex * childKeySize], SECRET_SIZE, value.c_str());
+
+			// Set message to the output's child index
+			vector<uint8_t> message(BULLETPROOF_MESSAGE_SIZE, 0);
+			for(size_t j = 0; j < sizeof(childIndex); ++j) {
+
+				// Set child index byte
+				message[sizeof(childIndex) - 1 - j] = childIndex >> (j * 8);
+			}
+
+			// Append commit and proof that the wallet can rewind to the chain
+			chain.commits.push_back(pedersenCommit(contextSeed.data(), contextSeed.size(), blind.data(), blind.size(), value.c_str()));
+			chain.proofs.push_back(createBulletproof(contextSeed.data(), contextSeed.size(), blind.data(), blind.size(), value.c_str(), walletNonce.data(), walletNonce.size(), privateNonce.data(), privateNonce.size(), nullptr, 0, message.data(), message.size()));
+
+			// Increment child index
+			++childIndex;
+		}
+
+		// Otherwise
+		else {
+
+			// Get blind from a foreign child key
+			const uint8_t *blind = &foreignChildKeys[(i - childIndex) * foreignChildKeySize];
+
+			// Append commit and proof that the wallet can't rewind to the chain
+			const vector<uint8_t> message(BULLETPROOF_MESSAGE_SIZE, 0);
+			chain.commits.push_back(pedersenCommit(contextSeed.data(), contextSeed.size(), blind, SECRET_SIZE, value.c_str()));
+			chain.proofs.push_back(createBulletproof(contextSeed.data(), contextSeed.size(), blind, SECRET_SIZE, value.c_str(), foreignNonce.data(), foreignNonce.size(), privateNonce.data(), privateNonce.size(), nullptr, 0, message.data(), message.size()));
+		}
+	}
+
+	// Return chain
+	return chain;
+}
+
+// Restore
+size_t restore(const vector<uint8_t> &contextSeed, const SyntheticChain &chain, size_t numberOfThreads, double stageLatencies[NUMBER_OF_RESTORE_STAGES]) {
+
+	// Create wallet's keys
+	const vector<uint8_t> walletSecretKey = deterministicBytes(SECRET_SIZE, 1);
+	const vector<uint8_t> chainCode = deterministicBytes(CHAIN_CODE_SIZE, 3);
+	const vector<uint8_t> walletNonce = deterministicBytes(SECRET_SIZE, 4);
+
+	// Limit the core's own parallel work to the number of threads so that each thread count is measured with only that many threads
+	setThreadCount(numberOfThreads);
+
+	// Rewind all outputs with the wallet's nonce
+	chrono::steady_clock::time_point stageStart = chrono::steady_clock::now();
+	vector<vector<WalletOutput>> workersOutputs(numberOfThreads);
+	runInParallel(numberOfThreads, chain.proofs.size(), [&](size_t worker, size_t start, size_t end) {
+
+		// Go through all of the worker's outputs
+		for(size_t i = start; i < end; ++i) {
+
+			// Try
+			try {
+
+				// Rewind output's proof
+				const tuple<string, SecureBytes, vector<uint8_t>> rewound = rewindBulletproof(contextSeed.data(), contextSeed.size(), chain.proofs[i].data(), chain.proofs[i].size(), chain.commits[i].data(), chain.commits[i].size(), walletNonce.data(), walletNonce.size());
+
+				// Get child index from the message
+				const vector<uint8_t> &message = get<2>(rewound);
+				uint32_t childIndex = 0;
+				for(size_t j = 0; j < sizeof(childIndex); ++j) {
+
+					// Add child index byte
+					childIndex = (childIndex << 8) | message[j];
+				}
+
+				// Append output to the worker's outputs
+				workersOutputs[worker].emplace_back(i, get<0>(rewound), childIndex);
+			}
+
+			// Catch errors
+			catch(const runtime_error &) {
+
+				// Output isn't owned by the wallet
+			}
+		}
+	});
+
+	// Go through all workers' outputs
+	vector<WalletOutput> outputs;
+	for(const vector<WalletOutput> &workerOutputs : workersOutputs) {
+
+		// Append worker's outputs to the outputs
+		outputs.insert(outputs.cend(), workerOutputs.cbegin(), workerOutputs.cend());
+	}
+	stageLatencies[0] = chrono::duration<double, milli>(chrono::steady_clock::now() - stageStart).count();
+
+	// Derive the outputs' blinds from their child keys
+	stageStart = chrono::steady_clock::now();
+	vector<SecureBytes> workersBlinds(numberOfThreads);
+	runInParallel(numberOfThreads, outputs.size(), [&](size_t worker, size_t start, size_t end) {
+
+		// Check if worker has no outputs
+		if(start == end) {
+
+			// Return
+			return;
+		}
+
+		// Go through all of the worker's outputs
+		vector<const char *> values(end - start);
+		for(size_t i = start; i < end; ++i) {
+
+			// Check if output's child index isn't in order
+			if(outputs[i].childIndex != i) {
+
+				// Throw error
+				throw runtime_error("Output's child index isn't in order");
+			}
+
+			// Set value
+			values[i - start] = outputs[i].value.c_str();
+		}
+
+		// Derive the worker's child keys
+		const SecureBytes childKeys = deriveChildSecretKeys(contextSeed.data(), contextSeed.size(), walletSecretKey.data(), walletSecretKey.size(), chainCode.data(), chainCode.size(), outputs[start].childIndex, end - start, false);
+		const size_t childKeySize = childKeys.size() / (end - start);
+
+		// Go through all child keys
+		SecureBytes secretKeys;
+		for(size_t i = 0; i < end - start; ++i) {
+
+			// Append child key's secret key to the secret keys
+			secretKeys.insert(secretKeys.cend(), &childKeys[i * childKeySize], &childKeys[i * childKeySize + SECRET_SIZE]);
+		}
+
+		// Get the worker's blinds
+		vector<size_t> secretKeysSizes(end - start, SECRET_SIZE);
+		workersBlinds[worker] = blindSwitches(contextSeed.data(), contextSeed.size(), secretKeys.data(), secretKeysSizes.data(), values.data(), end - start);
+	});
+	stageLatencies[1] = chrono::duration<double, milli>(chrono::steady_clock::now() - stageStart).count();
+
+	// Recompute the outputs' commits
+	stageStart = chrono::steady_clock::now();
+	runInParallel(numberOfThreads, outputs.size(), [&](size_t worker, size_t start, size_t end) {
+
+		// Check if worker has no outputs
+		if(start == end) {
+
+			// Return
+			return;
+		}
+
+		// Go through all of the worker's outputs
+		vector<const char *> values(end - start);
+		for(size_t i = start; i < end; ++i) {
+
+			// Set value
+			values[i - start] = outputs[i].value.c_str();
+		}
+
+		// Get the worker's commits
+		vector<size_t> blindsSizes(end - start, SECRET_SIZE);
+		const vector<uint8_t> commits = pedersenCommits(contextSeed.data(), contextSeed.size(), workersBlinds[worker].data(), blindsSizes.data(), values.data(), end - start);
+		const size_t commitSize = commits.size() / (end - start);
+
+		// Go through all of the worker's outputs
+		for(size_t i = start; i < end; ++i) {
+
+			// Check if recomputed commit isn't the output's commit
+			const vector<uint8_t> &commit = chain.commits[outputs[i].index];
+			if(commit.size() != commitSize || memcmp(commit.data(), &commits[(i - start) * commitSize], commitSize)) {
+
+				// Throw error
+				throw runtime_error("Recomputed commit isn't the output's commit");
+			}
+		}
+	});
+	stageLatencies[2] = chrono::duration<double, milli>(chrono::steady_clock::now() - stageStart).count();
+
+	// Verify the outputs' proofs
+	stageStart = chrono::steady_clock::now();
+	runInParallel(numberOfThreads, outputs.size(), [&](size_t, size_t start, size_t end) {
+
+		// Go through all of the worker's outputs
+		for(size_t i = start; i < end; ++i) {
+
+			// Check if output's proof isn't valid in the worker's own scratch space
+			if(!verifyBulletproof(contextSeed.data(), contextSeed.size(), chain.proofs[outputs[i].index].data(), chain.proofs[outputs[i].index].size(), chain.commits[outputs[i].index].data(), chain.commits[outputs[i].index].size(), nullptr, 0)) {
+
+				// Throw error
+				throw runtime_error("Output's proof isn't valid");
+			}
+		}
+	});
+	stageLatencies[3] = chrono::duration<double, milli>(chrono::steady_clock::now() - stageStart).count();
+
+	// Return number of outputs
+	return outputs.size();
+}
+
+// Restore in child process
+size_t restoreInChildProcess(const vector<uint8_t> &contextSeed, const SyntheticChain &chain, size_t numberOfThreads, double stageLatencies[NUMBER_OF_RESTORE_STAGES], uint64_t &peakResidentSetSize) {
+
+	// Check if creating pipe failed
+	int pipeFiles[2];
+	if(pipe(pipeFiles)) {
+
+		// Throw error
+		throw runtime_error("Creating pipe failed");
+	}
+
+	// Check if creating child process failed
+	cout.flush();
+	const pid_t child = fork();
+	if(child == -1) {
+
+		// Close pipe
+		close(pipeFiles[0]);
+		close(pipeFiles[1]);
+
+		// Throw error
+		throw runtime_error("Creating child process failed");
+	}
+
+	// Check if in the child process
+	if(!child) {
+
+		// Close pipe's read end
+		close(pipeFiles[0]);
+
+		// Try
+		try {
+
+			// Restore and get the child process's peak resident set size
+			uint64_t result[NUMBER_OF_RESTORE_STAGES + 2];
+			double latencies[NUMBER_OF_RESTORE_STAGES] = {};
+			result[0] = restore(contextSeed, chain, numberOfThreads, latencies);
+			result[1] = getPeakResidentSetSize();
+			memcpy(&result[2], latencies, sizeof(latencies));
+
+			// Check if writing result to the pipe failed
+			if(write(pipeFiles[1], result, sizeof(result)) != sizeof(result)) {
+
+				// Throw error
+				throw runtime_error("Writing to pipe failed");
+			}
+		}
+
+		// Catch errors
+		catch(const exception &error) {
+
+			// Display error
+			cerr << "Error: " << error.what() << endl;
+
+			// Exit with failure
+			_exit(EXIT_FAILURE);
+		}
+
+		// Exit with success
+		_exit(EXIT_SUCCESS);
+	}
+
+	// Close pipe's write end
+	close(pipeFiles[1]);
+
+	// Read child process's result from the pipe
+	uint64_t result[NUMBER_OF_RESTORE_STAGES + 2];
+	size_t bytesRead = 0;
+	while(bytesRead < sizeof(result)) {
+
+		// Check if reading from the pipe failed
+		const ssize_t size = read(pipeFiles[0], reinterpret_cast<uint8_t *>(result) + bytesRead, sizeof(result) - bytesRead);
+		if(size <= 0) {
+
+			// Break
+			break;
+		}
+
+		// Update bytes read
+		bytesRead += size;
+	}
+	close(pipeFiles[0]);
+
+	// Check if waiting for the child process failed or it failed
+	int status;
+	if(waitpid(child, &status, 0) != child || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS || bytesRead != sizeof(result)) {
+
+		// Throw error
+		throw runtime_error("Restore in child process failed");
+	}
+
+	// Set stage latencies and peak resident set size
+	memcpy(stageLatencies, &result[2], sizeof(double) * NUMBER_OF_RESTORE_STAGES);
+	peakResidentSetSize = result[1];
+
+	// Return number of outputs
+	return result[0];
+}
+
+// Run in parallel
+void runInParallel(size_t numberOfThreads, size_t numberOfItems, const function<void(size_t worker, size_t start, size_t end)> &body) {
+
+	// Go through all threads
+	vector<thread> threads;
+	vector<exception_ptr> errors(numberOfThreads);
+	for(size_t i = 0; i < numberOfThreads; ++i) {
+
+		// Start thread that performs body on its items
+		threads.emplace_back([&body, &errors, i, numberOfThreads, numberOfItems]() {
+
+			// Try
+			try {
+
+				// Perform body on items
+				body(i, numberOfItems * i / numberOfThreads, numberOfItems * (i + 1) / numberOfThreads);
+			}
+
+			// Catch errors
+			catch(...) {
+
+				// Save error
+				errors[i] = current_exception();
+			}
+		});
+	}
+
+	// Go through all threads
+	for(thread &worker : threads) {
+
+		// Wait for thread to finish
+		worker.join();
+	}
+
+	// Go through all errors
+	for(const exception_ptr &error : errors) {
+
+		// Check if error exists
+		if(error) {
+
+			// Throw error
+			rethrow_exception(error);
+		}
+	}
+}
+
+// Get peak resident set size
+uint64_t getPeakResidentSetSize() {
+
+	// Check if getting resource usage failed
+	struct rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage)) {
+
+		// Throw error
+		throw runtime_error("Getting resource usage failed");
+	}
+
+	// Check if using macOS
+	#ifdef __APPLE__
+
+		// Return peak resident set size which is in bytes
+		return usage.ru_maxrss / 1024;
+
+	// Otherwise
+	#else
+
+		// Return peak resident set size which is in kibibytes
+		return usage.ru_maxrss;
+	#endif
+}
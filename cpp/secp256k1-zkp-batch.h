@@ -0,0 +1,735 @@
+// Batch operations that are appended to secp256k1-zkp's secp256k1.c by prepublishOnly so that they can use the library's internal group and field functions
+
+
+// Constants
+
+// Pedersen value table window size
+#define PEDERSEN_VALUE_TABLE_WINDOW_SIZE 4
+
+// Pedersen value table number of windows
+#define PEDERSEN_VALUE_TABLE_NUMBER_OF_WINDOWS (64 / PEDERSEN_VALUE_TABLE_WINDOW_SIZE)
+
+// Pedersen value table number of digits
+#define PEDERSEN_VALUE_TABLE_NUMBER_OF_DIGITS (1 << PEDERSEN_VALUE_TABLE_WINDOW_SIZE)
+
+// Pedersen value table number of points which includes the offset that's added at the end
+#define PEDERSEN_VALUE_TABLE_NUMBER_OF_POINTS (PEDERSEN_VALUE_TABLE_NUMBER_OF_WINDOWS * PEDERSEN_VALUE_TABLE_NUMBER_OF_DIGITS + 1)
+
+// Batch scalar size
+#define BATCH_SCALAR_SIZE 32
+
+// Scalar program instruction size
+#define SCALAR_PROGRAM_INSTRUCTION_SIZE 5
+
+// Scalar program operations which match the native core's scalar operations
+#define SCALAR_PROGRAM_ADD 0
+#define SCALAR_PROGRAM_SUBTRACT 1
+#define SCALAR_PROGRAM_MULTIPLY 2
+#define SCALAR_PROGRAM_NEGATE 3
+#define SCALAR_PROGRAM_INVERSE 4
+
+
+// Structures
+
+// Multi scalar multiply data
+typedef struct {
+
+	// Context
+	const secp256k1_context *context;
+	
+	// Points
+	const secp256k1_pubkey * const *points;
+	
+	// Scalars
+	const unsigned char * const *scalars;
+} secp256k1_ecmult_multi_pubkeys_data;
+
+
+// Function prototypes
+
+// EC public key create batch
+int secp256k1_ec_pubkey_create_batch(const secp256k1_context *ctx, secp256k1_pubkey *pubkeys, const unsigned char * const *seckeys, size_t n);
+
+// EC public key tweak add batch
+int secp256k1_ec_pubkey_tweak_add_batch(const secp256k1_context *ctx, secp256k1_pubkey *pubkeys, const secp256k1_pubkey *pubkey, const unsigned char * const *tweaks, size_t n);
+
+// Pedersen value table size
+size_t secp256k1_pedersen_value_table_size(void);
+
+// Pedersen value table build
+void secp256k1_pedersen_value_table_build(unsigned char *table, const secp256k1_generator *value_gen);
+
+// Pedersen commit batch
+int secp256k1_pedersen_commit_batch(const secp256k1_context *ctx, secp256k1_pedersen_commitment *commits, const unsigned char * const *blinds, const uint64_t *values, size_t n, const unsigned char *table);
+
+// EC multi multiply public keys
+int secp256k1_ecmult_multi_pubkeys(const secp256k1_context *ctx, secp256k1_scratch_space *scratch, secp256k1_pubkey *result, int *is_infinity, const secp256k1_pubkey * const *points, const unsigned char * const *scalars, size_t n);
+
+// Scalar batch inverse
+int secp256k1_scalar_batch_inverse(unsigned char *results, const unsigned char * const *scalars, size_t n);
+
+// Scalar program evaluate
+int secp256k1_scalar_program_evaluate(unsigned char *registers, size_t n_inputs, const unsigned char *program, size_t n_instructions);
+
+// Aggsig sighash single
+int secp256k1_aggsig_sighash_single(const secp256k1_context *ctx, unsigned char *sighash32, const unsigned char *msg32, const secp256k1_pubkey *pubnonce, const secp256k1_pubkey *pubkey);
+
+// Aggsig sign single with sighash
+int secp256k1_aggsig_sign_single_with_sighash(const secp256k1_context *ctx, unsigned char *sig64, const unsigned char *sighash32, const unsigned char *seckey32, const unsigned char *secnonce32, const secp256k1_pubkey *pubnonce_total);
+
+// Aggsig verify single with sighash
+int secp256k1_aggsig_verify_single_with_sighash(const secp256k1_context *ctx, const unsigned char *sig64, const unsigned char *sighash32, const secp256k1_pubkey *pubkey, int is_partial);
+
+// Batch normalize
+static int secp256k1_batch_normalize(secp256k1_ge *results, const secp256k1_gej *points, size_t n);
+
+// EC multi multiply public keys callback
+static int secp256k1_ecmult_multi_pubkeys_callback(secp256k1_scalar *scalar, secp256k1_ge *point, size_t index, void *data);
+
+
+// Supporting function implementation
+
+// EC public key create batch
+int secp256k1_ec_pubkey_create_batch(const secp256k1_context *ctx, secp256k1_pubkey *pubkeys, const unsigned char * const *seckeys, size_t n) {
+
+	// Check if allocating memory for the points failed
+	secp256k1_gej *points = (secp256k1_gej *)malloc(n * sizeof(secp256k1_gej));
+	secp256k1_ge *results = (secp256k1_ge *)malloc(n * sizeof(secp256k1_ge));
+	if(!points || !results) {
+	
+		// Free memory
+		free(points);
+		free(results);
+		
+		// Return false
+		return 0;
+	}
+	
+	// Go through all secret keys
+	int result = 1;
+	size_t i;
+	for(i = 0; i < n && result; ++i) {
+	
+		// Check if secret key is invalid
+		secp256k1_scalar secret;
+		int overflow;
+		secp256k1_scalar_set_b32(&secret, seckeys[i], &overflow);
+		result = !overflow && !secp256k1_scalar_is_zero(&secret);
+		
+		// Multiply generator by the secret key without normalizing the result
+		secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &points[i], &secret);
+		secp256k1_scalar_clear(&secret);
+	}
+	
+	// Check if secret keys are valid and normalizing the points with one shared inversion was successful
+	if(result && secp256k1_batch_normalize(results, points, n)) {
+	
+		// Go through all results
+		for(i = 0; i < n; ++i) {
+		
+			// Save result as a public key
+			secp256k1_pubkey_save(&pubkeys[i], &results[i]);
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set result to false
+		result = 0;
+	}
+	
+	// Free memory
+	free(points);
+	free(results);
+	
+	// Return result
+	return result;
+}
+
+// EC public key tweak add batch
+int secp256k1_ec_pubkey_tweak_add_batch(const secp256k1_context *ctx, secp256k1_pubkey *pubkeys, const secp256k1_pubkey *pubkey, const unsigned char * const *tweaks, size_t n) {
+
+	// Check if loading public key failed
+	secp256k1_ge parent;
+	if(!secp256k1_pubkey_load(ctx, &parent, pubkey)) {
+	
+		// Return false
+		return 0;
+	}
+	
+	// Check if allocating memory for the points failed
+	secp256k1_gej *points = (secp256k1_gej *)malloc(n * sizeof(secp256k1_gej));
+	secp256k1_ge *results = (secp256k1_ge *)malloc(n * sizeof(secp256k1_ge));
+	if(!points || !results) {
+	
+		// Free memory
+		free(points);
+		free(results);
+		
+		// Return false
+		return 0;
+	}
+	
+	// Go through all tweaks
+	int result = 1;
+	size_t i;
+	for(i = 0; i < n && result; ++i) {
+	
+		// Check if tweak is invalid
+		secp256k1_scalar tweak;
+		int overflow;
+		secp256k1_scalar_set_b32(&tweak, tweaks[i], &overflow);
+		result = !overflow;
+		
+		// Add the generator multiplied by the tweak to the public key without normalizing the result
+		secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &points[i], &tweak);
+		secp256k1_gej_add_ge(&points[i], &points[i], &parent);
+		secp256k1_scalar_clear(&tweak);
+	}
+	
+	// Check if tweaks are valid and normalizing the points with one shared inversion was successful
+	if(result && secp256k1_batch_normalize(results, points, n)) {
+	
+		// Go through all results
+		for(i = 0; i < n; ++i) {
+		
+			// Save result as a public key
+			secp256k1_pubkey_save(&pubkeys[i], &results[i]);
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set result to false
+		result = 0;
+	}
+	
+	// Free memory
+	free(points);
+	free(results);
+	
+	// Return result
+	return result;
+}
+
+// Pedersen value table size
+size_t secp256k1_pedersen_value_table_size(void) {
+
+	// Return size of the table's points
+	return PEDERSEN_VALUE_TABLE_NUMBER_OF_POINTS * sizeof(secp256k1_ge_storage);
+}
+
+// Pedersen value table build
+void secp256k1_pedersen_value_table_build(unsigned char *table, const secp256k1_generator *value_gen) {
+
+	// Load value generator
+	secp256k1_ge generator;
+	secp256k1_generator_load(&generator, value_gen);
+	
+	// Go through all windows
+	secp256k1_gej points[PEDERSEN_VALUE_TABLE_NUMBER_OF_POINTS];
+	secp256k1_gej base;
+	secp256k1_gej offset;
+	secp256k1_gej_set_ge(&base, &generator);
+	secp256k1_gej_set_infinity(&offset);
+	size_t i;
+	for(i = 0; i < PEDERSEN_VALUE_TABLE_NUMBER_OF_WINDOWS; ++i) {
+	
+		// Go through all digits
+		secp256k1_gej point = base;
+		size_t j;
+		for(j = 0; j < PEDERSEN_VALUE_TABLE_NUMBER_OF_DIGITS; ++j) {
+		
+			// Set window's digit to the digit plus one times the window's base so that no entry is infinity
+			points[i * PEDERSEN_VALUE_TABLE_NUMBER_OF_DIGITS + j] = point;
+			secp256k1_gej_add_var(&point, &point, &base, NULL);
+		}
+		
+		// Include window's base in the offset and move base to the next window
+		secp256k1_gej_add_var(&offset, &offset, &base, NULL);
+		for(j = 0; j < PEDERSEN_VALUE_TABLE_WINDOW_SIZE; ++j) {
+		
+			// Double base
+			secp256k1_gej_double_var(&base, &base, NULL);
+		}
+	}
+	
+	// Set last point to the negated offset which cancels the extra base that each window adds
+	secp256k1_gej_neg(&points[PEDERSEN_VALUE_TABLE_NUMBER_OF_POINTS - 1], &offset);
+	
+	// Normalize points with one shared inversion
+	secp256k1_ge results[PEDERSEN_VALUE_TABLE_NUMBER_OF_POINTS];
+	secp256k1_batch_normalize(results, points, PEDERSEN_VALUE_TABLE_NUMBER_OF_POINTS);
+	
+	// Go through all points
+	for(i = 0; i < PEDERSEN_VALUE_TABLE_NUMBER_OF_POINTS; ++i) {
+	
+		// Store point in the table
+		secp256k1_ge_storage storage;
+		secp256k1_ge_to_storage(&storage, &results[i]);
+		memcpy(&table[i * sizeof(storage)], &storage, sizeof(storage));
+	}
+}
+
+// Pedersen commit batch
+int secp256k1_pedersen_commit_batch(const secp256k1_context *ctx, secp256k1_pedersen_commitment *commits, const unsigned char * const *blinds, const uint64_t *values, size_t n, const unsigned char *table) {
+
+	// Check if allocating memory for the points failed
+	secp256k1_gej *points = (secp256k1_gej *)malloc(n * sizeof(secp256k1_gej));
+	secp256k1_ge *results = (secp256k1_ge *)malloc(n * sizeof(secp256k1_ge));
+	if(!points || !results) {
+	
+		// Free memory
+		free(points);
+		free(results);
+		
+		// Return false
+		return 0;
+	}
+	
+	// Get table's points
+	const secp256k1_ge_storage *tablePoints = (const secp256k1_ge_storage *)table;
+	
+	// Go through all blinds and values
+	int result = 1;
+	size_t i;
+	for(i = 0; i < n && result; ++i) {
+	
+		// Check if blind is invalid
+		secp256k1_scalar blind;
+		int overflow;
+		secp256k1_scalar_set_b32(&blind, blinds[i], &overflow);
+		result = !overflow;
+		
+		// Multiply generator by the blind without normalizing the result
+		secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &points[i], &blind);
+		secp256k1_scalar_clear(&blind);
+		
+		// Go through all of the value's windows
+		secp256k1_ge_storage storage;
+		secp256k1_ge point;
+		size_t j;
+		for(j = 0; j < PEDERSEN_VALUE_TABLE_NUMBER_OF_WINDOWS; ++j) {
+		
+			// Select window's digit from the table without branching on the value
+			const unsigned int digit = (values[i] >> (j * PEDERSEN_VALUE_TABLE_WINDOW_SIZE)) & (PEDERSEN_VALUE_TABLE_NUMBER_OF_DIGITS - 1);
+			size_t k;
+			for(k = 0; k < PEDERSEN_VALUE_TABLE_NUMBER_OF_DIGITS; ++k) {
+			
+				// Select point if it's the digit's point
+				secp256k1_ge_storage_cmov(&storage, &tablePoints[j * PEDERSEN_VALUE_TABLE_NUMBER_OF_DIGITS + k], k == digit);
+			}
+			
+			// Add point to the commit
+			secp256k1_ge_from_storage(&point, &storage);
+			secp256k1_gej_add_ge(&points[i], &points[i], &point);
+		}
+		
+		// Add offset to the commit
+		secp256k1_ge_from_storage(&point, &tablePoints[PEDERSEN_VALUE_TABLE_NUMBER_OF_POINTS - 1]);
+		secp256k1_gej_add_ge(&points[i], &points[i], &point);
+		
+		// Clear selected point
+		memset(&storage, 0, sizeof(storage));
+		memset(&point, 0, sizeof(point));
+	}
+	
+	// Check if blinds are valid and normalizing the commits with one shared inversion was successful
+	if(result && secp256k1_batch_normalize(results, points, n)) {
+	
+		// Go through all results
+		for(i = 0; i < n; ++i) {
+		
+			// Save result as a commit
+			secp256k1_pedersen_commitment_save(&commits[i], &results[i]);
+		}
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set result to false
+		result = 0;
+	}
+	
+	// Clear and free memory
+	memset(points, 0, n * sizeof(secp256k1_gej));
+	memset(results, 0, n * sizeof(secp256k1_ge));
+	free(points);
+	free(results);
+	
+	// Return result
+	return result;
+}
+
+// EC multi multiply public keys
+int secp256k1_ecmult_multi_pubkeys(const secp256k1_context *ctx, secp256k1_scratch_space *scratch, secp256k1_pubkey *result, int *is_infinity, const secp256k1_pubkey * const *points, const unsigned char * const *scalars, size_t n) {
+
+	// Check if there's no points
+	if(!n) {
+	
+		// Set result to infinity
+		*is_infinity = 1;
+		
+		// Return true
+		return 1;
+	}
+	
+	// Check if performing multi multiply with Strauss or Pippenger's algorithm in the scratch space failed
+	secp256k1_ecmult_multi_pubkeys_data data;
+	data.context = ctx;
+	data.points = points;
+	data.scalars = scalars;
+	secp256k1_gej total;
+	if(!secp256k1_ecmult_multi_var(&ctx->ecmult_ctx, scratch, &total, NULL, secp256k1_ecmult_multi_pubkeys_callback, &data, n)) {
+	
+		// Return false
+		return 0;
+	}
+	
+	// Check if total is infinity
+	*is_infinity = secp256k1_gej_is_infinity(&total);
+	if(!*is_infinity) {
+	
+		// Save total as the result
+		secp256k1_ge totalPoint;
+		secp256k1_ge_set_gej_var(&totalPoint, &total);
+		secp256k1_pubkey_save(result, &totalPoint);
+	}
+	
+	// Return true
+	return 1;
+}
+
+// Scalar batch inverse
+int secp256k1_scalar_batch_inverse(unsigned char *results, const unsigned char * const *scalars, size_t n) {
+
+	// Go through all scalars
+	secp256k1_scalar product;
+	secp256k1_scalar scalar;
+	secp256k1_scalar_set_int(&product, 1);
+	int result = 1;
+	size_t i;
+	for(i = 0; i < n; ++i) {
+	
+		// Check if scalar is invalid or zero
+		int overflow;
+		secp256k1_scalar_set_b32(&scalar, scalars[i], &overflow);
+		result &= !overflow & !secp256k1_scalar_is_zero(&scalar);
+		
+		// Set scalar's result to the product of the previous scalars and include the scalar in the product
+		secp256k1_scalar_get_b32(&results[i * BATCH_SCALAR_SIZE], &product);
+		secp256k1_scalar_mul(&product, &product, &scalar);
+	}
+	
+	// Invert the product of all scalars once in constant time
+	secp256k1_scalar inverse;
+	secp256k1_scalar_inverse(&inverse, &product);
+	
+	// Go through all scalars backwards
+	for(i = n; i-- > 0;) {
+	
+		// Get scalar's inverse from the inverse and the product of the previous scalars and remove the scalar from the inverse
+		secp256k1_scalar previous;
+		int overflow;
+		secp256k1_scalar_set_b32(&previous, &results[i * BATCH_SCALAR_SIZE], &overflow);
+		secp256k1_scalar_set_b32(&scalar, scalars[i], &overflow);
+		secp256k1_scalar_mul(&previous, &previous, &inverse);
+		secp256k1_scalar_mul(&inverse, &inverse, &scalar);
+		
+		// Set scalar's result to its inverse
+		secp256k1_scalar_get_b32(&results[i * BATCH_SCALAR_SIZE], &previous);
+		secp256k1_scalar_clear(&previous);
+	}
+	
+	// Clear product, scalar, and inverse
+	secp256k1_scalar_clear(&product);
+	secp256k1_scalar_clear(&scalar);
+	secp256k1_scalar_clear(&inverse);
+	
+	// Return result
+	return result;
+}
+
+// Scalar program evaluate
+int secp256k1_scalar_program_evaluate(unsigned char *registers, size_t n_inputs, const unsigned char *program, size_t n_instructions) {
+
+	// Go through all instructions
+	int result = 1;
+	size_t i;
+	for(i = 0; i < n_instructions && result; ++i) {
+	
+		// Check if instruction's operands don't refer to previous registers
+		const unsigned char *instruction = &program[i * SCALAR_PROGRAM_INSTRUCTION_SIZE];
+		const size_t first_operand = ((size_t)instruction[1] << 8) | instruction[2];
+		const size_t second_operand = ((size_t)instruction[3] << 8) | instruction[4];
+		if(first_operand >= n_inputs + i || second_operand >= n_inputs + i) {
+		
+			// Return false
+			return 0;
+		}
+		
+		// Load operands
+		secp256k1_scalar first;
+		secp256k1_scalar second;
+		secp256k1_scalar value;
+		int overflow;
+		secp256k1_scalar_set_b32(&first, &registers[first_operand * BATCH_SCALAR_SIZE], &overflow);
+		secp256k1_scalar_set_b32(&second, &registers[second_operand * BATCH_SCALAR_SIZE], &overflow);
+		
+		// Check operation
+		switch(instruction[0]) {
+		
+			// Add
+			case SCALAR_PROGRAM_ADD:
+			
+				// Set value to the sum of the operands
+				secp256k1_scalar_add(&value, &first, &second);
+				
+				// Break
+				break;
+			
+			// Subtract
+			case SCALAR_PROGRAM_SUBTRACT:
+			
+				// Set value to the difference of the operands
+				secp256k1_scalar_negate(&value, &second);
+				secp256k1_scalar_add(&value, &first, &value);
+				
+				// Break
+				break;
+			
+			// Multiply
+			case SCALAR_PROGRAM_MULTIPLY:
+			
+				// Set value to the product of the operands without branching on either being zero
+				secp256k1_scalar_mul(&value, &first, &second);
+				
+				// Break
+				break;
+			
+			// Negate
+			case SCALAR_PROGRAM_NEGATE:
+			
+				// Set value to the negation of the first operand
+				secp256k1_scalar_negate(&value, &first);
+				
+				// Break
+				break;
+			
+			// Inverse
+			case SCALAR_PROGRAM_INVERSE:
+			
+				// Set value to the inverse of the first operand in constant time and fail if it's zero
+				result = !secp256k1_scalar_is_zero(&first);
+				secp256k1_scalar_inverse(&value, &first);
+				
+				// Break
+				break;
+			
+			// Default
+			default:
+			
+				// Clear operands
+				secp256k1_scalar_clear(&first);
+				secp256k1_scalar_clear(&second);
+				
+				// Return false
+				return 0;
+		}
+		
+		// Set instruction's register to the value
+		secp256k1_scalar_get_b32(&registers[(n_inputs + i) * BATCH_SCALAR_SIZE], &value);
+		
+		// Clear operands and value
+		secp256k1_scalar_clear(&first);
+		secp256k1_scalar_clear(&second);
+		secp256k1_scalar_clear(&value);
+	}
+	
+	// Return result
+	return result;
+}
+
+// Aggsig sighash single
+int secp256k1_aggsig_sighash_single(const secp256k1_context *ctx, unsigned char *sighash32, const unsigned char *msg32, const secp256k1_pubkey *pubnonce, const secp256k1_pubkey *pubkey) {
+
+	// Check if computing the sighash with the aggsig module failed
+	secp256k1_scalar sighash;
+	if(!secp256k1_compute_sighash_single(ctx, &sighash, pubnonce, pubkey, msg32)) {
+	
+		// Return false
+		return 0;
+	}
+	
+	// Set result to the sighash
+	secp256k1_scalar_get_b32(sighash32, &sighash);
+	
+	// Return true
+	return 1;
+}
+
+// Aggsig sign single with sighash
+int secp256k1_aggsig_sign_single_with_sighash(const secp256k1_context *ctx, unsigned char *sig64, const unsigned char *sighash32, const unsigned char *seckey32, const unsigned char *secnonce32, const secp256k1_pubkey *pubnonce_total) {
+
+	// Check if sighash, secret key, secret nonce, or public nonce total are invalid
+	secp256k1_scalar sighash;
+	secp256k1_scalar secret;
+	secp256k1_scalar nonce;
+	secp256k1_ge total;
+	int overflow;
+	secp256k1_scalar_set_b32(&sighash, sighash32, &overflow);
+	int result = !overflow;
+	secp256k1_scalar_set_b32(&secret, seckey32, &overflow);
+	result &= !overflow;
+	secp256k1_scalar_set_b32(&nonce, secnonce32, &overflow);
+	result &= !overflow && !secp256k1_scalar_is_zero(&nonce);
+	if(result && secp256k1_pubkey_load(ctx, &total, pubnonce_total)) {
+	
+		// Set signature's nonce to the x coordinate of the secret nonce times the generator
+		secp256k1_gej noncePointJacobian;
+		secp256k1_ge noncePoint;
+		secp256k1_ecmult_gen(&ctx->ecmult_gen_ctx, &noncePointJacobian, &nonce);
+		secp256k1_ge_set_gej(&noncePoint, &noncePointJacobian);
+		secp256k1_fe_normalize(&noncePoint.x);
+		secp256k1_fe_get_b32(sig64, &noncePoint.x);
+		
+		// Negate secret nonce if the public nonce total's y coordinate isn't a quadratic residue
+		if(!secp256k1_fe_is_quad_var(&total.y)) {
+		
+			// Negate secret nonce
+			secp256k1_scalar_negate(&nonce, &nonce);
+		}
+		
+		// Set signature's scalar to the secret nonce plus the secret key times the sighash
+		secp256k1_scalar_mul(&secret, &secret, &sighash);
+		secp256k1_scalar_add(&secret, &secret, &nonce);
+		secp256k1_scalar_get_b32(&sig64[32], &secret);
+	}
+	
+	// Otherwise
+	else {
+	
+		// Set result to false
+		result = 0;
+	}
+	
+	// Clear secret key and secret nonce
+	secp256k1_scalar_clear(&secret);
+	secp256k1_scalar_clear(&nonce);
+	
+	// Return result
+	return result;
+}
+
+// Aggsig verify single with sighash
+int secp256k1_aggsig_verify_single_with_sighash(const secp256k1_context *ctx, const unsigned char *sig64, const unsigned char *sighash32, const secp256k1_pubkey *pubkey, int is_partial) {
+
+	// Check if sighash, signature, or public key are invalid
+	secp256k1_scalar sighash;
+	secp256k1_scalar scalar;
+	secp256k1_fe x;
+	secp256k1_ge publicKey;
+	int sighashOverflow;
+	int scalarOverflow;
+	secp256k1_scalar_set_b32(&sighash, sighash32, &sighashOverflow);
+	secp256k1_scalar_set_b32(&scalar, &sig64[32], &scalarOverflow);
+	if(sighashOverflow || scalarOverflow || !secp256k1_fe_set_b32(&x, sig64) || !secp256k1_pubkey_load(ctx, &publicKey, pubkey)) {
+	
+		// Return false
+		return 0;
+	}
+	
+	// Get the signature's scalar times the generator minus the sighash times the public key
+	secp256k1_gej publicKeyJacobian;
+	secp256k1_gej nonce;
+	secp256k1_gej_set_ge(&publicKeyJacobian, &publicKey);
+	secp256k1_scalar_negate(&sighash, &sighash);
+	secp256k1_ecmult(&ctx->ecmult_ctx, &nonce, &publicKeyJacobian, &sighash, &scalar);
+	
+	// Check if the nonce is infinity or if it's not partial and its y coordinate isn't a quadratic residue
+	if(secp256k1_gej_is_infinity(&nonce) || (!is_partial && !secp256k1_gej_has_quad_y_var(&nonce))) {
+	
+		// Return false
+		return 0;
+	}
+	
+	// Return if the nonce's x coordinate is the signature's nonce
+	return secp256k1_gej_eq_x_var(&x, &nonce);
+}
+
+// Batch normalize
+int secp256k1_batch_normalize(secp256k1_ge *results, const secp256k1_gej *points, size_t n) {
+
+	// Check if there's no points
+	if(!n) {
+	
+		// Return true
+		return 1;
+	}
+	
+	// Go through all points
+	size_t i;
+	for(i = 0; i < n; ++i) {
+	
+		// Check if point is infinity
+		if(secp256k1_gej_is_infinity(&points[i])) {
+		
+			// Return false
+			return 0;
+		}
+		
+		// Set result's x to the product of all Z coordinates up to the point
+		if(i) {
+		
+			// Multiply previous product by the point's Z coordinate
+			secp256k1_fe_mul(&results[i].x, &results[i - 1].x, &points[i].z);
+		}
+		else {
+		
+			// Set product to the point's Z coordinate
+			results[i].x = points[i].z;
+		}
+	}
+	
+	// Invert the product of all Z coordinates once in constant time
+	secp256k1_fe inverse;
+	secp256k1_fe_inv(&inverse, &results[n - 1].x);
+	
+	// Go through all points backwards
+	for(i = n - 1; i > 0; --i) {
+	
+		// Get point's Z coordinate inverse from the inverse and the previous product and remove the point's Z coordinate from the inverse
+		secp256k1_fe zInverse;
+		secp256k1_fe_mul(&zInverse, &inverse, &results[i - 1].x);
+		secp256k1_fe_mul(&inverse, &inverse, &points[i].z);
+		
+		// Set result to the affine point
+		secp256k1_ge_set_gej_zinv(&results[i], &points[i], &zInverse);
+	}
+	
+	// Set first result to the affine point
+	secp256k1_ge_set_gej_zinv(&results[0], &points[0], &inverse);
+	
+	// Return true
+	return 1;
+}
+
+// EC multi multiply public keys callback
+int secp256k1_ecmult_multi_pubkeys_callback(secp256k1_scalar *scalar, secp256k1_ge *point, size_t index, void *data) {
+
+	// Check if scalar is invalid
+	const secp256k1_ecmult_multi_pubkeys_data *multiplyData = (const secp256k1_ecmult_multi_pubkeys_data *)data;
+	int overflow;
+	secp256k1_scalar_set_b32(scalar, multiplyData->scalars[index], &overflow);
+	if(overflow) {
+	
+		// Return false
+		return 0;
+	}
+	
+	// Return loading point
+	return secp256k1_pubkey_load(multiplyData->context, point, multiplyData->points[index]);
+}
@@ -1,686 +1,7207 @@
 // Header files
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #include "./secp256k1-zkp-react.h"
 
+// Check if x86-64
+#ifdef __x86_64__
+
+	// Header files
+	#include <cpuid.h>
+	#include <immintrin.h>
+#endif
+
+// Check if ARM64 and the compiler can target SHA-2 instructions in individual functions
+#if defined(__aarch64__) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO) || !defined(__clang__) || __clang_major__ >= 16)
+
+	// Use ARM64 SHA-256
+	#define USE_ARM64_SHA256
+	
+	// Header files
+	#include <arm_neon.h>
+	
+	// Check if Linux
+	#ifdef __linux__
+	
+		// Header files
+		#include <sys/auxv.h>
+	#endif
+	
+	// Check if using Clang
+	#ifdef __clang__
+	
+		// ARM64 SHA-256 target
+		#define ARM64_SHA256_TARGET __attribute__((target("crypto")))
+	
+	// Otherwise
+	#else
+	
+		// ARM64 SHA-256 target
+		#define ARM64_SHA256_TARGET __attribute__((target("+crypto")))
+	#endif
+#endif
+
 using namespace std;
 
 
-// Secp256k1-zkp namespace
-namespace Secp256k1Zkp {
+// Secp256k1-zkp namespace
+namespace Secp256k1Zkp {
+
+	// Header files
+	#include "../Secp256k1-zkp-NPM-Package-master/main.cpp"
+	
+	// Batch operations that prepublishOnly appends to secp256k1-zkp
+	extern "C" {
+	
+		// EC public key create batch
+		int secp256k1_ec_pubkey_create_batch(const secp256k1_context *ctx, secp256k1_pubkey *pubkeys, const unsigned char * const *seckeys, size_t n);
+		
+		// EC public key tweak add batch
+		int secp256k1_ec_pubkey_tweak_add_batch(const secp256k1_context *ctx, secp256k1_pubkey *pubkeys, const secp256k1_pubkey *pubkey, const unsigned char * const *tweaks, size_t n);
+		
+		// Pedersen value table size
+		size_t secp256k1_pedersen_value_table_size(void);
+		
+		// Pedersen value table build
+		void secp256k1_pedersen_value_table_build(unsigned char *table, const secp256k1_generator *value_gen);
+		
+		// Pedersen commit batch
+		int secp256k1_pedersen_commit_batch(const secp256k1_context *ctx, secp256k1_pedersen_commitment *commits, const unsigned char * const *blinds, const uint64_t *values, size_t n, const unsigned char *table);
+		
+		// EC multi multiply public keys
+		int secp256k1_ecmult_multi_pubkeys(const secp256k1_context *ctx, secp256k1_scratch_space *scratch, secp256k1_pubkey *result, int *is_infinity, const secp256k1_pubkey * const *points, const unsigned char * const *scalars, size_t n);
+		
+		// Scalar batch inverse
+		int secp256k1_scalar_batch_inverse(unsigned char *results, const unsigned char * const *scalars, size_t n);
+		
+		// Scalar program evaluate
+		int secp256k1_scalar_program_evaluate(unsigned char *registers, size_t n_inputs, const unsigned char *program, size_t n_instructions);
+		
+		// Aggsig sighash single
+		int secp256k1_aggsig_sighash_single(const secp256k1_context *ctx, unsigned char *sighash32, const unsigned char *msg32, const secp256k1_pubkey *pubnonce, const secp256k1_pubkey *pubkey);
+		
+		// Aggsig sign single with sighash
+		int secp256k1_aggsig_sign_single_with_sighash(const secp256k1_context *ctx, unsigned char *sig64, const unsigned char *sighash32, const unsigned char *seckey32, const unsigned char *secnonce32, const secp256k1_pubkey *pubnonce_total);
+		
+		// Aggsig verify single with sighash
+		int secp256k1_aggsig_verify_single_with_sighash(const secp256k1_context *ctx, const unsigned char *sig64, const unsigned char *sighash32, const secp256k1_pubkey *pubkey, int is_partial);
+	}
+}
+
+
+// Constants
+
+// Max 64-bit integer string length
+static const size_t MAX_64_BIT_INTEGER_STRING_LENGTH = sizeof("18446744073709551615");
+
+// Bulletproof number of bits
+static const size_t BULLETPROOF_NUMBER_OF_BITS = 64;
+
+// No session
+static const uint64_t NO_SESSION = 0;
+
+// Single-signer message size
+static const size_t SINGLE_SIGNER_MESSAGE_SIZE = 32;
+
+// Nonce pool size
+static const size_t NONCE_POOL_SIZE = 16;
+
+// Sum chunk size
+static const size_t SUM_CHUNK_SIZE = 1024;
+
+// Minimum items per thread
+static const size_t MINIMUM_ITEMS_PER_THREAD = 64;
+
+// SHA-512 block size
+static const size_t SHA512_BLOCK_SIZE = 128;
+
+// SHA-512 digest size
+static const size_t SHA512_DIGEST_SIZE = 64;
+
+// SHA-512 round constants
+static const uint64_t SHA512_ROUND_CONSTANTS[] = {
+	0x428A2F98D728AE22, 0x7137449123EF65CD, 0xB5C0FBCFEC4D3B2F, 0xE9B5DBA58189DBBC, 0x3956C25BF348B538, 0x59F111F1B605D019, 0x923F82A4AF194F9B, 0xAB1C5ED5DA6D8118,
+	0xD807AA98A3030242, 0x12835B0145706FBE, 0x243185BE4EE4B28C, 0x550C7DC3D5FFB4E2, 0x72BE5D74F27B896F, 0x80DEB1FE3B1696B1, 0x9BDC06A725C71235, 0xC19BF174CF692694,
+	0xE49B69C19EF14AD2, 0xEFBE4786384F25E3, 0x0FC19DC68B8CD5B5, 0x240CA1CC77AC9C65, 0x2DE92C6F592B0275, 0x4A7484AA6EA6E483, 0x5CB0A9DCBD41FBD4, 0x76F988DA831153B5,
+	0x983E5152EE66DFAB, 0xA831C66D2DB43210, 0xB00327C898FB213F, 0xBF597FC7BEEF0EE4, 0xC6E00BF33DA88FC2, 0xD5A79147930AA725, 0x06CA6351E003826F, 0x142929670A0E6E70,
+	0x27B70A8546D22FFC, 0x2E1B21385C26C926, 0x4D2C6DFC5AC42AED, 0x53380D139D95B3DF, 0x650A73548BAF63DE, 0x766A0ABB3C77B2A8, 0x81C2C92E47EDAEE6, 0x92722C851482353B,
+	0xA2BFE8A14CF10364, 0xA81A664BBC423001, 0xC24B8B70D0F89791, 0xC76C51A30654BE30, 0xD192E819D6EF5218, 0xD69906245565A910, 0xF40E35855771202A, 0x106AA07032BBD1B8,
+	0x19A4C116B8D2D0C8, 0x1E376C085141AB53, 0x2748774CDF8EEB99, 0x34B0BCB5E19B48A8, 0x391C0CB3C5C95A63, 0x4ED8AA4AE3418ACB, 0x5B9CCA4F7763E373, 0x682E6FF3D6B2B8A3,
+	0x748F82EE5DEFB2FC, 0x78A5636F43172F60, 0x84C87814A1F0AB72, 0x8CC702081A6439EC, 0x90BEFFFA23631E28, 0xA4506CEBDE82BDE9, 0xBEF9A3F7B2C67915, 0xC67178F2E372532B,
+	0xCA273ECEEA26619C, 0xD186B8C721C0C207, 0xEADA7DD6CDE0EB1E, 0xF57D4F7FEE6ED178, 0x06F067AA72176FBA, 0x0A637DC5A2C898A6, 0x113F9804BEF90DAE, 0x1B710B35131C471B,
+	0x28DB77F523047D84, 0x32CAAB7B40C72493, 0x3C9EBE0A15C9BEBC, 0x431D67C49C100D4C, 0x4CC5D4BECB3E42B6, 0x597F299CFC657E2A, 0x5FCB6FAB3AD6FAEC, 0x6C44198C4A475817
+};
+
+// SHA-512 initial state
+static const uint64_t SHA512_INITIAL_STATE[] = {
+	0x6A09E667F3BCC908, 0xBB67AE8584CAA73B, 0x3C6EF372FE94F82B, 0xA54FF53A5F1D36F1, 0x510E527FADE682D1, 0x9B05688C2B3E6C1F, 0x1F83D9ABFB41BD6B, 0x5BE0CD19137E2179
+};
+
+// SHA-256 block size
+static const size_t SHA256_BLOCK_SIZE = 64;
+
+// SHA-256 digest size
+static const size_t SHA256_DIGEST_SIZE = 32;
+
+// SHA-256 round constants
+alignas(16) static const uint32_t SHA256_ROUND_CONSTANTS[] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+// SHA-256 initial state
+static const uint32_t SHA256_INITIAL_STATE[] = {
+	0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+// SHA-256 number of lanes
+static const size_t SHA256_NUMBER_OF_LANES = 8;
+
+// Check if using ARM64 SHA-256 on Linux
+#if defined(USE_ARM64_SHA256) && defined(__linux__)
+
+	// ARM64 hardware capability SHA-2
+	static const unsigned long ARM64_HWCAP_SHA2 = 1 << 6;
+#endif
+
+// Chain code size
+static const size_t CHAIN_CODE_SIZE = 32;
+
+// Hardened index
+static const uint32_t HARDENED_INDEX = 0x80000000;
+
+// Scalar size
+static const size_t SCALAR_SIZE = 32;
+
+// Scalar order
+static const uint8_t SCALAR_ORDER[] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+	0xBA, 0xAE, 0xDC, 0xE6, 0xAF, 0x48, 0xA0, 0x3B, 0xBF, 0xD2, 0x5E, 0x8C, 0xD0, 0x36, 0x41, 0x41
+};
+
+// Scalar instruction size
+static const size_t SCALAR_INSTRUCTION_SIZE = 5;
+
+// Scalar operation
+enum class ScalarOperation : uint8_t {
+
+	// Add
+	ADD,
+	
+	// Subtract
+	SUBTRACT,
+	
+	// Multiply
+	MULTIPLY,
+	
+	// Negate
+	NEGATE,
+	
+	// Inverse
+	INVERSE
+};
+
+// Secure arena size
+static const size_t SECURE_ARENA_SIZE = 16 * 1024;
+
+// Secure arena chunk size
+static const size_t SECURE_ARENA_CHUNK_SIZE = 32;
+
+// Maximum number of secure arenas
+static const size_t MAXIMUM_NUMBER_OF_SECURE_ARENAS = 1024;
+
+// ChaCha20 key size
+static const size_t CHACHA20_KEY_SIZE = 32;
+
+// ChaCha20 nonce size
+static const size_t CHACHA20_NONCE_SIZE = 12;
+
+// ChaCha20 block size
+static const size_t CHACHA20_BLOCK_SIZE = 64;
+
+// Rewind cache magic
+static const uint8_t REWIND_CACHE_MAGIC[] = {'R', 'W', 'C', 'A', 'C', 'H', 'E', '1'};
+
+// Rewind cache header size
+static const size_t REWIND_CACHE_HEADER_SIZE = sizeof(REWIND_CACHE_MAGIC) + sizeof(uint64_t);
+
+// Rewind cache tag size
+static const size_t REWIND_CACHE_TAG_SIZE = 16;
+
+// Rewind cache MAC size
+static const size_t REWIND_CACHE_MAC_SIZE = 16;
+
+// Rewind cache initial capacity
+static const size_t REWIND_CACHE_INITIAL_CAPACITY = 256;
+
+// Scan proof size size
+static const size_t SCAN_PROOF_SIZE_SIZE = sizeof(uint32_t);
+
+// Scan batch size
+static const size_t SCAN_BATCH_SIZE = 1024;
+
+// Block validation proofs per batch
+static const size_t BLOCK_VALIDATION_PROOFS_PER_BATCH = 16;
+
+// Block validation kernels per task
+static const size_t BLOCK_VALIDATION_KERNELS_PER_TASK = 64;
+
+// Block validation scratch space size
+static const size_t BLOCK_VALIDATION_SCRATCH_SPACE_SIZE = 8 * 1024 * 1024;
+
+// Multi scalar multiply scratch space size
+static const size_t MULTI_SCALAR_MULTIPLY_SCRATCH_SPACE_SIZE = 1024 * 1024;
+
+// Bulletproof verification scratch space size
+static const size_t BULLETPROOF_VERIFICATION_SCRATCH_SPACE_SIZE = 1024 * 1024;
+
+// Block validation result
+enum class BlockValidationResult : uint8_t {
+
+	// Valid
+	VALID,
+	
+	// Invalid input
+	INVALID_INPUT,
+	
+	// Invalid output
+	INVALID_OUTPUT,
+	
+	// Invalid kernel excess
+	INVALID_KERNEL_EXCESS,
+	
+	// Invalid proof
+	INVALID_PROOF,
+	
+	// Invalid signature
+	INVALID_SIGNATURE,
+	
+	// Unbalanced
+	UNBALANCED
+};
+
+// Verification type
+enum class VerificationType : uint8_t {
+
+	// Bulletproof
+	BULLETPROOF,
+	
+	// Single-signer signature
+	SINGLE_SIGNER_SIGNATURE
+};
+
+// Command argument size
+static const size_t COMMAND_ARGUMENT_SIZE_SIZE = sizeof(uint32_t);
+
+// Command argument type
+enum class CommandArgumentType : uint8_t {
+
+	// Data
+	DATA,
+	
+	// Reference
+	REFERENCE
+};
+
+// Commands
+#define COMMANDS \
+	COMMAND(IS_VALID_SECRET_KEY, isValidSecretKey) \
+	COMMAND(IS_VALID_PUBLIC_KEY, isValidPublicKey) \
+	COMMAND(IS_VALID_COMMIT, isValidCommit) \
+	COMMAND(IS_VALID_SINGLE_SIGNER_SIGNATURE, isValidSingleSignerSignature) \
+	COMMAND(PUBLIC_KEY_FROM_SECRET_KEY, publicKeyFromSecretKey) \
+	COMMAND(PUBLIC_KEY_FROM_DATA, publicKeyFromData) \
+	COMMAND(UNCOMPRESS_PUBLIC_KEY, uncompressPublicKey) \
+	COMMAND(SECRET_KEY_TWEAK_ADD, secretKeyTweakAdd) \
+	COMMAND(PUBLIC_KEY_TWEAK_ADD, publicKeyTweakAdd) \
+	COMMAND(SECRET_KEY_TWEAK_MULTIPLY, secretKeyTweakMultiply) \
+	COMMAND(PUBLIC_KEY_TWEAK_MULTIPLY, publicKeyTweakMultiply) \
+	COMMAND(SHARED_SECRET_KEY_FROM_SECRET_KEY_AND_PUBLIC_KEY, sharedSecretKeyFromSecretKeyAndPublicKey) \
+	COMMAND(PEDERSEN_COMMIT, pedersenCommit) \
+	COMMAND(BLIND_SWITCH, blindSwitch) \
+	COMMAND(PEDERSEN_COMMIT_TO_PUBLIC_KEY, pedersenCommitToPublicKey) \
+	COMMAND(PUBLIC_KEY_TO_PEDERSEN_COMMIT, publicKeyToPedersenCommit) \
+	COMMAND(SINGLE_SIGNER_SIGNATURE_FROM_DATA, singleSignerSignatureFromData) \
+	COMMAND(COMPACT_SINGLE_SIGNER_SIGNATURE, compactSingleSignerSignature) \
+	COMMAND(UNCOMPACT_SINGLE_SIGNER_SIGNATURE, uncompactSingleSignerSignature) \
+	COMMAND(CREATE_MESSAGE_HASH_SIGNATURE, createMessageHashSignature) \
+	COMMAND(VERIFY_MESSAGE_HASH_SIGNATURE, verifyMessageHashSignature)
+
+// Command operation
+#define COMMAND(operation, function) operation,
+enum class CommandOperation : uint8_t {
+
+	// Commands
+	COMMANDS
+	
+	// Number of commands
+	NUMBER_OF_COMMANDS
+};
+#undef COMMAND
+
+// Check if tracing is enabled
+#ifdef ENABLE_TRACING
+
+	// Trace buffer size
+	static const size_t TRACE_BUFFER_SIZE = 64 * 1024;
+#endif
+
+// Check if operation stats are enabled
+#ifdef ENABLE_OPERATION_STATS
+
+	// Number of latency buckets
+	static const size_t NUMBER_OF_LATENCY_BUCKETS = sizeof(uint64_t) * CHAR_BIT + 1;
+	
+	// Operations
+	#define OPERATIONS \
+		OPERATION(BLIND_SWITCH, blindSwitch) \
+		OPERATION(BLIND_SUM, blindSum) \
+		OPERATION(IS_VALID_SECRET_KEY, isValidSecretKey) \
+		OPERATION(IS_VALID_PUBLIC_KEY, isValidPublicKey) \
+		OPERATION(IS_VALID_COMMIT, isValidCommit) \
+		OPERATION(IS_VALID_SINGLE_SIGNER_SIGNATURE, isValidSingleSignerSignature) \
+		OPERATION(CREATE_BULLETPROOF, createBulletproof) \
+		OPERATION(CREATE_BULLETPROOF_BLINDLESS, createBulletproofBlindless) \
+		OPERATION(REWIND_BULLETPROOF, rewindBulletproof) \
+		OPERATION(VERIFY_BULLETPROOF, verifyBulletproof) \
+		OPERATION(PUBLIC_KEY_FROM_SECRET_KEY, publicKeyFromSecretKey) \
+		OPERATION(PUBLIC_KEY_FROM_DATA, publicKeyFromData) \
+		OPERATION(UNCOMPRESS_PUBLIC_KEY, uncompressPublicKey) \
+		OPERATION(SECRET_KEY_TWEAK_ADD, secretKeyTweakAdd) \
+		OPERATION(PUBLIC_KEY_TWEAK_ADD, publicKeyTweakAdd) \
+		OPERATION(SECRET_KEY_TWEAK_MULTIPLY, secretKeyTweakMultiply) \
+		OPERATION(PUBLIC_KEY_TWEAK_MULTIPLY, publicKeyTweakMultiply) \
+		OPERATION(SHARED_SECRET_KEY_FROM_SECRET_KEY_AND_PUBLIC_KEY, sharedSecretKeyFromSecretKeyAndPublicKey) \
+		OPERATION(PEDERSEN_COMMIT, pedersenCommit) \
+		OPERATION(PEDERSEN_COMMIT_SUM, pedersenCommitSum) \
+		OPERATION(PEDERSEN_COMMIT_TO_PUBLIC_KEY, pedersenCommitToPublicKey) \
+		OPERATION(PUBLIC_KEY_TO_PEDERSEN_COMMIT, publicKeyToPedersenCommit) \
+		OPERATION(CREATE_SINGLE_SIGNER_SIGNATURE, createSingleSignerSignature) \
+		OPERATION(ADD_SINGLE_SIGNER_SIGNATURES, addSingleSignerSignatures) \
+		OPERATION(VERIFY_SINGLE_SIGNER_SIGNATURE, verifySingleSignerSignature) \
+		OPERATION(SINGLE_SIGNER_SIGNATURE_FROM_DATA, singleSignerSignatureFromData) \
+		OPERATION(COMPACT_SINGLE_SIGNER_SIGNATURE, compactSingleSignerSignature) \
+		OPERATION(UNCOMPACT_SINGLE_SIGNER_SIGNATURE, uncompactSingleSignerSignature) \
+		OPERATION(COMBINE_PUBLIC_KEYS, combinePublicKeys) \
+		OPERATION(CREATE_SECRET_NONCE, createSecretNonce) \
+		OPERATION(CREATE_MESSAGE_HASH_SIGNATURE, createMessageHashSignature) \
+		OPERATION(VERIFY_MESSAGE_HASH_SIGNATURE, verifyMessageHashSignature) \
+		OPERATION(CREATE_BULLETPROOF_SESSION, createBulletproofSession) \
+		OPERATION(BULLETPROOF_SESSION_ROUND_ONE, bulletproofSessionRoundOne) \
+		OPERATION(BULLETPROOF_SESSION_ROUND_TWO, bulletproofSessionRoundTwo) \
+		OPERATION(BULLETPROOF_SESSION_FINALIZE, bulletproofSessionFinalize) \
+		OPERATION(CREATE_AGGSIG_SESSION, createAggsigSession) \
+		OPERATION(AGGSIG_SESSION_PARTIAL_SIGN, aggsigSessionPartialSign) \
+		OPERATION(AGGSIG_SESSION_PARTIAL_VERIFY, aggsigSessionPartialVerify) \
+		OPERATION(AGGSIG_SESSION_AGGREGATE, aggsigSessionAggregate) \
+		OPERATION(AGGSIG_SESSION_VERIFY, aggsigSessionVerify) \
+		OPERATION(CREATE_NONCE_PAIR, createNoncePair) \
+		OPERATION(PUBLIC_KEYS_FROM_SECRET_KEYS, publicKeysFromSecretKeys) \
+		OPERATION(PEDERSEN_COMMITS, pedersenCommits) \
+		OPERATION(BLIND_SWITCHES, blindSwitches) \
+		OPERATION(SHARED_SECRET_KEYS_FROM_SECRET_KEY_AND_PUBLIC_KEYS, sharedSecretKeysFromSecretKeyAndPublicKeys) \
+		OPERATION(DERIVE_CHILD_SECRET_KEYS, deriveChildSecretKeys) \
+		OPERATION(DERIVE_CHILD_PUBLIC_KEYS, deriveChildPublicKeys) \
+		OPERATION(CREATE_COMMIT_ACCUMULATOR, createCommitAccumulator) \
+		OPERATION(COMMIT_ACCUMULATOR_ADD, commitAccumulatorAdd) \
+		OPERATION(COMMIT_ACCUMULATOR_SUBTRACT, commitAccumulatorSubtract) \
+		OPERATION(COMMIT_ACCUMULATOR_CHECKPOINT, commitAccumulatorCheckpoint) \
+		OPERATION(COMMIT_ACCUMULATOR_RESTORE, commitAccumulatorRestore) \
+		OPERATION(COMMIT_ACCUMULATOR_TOTAL, commitAccumulatorTotal) \
+		OPERATION(MULTI_SCALAR_MULTIPLY, multiScalarMultiply) \
+		OPERATION(SCALAR_BATCH_INVERSE, scalarBatchInverse) \
+		OPERATION(EVALUATE_SCALAR_PROGRAM, evaluateScalarProgram) \
+		OPERATION(EXECUTE_COMMANDS, executeCommands) \
+		OPERATION(OPEN_REWIND_CACHE, openRewindCache) \
+		OPERATION(REWIND_BULLETPROOF_WITH_CACHE, rewindBulletproofWithCache) \
+		OPERATION(SCAN_OUTPUTS, scanOutputs) \
+		OPERATION(AGGREGATE_TRANSACTIONS, aggregateTransactions) \
+		OPERATION(VALIDATE_BLOCK, validateBlock) \
+		OPERATION(SHA256_HASHES, sha256Hashes)
+	
+	// Operation
+	#define OPERATION(operation, function) operation,
+	enum class Operation : uint8_t {
+	
+		// Operations
+		OPERATIONS
+		
+		// Number of operations
+		NUMBER_OF_OPERATIONS
+	};
+	#undef OPERATION
+	
+	// Track operation
+	#define TRACK_OPERATION(operation, bytesIn) TRACE_SPAN(__func__); const OperationTracker operationTracker(operationStats[static_cast<size_t>(Operation::operation)], bytesIn)
+	
+	// Track result
+	#define TRACK_RESULT(result) operationTracker.trackResult(move(result))
+
+// Otherwise
+#else
+
+	// Track operation
+	#define TRACK_OPERATION(operation, bytesIn) TRACE_SPAN(__func__)
+	
+	// Track result
+	#define TRACK_RESULT(result) result
+#endif
+
+
+// Types
+
+// SHA-256 transform function
+typedef void (*Sha256TransformFunction)(uint32_t *state, const uint8_t *blocks, size_t numberOfBlocks);
+
+// SHA-256 lanes transform function
+typedef void (*Sha256LanesTransformFunction)(uint32_t states[][SHA256_NUMBER_OF_LANES], const uint8_t *const blocks[]);
+
+
+// Function prototypes
+
+// Initialize
+static void initialize(const uint8_t *seed, size_t seedSize);
+
+// Value from string
+static uint64_t valueFromString(const char *value);
+
+// Get Pedersen value table
+static vector<uint8_t> getPedersenValueTable();
+
+// Is aggsig with sighash compatible
+static bool isAggsigWithSighashCompatible();
+
+// Clear memory
+static void clearMemory(void *memory, size_t size);
+
+// Get secure arenas memory
+static uint8_t *getSecureArenasMemory();
+
+// Random bytes
+static void randomBytes(uint8_t *result, size_t size);
+
+// Get pointers
+static vector<const uint8_t *> getPointers(const uint8_t *data, const size_t sizes[], size_t numberOfItems);
+
+// Parallel for
+static void parallelFor(size_t numberOfItems, const function<void(size_t start, size_t end)> &body);
+
+// Get number of threads
+static size_t getNumberOfThreads();
+
+// Verify bulletproof in thread scratch space
+static bool verifyBulletproofInThreadScratchSpace(const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *extraCommit, size_t extraCommitSize);
+
+// Run tasks
+static void runTasks(size_t numberOfTasks, const function<bool(size_t task, size_t worker)> &body, size_t &numberOfWorkers);
+
+// HMAC-SHA512
+static void hmacSha512(uint8_t *result, const uint8_t *key, size_t keySize, const uint8_t *data, size_t dataSize);
+
+// Scalar is valid
+static bool scalarIsValid(const uint8_t *scalar, size_t scalarSize);
+
+// Scalar is zero
+static bool scalarIsZero(const uint8_t *scalar);
+
+// Scalar sum
+static void scalarSum(uint8_t *result, const uint8_t *const *scalars, size_t numberOfScalars, size_t numberOfPositiveScalars);
+
+// SipHash
+static uint64_t sipHash(const uint64_t key[2], const uint8_t *data, size_t dataSize);
+
+// Invoke command
+static SecureBytes invokeCommand(vector<uint8_t> (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments);
+static SecureBytes invokeCommand(vector<uint8_t> (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const uint8_t *second, size_t secondSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments);
+static SecureBytes invokeCommand(vector<uint8_t> (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const char *value), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments);
+static SecureBytes invokeCommand(SecureBytes (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const uint8_t *second, size_t secondSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments);
+static SecureBytes invokeCommand(SecureBytes (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const char *value), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments);
+static SecureBytes invokeCommand(bool (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments);
+static SecureBytes invokeCommand(bool (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const uint8_t *second, size_t secondSize, const uint8_t *third, size_t thirdSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments);
+
+// Write all
+static void writeAll(int file, const uint8_t *data, size_t size);
+
+// Check if tracing is enabled
+#ifdef ENABLE_TRACING
+
+	// Get thread ID
+	static uint64_t getThreadId();
+	
+	// Get trace timestamp
+	static uint64_t getTraceTimestamp();
+#endif
+
+// SHA-256 transform which replaces secp256k1-zkp's portable SHA-256 transform
+extern "C" void secp256k1_sha256_transform(uint32_t *state, const uint32_t *chunk);
+
+// Rotate right
+static uint32_t rotateRight(uint32_t value, unsigned int amount);
+
+// SHA-256 transform portable
+static void sha256TransformPortable(uint32_t *state, const uint8_t *blocks, size_t numberOfBlocks);
+
+// Check if x86-64
+#ifdef __x86_64__
+
+	// SHA-256 transform SHA-NI
+	__attribute__((target("sha,sse4.1,ssse3"))) static void sha256TransformShaNi(uint32_t *state, const uint8_t *blocks, size_t numberOfBlocks);
+	
+	// Rotate right lanes
+	__attribute__((target("avx2"))) static __m256i rotateRightLanes(__m256i value, int amount);
+	
+	// SHA-256 transform lanes AVX2
+	__attribute__((target("avx2"))) static void sha256TransformLanesAvx2(uint32_t states[][SHA256_NUMBER_OF_LANES], const uint8_t *const blocks[]);
+#endif
+
+// Check if using ARM64 SHA-256
+#ifdef USE_ARM64_SHA256
+
+	// SHA-256 transform ARM64
+	ARM64_SHA256_TARGET static void sha256TransformArm64(uint32_t *state, const uint8_t *blocks, size_t numberOfBlocks);
+#endif
+
+// Get SHA-256 transform
+static Sha256TransformFunction getSha256Transform();
+
+// Get SHA-256 lanes transform
+static Sha256LanesTransformFunction getSha256LanesTransform();
+
+// SHA-256 pad
+static size_t sha256Pad(uint8_t *result, const uint8_t *message, size_t messageSize);
+
+// ChaCha20
+static void chaCha20(uint8_t *result, const uint8_t *data, size_t dataSize, const uint8_t *key, const uint8_t *nonce);
+
+// Accumulate commits
+static void accumulateCommits(Secp256k1Zkp::secp256k1_pedersen_commitment &total, bool &totalIsInfinity, const uint8_t *commits, size_t commitsSizes[], size_t numberOfCommits, bool isPositive);
+
+
+// Classes
+
+// SHA-512 class
+class Sha512 {
+
+	// Public
+	public:
+	
+		// Constructor
+		Sha512() :
+		
+			// Set buffer size to zero
+			bufferSize(0),
+			
+			// Set length to zero
+			length(0)
+		{
+		
+			// Set state to the initial state
+			memcpy(state, SHA512_INITIAL_STATE, sizeof(state));
+		}
+		
+		// Destructor
+		~Sha512() {
+		
+			// Clear state and buffer
+			clearMemory(state, sizeof(state));
+			clearMemory(buffer, sizeof(buffer));
+		}
+		
+		// Update
+		void update(const uint8_t *data, size_t dataSize) {
+		
+			// Update length
+			length += dataSize;
+			
+			// Go through all data
+			while(dataSize) {
+			
+				// Append data to the buffer
+				const size_t amount = min(dataSize, SHA512_BLOCK_SIZE - bufferSize);
+				memcpy(&buffer[bufferSize], data, amount);
+				bufferSize += amount;
+				data += amount;
+				dataSize -= amount;
+				
+				// Check if buffer is full
+				if(bufferSize == SHA512_BLOCK_SIZE) {
+				
+					// Process buffer
+					processBlock(buffer);
+					bufferSize = 0;
+				}
+			}
+		}
+		
+		// Finalize
+		void finalize(uint8_t *result) {
+		
+			// Get length in bits
+			const uint64_t lengthInBits = length * 8;
+			
+			// Append padding to the buffer
+			static const uint8_t PADDING[SHA512_BLOCK_SIZE] = {0x80};
+			update(PADDING, ((bufferSize < SHA512_BLOCK_SIZE - 16) ? SHA512_BLOCK_SIZE - 16 : SHA512_BLOCK_SIZE * 2 - 16) - bufferSize);
+			
+			// Append length to the buffer as a 128-bit big endian value
+			uint8_t lengthBytes[16] = {};
+			for(size_t i = 0; i < sizeof(lengthInBits); ++i) {
+			
+				// Set length byte
+				lengthBytes[sizeof(lengthBytes) - 1 - i] = lengthInBits >> (i * 8);
+			}
+			update(lengthBytes, sizeof(lengthBytes));
+			
+			// Go through all state words
+			for(size_t i = 0; i < sizeof(state) / sizeof(state[0]); ++i) {
+			
+				// Go through all bytes in the state word
+				for(size_t j = 0; j < sizeof(state[0]); ++j) {
+				
+					// Set result byte to the state word's big endian byte
+					result[i * sizeof(state[0]) + j] = state[i] >> ((sizeof(state[0]) - 1 - j) * 8);
+				}
+			}
+		}
+	
+	// Private
+	private:
+	
+		// Rotate right
+		static uint64_t rotateRight(uint64_t value, unsigned int amount) {
+		
+			// Return value rotated right by amount
+			return (value >> amount) | (value << (64 - amount));
+		}
+		
+		// Process block
+		void processBlock(const uint8_t *block) {
+		
+			// Go through all words in the block
+			uint64_t words[80];
+			for(size_t i = 0; i < 16; ++i) {
+			
+				// Set word to the block's big endian word
+				words[i] = 0;
+				for(size_t j = 0; j < sizeof(words[0]); ++j) {
+				
+					// Append byte to word
+					words[i] = (words[i] << 8) | block[i * sizeof(words[0]) + j];
+				}
+			}
+			
+			// Go through all remaining words
+			for(size_t i = 16; i < 80; ++i) {
+			
+				// Set word from previous words
+				words[i] = words[i - 16] + (rotateRight(words[i - 15], 1) ^ rotateRight(words[i - 15], 8) ^ (words[i - 15] >> 7)) + words[i - 7] + (rotateRight(words[i - 2], 19) ^ rotateRight(words[i - 2], 61) ^ (words[i - 2] >> 6));
+			}
+			
+			// Initialize working variables to the state
+			uint64_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7];
+			
+			// Go through all rounds
+			for(size_t i = 0; i < 80; ++i) {
+			
+				// Perform round
+				const uint64_t temporaryOne = h + (rotateRight(e, 14) ^ rotateRight(e, 18) ^ rotateRight(e, 41)) + ((e & f) ^ (~e & g)) + SHA512_ROUND_CONSTANTS[i] + words[i];
+				const uint64_t temporaryTwo = (rotateRight(a, 28) ^ rotateRight(a, 34) ^ rotateRight(a, 39)) + ((a & b) ^ (a & c) ^ (b & c));
+				h = g;
+				g = f;
+				f = e;
+				e = d + temporaryOne;
+				d = c;
+				c = b;
+				b = a;
+				a = temporaryOne + temporaryTwo;
+			}
+			
+			// Add working variables to the state
+			state[0] += a;
+			state[1] += b;
+			state[2] += c;
+			state[3] += d;
+			state[4] += e;
+			state[5] += f;
+			state[6] += g;
+			state[7] += h;
+			
+			// Clear words
+			clearMemory(words, sizeof(words));
+		}
+		
+		// State
+		uint64_t state[8];
+		
+		// Buffer
+		uint8_t buffer[SHA512_BLOCK_SIZE];
+		
+		// Buffer size
+		size_t bufferSize;
+		
+		// Length
+		uint64_t length;
+};
+
+// Sessions class
+template<typename Session> class Sessions {
+
+	// Public
+	public:
+	
+		// Add
+		uint64_t add(const shared_ptr<Session> &session) {
+		
+			// Lock sessions
+			lock_guard<mutex> guard(lock);
+			
+			// Check if all handles were used
+			if(nextHandle == NO_SESSION) {
+			
+				// Throw error
+				throw runtime_error("Creating session handle failed");
+			}
+			
+			// Add session to list
+			const uint64_t handle = nextHandle++;
+			sessions.emplace(handle, session);
+			
+			// Return handle
+			return handle;
+		}
+		
+		// Get
+		shared_ptr<Session> get(uint64_t handle) {
+		
+			// Lock sessions
+			lock_guard<mutex> guard(lock);
+			
+			// Check if session doesn't exist
+			const typename unordered_map<uint64_t, shared_ptr<Session>>::const_iterator session = sessions.find(handle);
+			if(session == sessions.cend()) {
+			
+				// Throw error
+				throw runtime_error("Session doesn't exist");
+			}
+			
+			// Return session
+			return session->second;
+		}
+		
+		// Remove
+		void remove(uint64_t handle) {
+		
+			// Lock sessions
+			lock_guard<mutex> guard(lock);
+			
+			// Remove session from list
+			sessions.erase(handle);
+		}
+	
+	// Private
+	private:
+	
+		// Lock
+		mutex lock;
+		
+		// Sessions
+		unordered_map<uint64_t, shared_ptr<Session>> sessions;
+		
+		// Next handle
+		uint64_t nextHandle = NO_SESSION + 1;
+};
+
+// Bulletproof session class which keeps a multi-party bulletproof's parsed inputs and totals between rounds, but not the prover's round one state, so each round runs the library's prover again
+class BulletproofSession {
+
+	// Public
+	public:
+	
+		// Constructor
+		BulletproofSession(const uint8_t *blind, size_t blindSize, const char *value, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize, const uint8_t *privateNonce, size_t privateNonceSize, const uint8_t *extraCommit, size_t extraCommitSize, const uint8_t *message, size_t messageSize) :
+		
+			// Set value to value
+			value(valueFromString(value)),
+			
+			// Set has blind to if blind is provided
+			hasBlind(blind),
+			
+			// Set blind to blind
+			blind(blind ? blind : nullptr, blind ? blind + blindSize : nullptr),
+			
+			// Set nonce to nonce
+			nonce(nonce, nonce + nonceSize),
+			
+			// Set private nonce to private nonce
+			privateNonce(privateNonce, privateNonce + privateNonceSize),
+			
+			// Set extra commit to extra commit
+			extraCommit(extraCommit, extraCommit + extraCommitSize),
+			
+			// Set message to message
+			message(message, message + messageSize),
+			
+			// Set round to created
+			round(Round::CREATED)
+		{
+		
+			// Check if blind, nonce, private nonce, or message are invalid
+			if((hasBlind && this->blind.size() != Secp256k1Zkp::blindSize()) || this->nonce.size() != Secp256k1Zkp::secretKeySize() || (!this->privateNonce.empty() && this->privateNonce.size() != Secp256k1Zkp::secretKeySize()) || (!this->message.empty() && this->message.size() != Secp256k1Zkp::bulletproofMessageSize())) {
+			
+				// Clear secrets
+				clearSecrets();
+			
+				// Throw error
+				throw runtime_error("Bulletproof session data is invalid");
+			}
+			
+			// Check if parsing commit failed
+			if(commitSize != Secp256k1Zkp::commitSize() || !Secp256k1Zkp::secp256k1_pedersen_commitment_parse(Secp256k1Zkp::context, &this->commit, commit)) {
+			
+				// Clear secrets
+				clearSecrets();
+			
+				// Throw error
+				throw runtime_error("Parsing commit failed");
+			}
+		}
+		
+		// Destructor
+		~BulletproofSession() {
+		
+			// Clear secrets
+			clearSecrets();
+		}
+		
+		// Round one
+		tuple<vector<uint8_t>, vector<uint8_t>> roundOne() {
+		
+			// Lock session
+			lock_guard<mutex> guard(lock);
+			
+			// Check if session doesn't have a blind or a private nonce
+			if(!hasBlind || privateNonce.empty()) {
+			
+				// Throw error
+				throw runtime_error("Bulletproof session can't perform round one");
+			}
+			
+			// Check if performing round one failed
+			Secp256k1Zkp::secp256k1_pubkey tOne;
+			Secp256k1Zkp::secp256k1_pubkey tTwo;
+			if(!prove(nullptr, nullptr, nullptr, &tOne, &tTwo, true)) {
+			
+				// Throw error
+				throw runtime_error("Performing bulletproof session round one failed");
+			}
+			
+			// Set round to round one
+			round = Round::ROUND_ONE;
+			
+			// Return t one and t two
+			return {serializePublicKey(tOne), serializePublicKey(tTwo)};
+		}
+		
+		// Round two
+		vector<uint8_t> roundTwo(const uint8_t *tOne, size_t tOneSize, const uint8_t *tTwo, size_t tTwoSize) {
+		
+			// Lock session
+			lock_guard<mutex> guard(lock);
+			
+			// Check if round one wasn't performed
+			if(round != Round::ROUND_ONE) {
+			
+				// Throw error
+				throw runtime_error("Bulletproof session can't perform round two");
+			}
+			
+			// Check if parsing t one or t two failed
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_parse(Secp256k1Zkp::context, &tOneTotal, tOne, tOneSize) || !Secp256k1Zkp::secp256k1_ec_pubkey_parse(Secp256k1Zkp::context, &tTwoTotal, tTwo, tTwoSize)) {
+			
+				// Throw error
+				throw runtime_error("Parsing t one or t two failed");
+			}
+			
+			// Check if performing round two failed
+			vector<uint8_t> tauX(Secp256k1Zkp::blindSize());
+			if(!prove(nullptr, nullptr, tauX.data(), &tOneTotal, &tTwoTotal, true)) {
+			
+				// Clear tau x
+				clearMemory(tauX.data(), tauX.size());
+			
+				// Throw error
+				throw runtime_error("Performing bulletproof session round two failed");
+			}
+			
+			// Set round to round two
+			round = Round::ROUND_TWO;
+			
+			// Return tau x
+			return tauX;
+		}
+		
+		// Finalize
+		vector<uint8_t> finalize(const uint8_t *tauX, size_t tauXSize) {
+		
+			// Lock session
+			lock_guard<mutex> guard(lock);
+			
+			// Check if round two wasn't performed or tau x is invalid
+			if(round != Round::ROUND_TWO || tauXSize != Secp256k1Zkp::blindSize()) {
+			
+				// Throw error
+				throw runtime_error("Bulletproof session can't be finalized");
+			}
+			
+			// Check if creating proof failed
+			vector<uint8_t> tauXTotal(tauX, tauX + tauXSize);
+			vector<uint8_t> proof(Secp256k1Zkp::bulletproofProofSize());
+			size_t proofSize = proof.size();
+			const bool result = prove(proof.data(), &proofSize, tauXTotal.data(), &tOneTotal, &tTwoTotal, false);
+			clearMemory(tauXTotal.data(), tauXTotal.size());
+			if(!result) {
+			
+				// Throw error
+				throw runtime_error("Finalizing bulletproof session failed");
+			}
+			
+			// Set proof's size to proof size
+			proof.resize(proofSize);
+			
+			// Return proof
+			return proof;
+		}
+	
+	// Private
+	private:
+	
+		// Round
+		enum class Round {
+		
+			// Created
+			CREATED,
+			
+			// Round one
+			ROUND_ONE,
+			
+			// Round two
+			ROUND_TWO
+		};
+		
+		// Prove from the start with the session's inputs
+		bool prove(uint8_t *proof, size_t *proofSize, uint8_t *tauX, Secp256k1Zkp::secp256k1_pubkey *tOne, Secp256k1Zkp::secp256k1_pubkey *tTwo, bool useBlind) const {
+		
+			// Get blinds and commits
+			const uint8_t *blinds[] = {blind.data()};
+			const Secp256k1Zkp::secp256k1_pedersen_commitment *commits[] = {&commit};
+			
+			// Return performing bulletproof prove
+			return Secp256k1Zkp::secp256k1_bulletproof_rangeproof_prove(Secp256k1Zkp::context, Secp256k1Zkp::scratchSpace, Secp256k1Zkp::generators, proof, proofSize, tauX, tOne, tTwo, &value, nullptr, useBlind ? blinds : nullptr, commits, 1, &Secp256k1Zkp::secp256k1_generator_const_h, BULLETPROOF_NUMBER_OF_BITS, nonce.data(), privateNonce.empty() ? nullptr : privateNonce.data(), extraCommit.empty() ? nullptr : extraCommit.data(), extraCommit.size(), message.empty() ? nullptr : message.data());
+		}
+		
+		// Serialize public key
+		static vector<uint8_t> serializePublicKey(const Secp256k1Zkp::secp256k1_pubkey &publicKey) {
+		
+			// Check if serializing public key failed
+			vector<uint8_t> result(Secp256k1Zkp::publicKeySize());
+			size_t resultSize = result.size();
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_serialize(Secp256k1Zkp::context, result.data(), &resultSize, &publicKey, SECP256K1_EC_COMPRESSED)) {
+			
+				// Throw error
+				throw runtime_error("Serializing public key failed");
+			}
+			
+			// Return result
+			return result;
+		}
+		
+		// Clear secrets
+		void clearSecrets() {
+		
+			// Clear blind, nonce, and private nonce
+			clearMemory(blind.data(), blind.size());
+			clearMemory(nonce.data(), nonce.size());
+			clearMemory(privateNonce.data(), privateNonce.size());
+		}
+		
+		// Lock
+		mutex lock;
+		
+		// Value
+		const uint64_t value;
+		
+		// Has blind
+		const bool hasBlind;
+		
+		// Blind
+		SecureBytes blind;
+		
+		// Nonce
+		SecureBytes nonce;
+		
+		// Private nonce
+		SecureBytes privateNonce;
+		
+		// Extra commit
+		const vector<uint8_t> extraCommit;
+		
+		// Message
+		const vector<uint8_t> message;
+		
+		// Commit
+		Secp256k1Zkp::secp256k1_pedersen_commitment commit;
+		
+		// T one total
+		Secp256k1Zkp::secp256k1_pubkey tOneTotal;
+		
+		// T two total
+		Secp256k1Zkp::secp256k1_pubkey tTwoTotal;
+		
+		// Round
+		Round round;
+};
+
+
+// Aggsig session class
+class AggsigSession {
+
+	// Public
+	public:
+	
+		// Constructor
+		AggsigSession(const uint8_t *message, size_t messageSize, const uint8_t *publicKeyTotal, size_t publicKeyTotalSize, const uint8_t *publicNonceTotal, size_t publicNonceTotalSize) :
+		
+			// Set message to message
+			message(message, message + messageSize)
+		{
+		
+			// Check if message is invalid
+			if(this->message.size() != SINGLE_SIGNER_MESSAGE_SIZE) {
+			
+				// Throw error
+				throw runtime_error("Message is invalid");
+			}
+			
+			// Check if parsing public key total failed
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_parse(Secp256k1Zkp::context, &this->publicKeyTotal, publicKeyTotal, publicKeyTotalSize)) {
+			
+				// Throw error
+				throw runtime_error("Parsing public key total failed");
+			}
+			
+			// Check if parsing public nonce total failed
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_parse(Secp256k1Zkp::context, &this->publicNonceTotal, publicNonceTotal, publicNonceTotalSize)) {
+			
+				// Throw error
+				throw runtime_error("Parsing public nonce total failed");
+			}
+			
+			// Check if the aggsig functions that take a sighash give the same results as the library's aggsig functions
+			static const bool aggsigWithSighashCompatible = isAggsigWithSighashCompatible();
+			if(aggsigWithSighashCompatible) {
+			
+				// Check if getting the sighash that every signature in the session shares failed
+				sighash.resize(SINGLE_SIGNER_MESSAGE_SIZE);
+				if(!Secp256k1Zkp::secp256k1_aggsig_sighash_single(Secp256k1Zkp::context, sighash.data(), this->message.data(), &this->publicNonceTotal, &this->publicKeyTotal)) {
+				
+					// Throw error
+					throw runtime_error("Getting sighash failed");
+				}
+			}
+		}
+		
+		// Partial sign
+		vector<uint8_t> partialSign(const uint8_t *secretKey, size_t secretKeySize, const uint8_t *secretNonce, size_t secretNonceSize) const {
+		
+			// Check if secret key or secret nonce are invalid
+			if(secretKeySize != Secp256k1Zkp::secretKeySize() || secretNonceSize != Secp256k1Zkp::nonceSize()) {
+			
+				// Throw error
+				throw runtime_error("Secret key or secret nonce is invalid");
+			}
+			
+			// Check if creating partial signature with the session's sighash if it has one failed
+			Secp256k1Zkp::secp256k1_ecdsa_signature signature;
+			if(!(sighash.empty() ? Secp256k1Zkp::secp256k1_aggsig_sign_single(Secp256k1Zkp::context, signature.data, message.data(), secretKey, secretNonce, nullptr, &publicNonceTotal, &publicNonceTotal, &publicKeyTotal, nullptr) : Secp256k1Zkp::secp256k1_aggsig_sign_single_with_sighash(Secp256k1Zkp::context, signature.data, sighash.data(), secretKey, secretNonce, &publicNonceTotal))) {
+			
+				// Throw error
+				throw runtime_error("Creating partial signature failed");
+			}
+			
+			// Return serializing signature
+			return serializeSignature(signature);
+		}
+		
+		// Partial verify
+		bool partialVerify(const uint8_t *signature, size_t signatureSize, const uint8_t *publicKey, size_t publicKeySize) const {
+		
+			// Check if parsing signature or public key failed
+			Secp256k1Zkp::secp256k1_ecdsa_signature signatureData;
+			Secp256k1Zkp::secp256k1_pubkey publicKeyData;
+			if(!parseSignature(signatureData, signature, signatureSize) || !Secp256k1Zkp::secp256k1_ec_pubkey_parse(Secp256k1Zkp::context, &publicKeyData, publicKey, publicKeySize)) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Return if partial signature is verified with the session's sighash if it has one
+			return sighash.empty() ? Secp256k1Zkp::secp256k1_aggsig_verify_single(Secp256k1Zkp::context, signatureData.data, message.data(), &publicNonceTotal, &publicKeyData, &publicKeyTotal, nullptr, true) : Secp256k1Zkp::secp256k1_aggsig_verify_single_with_sighash(Secp256k1Zkp::context, signatureData.data, sighash.data(), &publicKeyData, true);
+		}
+		
+		// Aggregate
+		vector<uint8_t> aggregate(const uint8_t *signatures, size_t signaturesSizes[], size_t numberOfSignatures) const {
+		
+			// Go through all signatures
+			vector<Secp256k1Zkp::secp256k1_ecdsa_signature> signaturesData(numberOfSignatures);
+			vector<const uint8_t *> signaturesPointers(numberOfSignatures);
+			size_t offset = 0;
+			for(size_t i = 0; i < numberOfSignatures; ++i) {
+			
+				// Check if parsing signature failed
+				if(!parseSignature(signaturesData[i], &signatures[offset], signaturesSizes[i])) {
+				
+					// Throw error
+					throw runtime_error("Parsing signature failed");
+				}
+				
+				// Set signature's pointer
+				signaturesPointers[i] = signaturesData[i].data;
+				
+				// Update offset
+				offset += signaturesSizes[i];
+			}
+			
+			// Check if adding signatures failed
+			Secp256k1Zkp::secp256k1_ecdsa_signature result;
+			if(!Secp256k1Zkp::secp256k1_aggsig_add_signatures_single(Secp256k1Zkp::context, result.data, signaturesPointers.data(), signaturesPointers.size(), &publicNonceTotal)) {
+			
+				// Throw error
+				throw runtime_error("Adding signatures failed");
+			}
+			
+			// Return serializing result
+			return serializeSignature(result);
+		}
+		
+		// Verify
+		bool verify(const uint8_t *signature, size_t signatureSize) const {
+		
+			// Check if parsing signature failed
+			Secp256k1Zkp::secp256k1_ecdsa_signature signatureData;
+			if(!parseSignature(signatureData, signature, signatureSize)) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Return if signature is verified with the session's sighash if it has one
+			return sighash.empty() ? Secp256k1Zkp::secp256k1_aggsig_verify_single(Secp256k1Zkp::context, signatureData.data, message.data(), &publicNonceTotal, &publicKeyTotal, &publicKeyTotal, nullptr, false) : Secp256k1Zkp::secp256k1_aggsig_verify_single_with_sighash(Secp256k1Zkp::context, signatureData.data, sighash.data(), &publicKeyTotal, false);
+		}
+	
+	// Private
+	private:
+	
+		// Parse signature
+		static bool parseSignature(Secp256k1Zkp::secp256k1_ecdsa_signature &result, const uint8_t *signature, size_t signatureSize) {
+		
+			// Return if signature is valid and parsing it was successful
+			return signatureSize == Secp256k1Zkp::singleSignerSignatureSize() && Secp256k1Zkp::secp256k1_ecdsa_signature_parse_compact(Secp256k1Zkp::context, &result, signature);
+		}
+		
+		// Serialize signature
+		static vector<uint8_t> serializeSignature(const Secp256k1Zkp::secp256k1_ecdsa_signature &signature) {
+		
+			// Check if serializing signature failed
+			vector<uint8_t> result(Secp256k1Zkp::singleSignerSignatureSize());
+			if(!Secp256k1Zkp::secp256k1_ecdsa_signature_serialize_compact(Secp256k1Zkp::context, result.data(), &signature)) {
+			
+				// Throw error
+				throw runtime_error("Serializing signature failed");
+			}
+			
+			// Return result
+			return result;
+		}
+		
+		// Message
+		const vector<uint8_t> message;
+		
+		// Public key total
+		Secp256k1Zkp::secp256k1_pubkey publicKeyTotal;
+		
+		// Public nonce total
+		Secp256k1Zkp::secp256k1_pubkey publicNonceTotal;
+		
+		// Sighash
+		vector<uint8_t> sighash;
+};
+
+
+// Nonce pool class
+class NoncePool {
+
+	// Public
+	public:
+	
+		// Destructor
+		~NoncePool() {
+		
+			// Stop
+			stop();
+		}
+		
+		// Take
+		tuple<SecureBytes, vector<uint8_t>> take() {
+		
+			// Lock nonce pool
+			unique_lock<mutex> guard(lock);
+			
+			// Check if refilling isn't running and the nonce pool isn't stopped
+			if(!refilling && !stopped) {
+			
+				// Check if a previous refiller exited
+				if(refiller.joinable()) {
+				
+					// Wait for the previous refiller to finish
+					refiller.join();
+				}
+				
+				// Start refilling in the background
+				refiller = thread(&NoncePool::refill, this);
+				
+				// Set refilling
+				refilling = true;
+			}
+			
+			// Check if no nonce pairs are available
+			if(noncePairs.empty()) {
+			
+				// Unlock nonce pool
+				guard.unlock();
+				
+				// Return creating nonce pair
+				return createNoncePair();
+			}
+			
+			// Remove nonce pair from the nonce pool so that its secret nonce only exists in the result
+			tuple<SecureBytes, vector<uint8_t>> result = move(noncePairs.back());
+			noncePairs.pop_back();
+			
+			// Notify refiller that a nonce pair was consumed
+			condition.notify_one();
+			
+			// Return result
+			return result;
+		}
+		
+		// Stop
+		void stop() {
+		
+			// Lock nonce pool
+			{
+				lock_guard<mutex> guard(lock);
+				
+				// Set stopped
+				stopped = true;
+			}
+			
+			// Notify refiller that the nonce pool is stopped
+			condition.notify_one();
+			
+			// Check if refilling is running
+			if(refiller.joinable()) {
+			
+				// Wait for refilling to finish
+				refiller.join();
+			}
+			
+			// Go through all nonce pairs
+			for(tuple<SecureBytes, vector<uint8_t>> &noncePair : noncePairs) {
+			
+				// Clear secret nonce
+				clearMemory(get<0>(noncePair).data(), get<0>(noncePair).size());
+			}
+			
+			// Remove all nonce pairs
+			noncePairs.clear();
+		}
+	
+	// Private
+	private:
+	
+		// Refill
+		void refill() {
+		
+			// Lock nonce pool
+			unique_lock<mutex> guard(lock);
+			
+			// Loop while the nonce pool isn't stopped
+			while(!stopped) {
+			
+				// Check if the nonce pool is full
+				if(noncePairs.size() >= NONCE_POOL_SIZE) {
+				
+					// Wait until a nonce pair is consumed or the nonce pool is stopped
+					condition.wait(guard);
+					
+					// Continue
+					continue;
+				}
+				
+				// Unlock nonce pool while creating a nonce pair
+				guard.unlock();
+				
+				// Initialize nonce pair
+				tuple<SecureBytes, vector<uint8_t>> noncePair;
+				
+				// Try
+				try {
+				
+					// Create nonce pair
+					noncePair = createNoncePair();
+				}
+				
+				// Catch errors
+				catch(...) {
+				
+					// Stop refilling and let take create nonce pairs on demand and restart refilling
+					guard.lock();
+					break;
+				}
+				
+				// Lock nonce pool
+				guard.lock();
+				
+				// Check if the nonce pool was stopped
+				if(stopped) {
+				
+					// Clear secret nonce
+					clearMemory(get<0>(noncePair).data(), get<0>(noncePair).size());
+					
+					// Break
+					break;
+				}
+				
+				// Add nonce pair to the nonce pool
+				noncePairs.push_back(move(noncePair));
+			}
+			
+			// Clear refilling
+			refilling = false;
+		}
+		
+		// Create nonce pair
+		static tuple<SecureBytes, vector<uint8_t>> createNoncePair() {
+		
+			// Create random seed
+			SecureBytes seed(Secp256k1Zkp::seedSize());
+			randomBytes(seed.data(), seed.size());
+			
+			// Check if creating secret nonce failed
+			SecureBytes secretNonce(Secp256k1Zkp::nonceSize());
+			const bool result = Secp256k1Zkp::createSecretNonce(secretNonce.data(), seed.data(), seed.size());
+			clearMemory(seed.data(), seed.size());
+			if(!result) {
+			
+				// Throw error
+				throw runtime_error("Creating secret nonce failed");
+			}
+			
+			// Check if getting public nonce from the secret nonce failed
+			vector<uint8_t> publicNonce(Secp256k1Zkp::publicKeySize());
+			if(!Secp256k1Zkp::publicKeyFromSecretKey(publicNonce.data(), secretNonce.data(), secretNonce.size())) {
+			
+				// Clear secret nonce
+				clearMemory(secretNonce.data(), secretNonce.size());
+			
+				// Throw error
+				throw runtime_error("Getting public nonce from secret nonce failed");
+			}
+			
+			// Return secret nonce and public nonce
+			return tuple<SecureBytes, vector<uint8_t>>(move(secretNonce), move(publicNonce));
+		}
+		
+		// Lock
+		mutex lock;
+		
+		// Condition
+		condition_variable condition;
+		
+		// Nonce pairs
+		vector<tuple<SecureBytes, vector<uint8_t>>> noncePairs;
+		
+		// Refiller
+		thread refiller;
+		
+		// Refilling
+		bool refilling = false;
+		
+		// Stopped
+		bool stopped = false;
+};
+
+
+// Commit accumulator class
+class CommitAccumulator {
+
+	// Public
+	public:
+	
+		// Add
+		void add(const uint8_t *commits, size_t commitsSizes[], size_t numberOfCommits, bool isPositive) {
+		
+			// Lock accumulator
+			lock_guard<mutex> guard(lock);
+			
+			// Accumulate commits into a copy of the total so that a failure leaves the total unchanged
+			Secp256k1Zkp::secp256k1_pedersen_commitment newTotal = total;
+			bool newTotalIsInfinity = totalIsInfinity;
+			accumulateCommits(newTotal, newTotalIsInfinity, commits, commitsSizes, numberOfCommits, isPositive);
+			
+			// Update total
+			total = newTotal;
+			totalIsInfinity = newTotalIsInfinity;
+		}
+		
+		// Checkpoint
+		uint64_t checkpoint() {
+		
+			// Lock accumulator
+			lock_guard<mutex> guard(lock);
+			
+			// Add total to the checkpoints
+			checkpoints.emplace_back(total, totalIsInfinity);
+			
+			// Return checkpoint's index
+			return checkpoints.size() - 1;
+		}
+		
+		// Restore
+		void restore(uint64_t checkpoint) {
+		
+			// Lock accumulator
+			lock_guard<mutex> guard(lock);
+			
+			// Check if checkpoint doesn't exist
+			if(checkpoint >= checkpoints.size()) {
+			
+				// Throw error
+				throw runtime_error("Checkpoint doesn't exist");
+			}
+			
+			// Set total to the checkpoint's total
+			total = checkpoints[checkpoint].first;
+			totalIsInfinity = checkpoints[checkpoint].second;
+			
+			// Remove checkpoints after the checkpoint
+			checkpoints.resize(checkpoint + 1);
+		}
+		
+		// Get total
+		vector<uint8_t> getTotal() {
+		
+			// Lock accumulator
+			lock_guard<mutex> guard(lock);
+			
+			// Check if total is infinity
+			if(totalIsInfinity) {
+			
+				// Return nothing since the commits cancel out
+				return {};
+			}
+			
+			// Check if serializing total failed
+			vector<uint8_t> result(Secp256k1Zkp::commitSize());
+			if(!Secp256k1Zkp::secp256k1_pedersen_commitment_serialize(Secp256k1Zkp::context, result.data(), &total)) {
+			
+				// Throw error
+				throw runtime_error("Serializing commit accumulator total failed");
+			}
+			
+			// Return result
+			return result;
+		}
+	
+	// Private
+	private:
+	
+		// Lock
+		mutex lock;
+		
+		// Total
+		Secp256k1Zkp::secp256k1_pedersen_commitment total;
+		
+		// Total is infinity
+		bool totalIsInfinity = true;
+		
+		// Checkpoints
+		vector<pair<Secp256k1Zkp::secp256k1_pedersen_commitment, bool>> checkpoints;
+};
+
+
+// Verification cache class
+class VerificationCache {
+
+	// Public
+	public:
+	
+		// Get key
+		static string getKey(VerificationType type, initializer_list<pair<const uint8_t *, size_t>> fields) {
+		
+			// Include type in the hash
+			Sha512 hash;
+			const uint8_t typeByte = static_cast<uint8_t>(type);
+			hash.update(&typeByte, sizeof(typeByte));
+			
+			// Go through all fields
+			for(const pair<const uint8_t *, size_t> &field : fields) {
+			
+				// Set header to if the field is provided
+				uint8_t header[sizeof(uint8_t) + sizeof(uint64_t)];
+				header[0] = field.first != nullptr;
+				
+				// Go through all of the field's size's bytes
+				for(size_t i = 0; i < sizeof(uint64_t); ++i) {
+				
+					// Set size byte in the header
+					header[sizeof(uint8_t) + i] = static_cast<uint64_t>(field.second) >> ((sizeof(uint64_t) - 1 - i) * CHAR_BIT);
+				}
+				
+				// Include header in the hash so that fields can't run into each other
+				hash.update(header, sizeof(header));
+				
+				// Check if field is provided
+				if(field.first) {
+				
+					// Include field in the hash
+					hash.update(field.first, field.second);
+				}
+			}
+			
+			// Return hash
+			uint8_t result[SHA512_DIGEST_SIZE];
+			hash.finalize(result);
+			return string(reinterpret_cast<const char *>(result), sizeof(result));
+		}
+		
+		// Is enabled
+		bool isEnabled() {
+		
+			// Lock cache
+			lock_guard<mutex> guard(lock);
+			
+			// Return if cache has a capacity
+			return capacity;
+		}
+		
+		// Get
+		bool get(const string &key, bool &result) {
+		
+			// Lock cache
+			lock_guard<mutex> guard(lock);
+			
+			// Check if key isn't cached
+			const unordered_map<string, list<pair<string, bool>>::iterator>::const_iterator entry = index.find(key);
+			if(entry == index.cend()) {
+			
+				// Increment misses
+				++misses;
+				
+				// Return false
+				return false;
+			}
+			
+			// Move entry to the front of the entries since it was the most recently used
+			entries.splice(entries.begin(), entries, entry->second);
+			
+			// Increment hits
+			++hits;
+			
+			// Set result to the entry's result
+			result = entry->second->second;
+			
+			// Return true
+			return true;
+		}
+		
+		// Set
+		void set(const string &key, bool result) {
+		
+			// Lock cache
+			lock_guard<mutex> guard(lock);
+			
+			// Check if cache is disabled or key is already cached
+			if(!capacity || index.count(key)) {
+			
+				// Return
+				return;
+			}
+			
+			// Add entry to the front of the entries
+			entries.emplace_front(key, result);
+			index.emplace(key, entries.begin());
+			
+			// Evict least recently used entries
+			evict();
+		}
+		
+		// Set capacity
+		void setCapacity(size_t capacity) {
+		
+			// Lock cache
+			lock_guard<mutex> guard(lock);
+			
+			// Set capacity
+			this->capacity = capacity;
+			
+			// Evict least recently used entries
+			evict();
+		}
+		
+		// Get statistics
+		tuple<uint64_t, uint64_t, uint64_t> getStatistics() {
+		
+			// Lock cache
+			lock_guard<mutex> guard(lock);
+			
+			// Return hits, misses, and number of entries
+			return make_tuple(hits, misses, entries.size());
+		}
+	
+	// Private
+	private:
+	
+		// Evict
+		void evict() {
+		
+			// Loop while there are more entries than the capacity
+			while(entries.size() > capacity) {
+			
+				// Remove least recently used entry
+				index.erase(entries.back().first);
+				entries.pop_back();
+			}
+		}
+		
+		// Lock
+		mutex lock;
+		
+		// Capacity
+		size_t capacity = 0;
+		
+		// Entries
+		list<pair<string, bool>> entries;
+		
+		// Index
+		unordered_map<string, list<pair<string, bool>>::iterator> index;
+		
+		// Hits
+		uint64_t hits = 0;
+		
+		// Misses
+		uint64_t misses = 0;
+};
+
+
+// Rewind cache class
+class RewindCache {
+
+	// Public
+	public:
+	
+		// Status
+		enum class Status : uint8_t {
+		
+			// Unknown
+			UNKNOWN,
+			
+			// Not ours
+			NOT_OURS,
+			
+			// Ours
+			OURS
+		};
+		
+		// Constructor
+		RewindCache(const char *path, const uint8_t *key, size_t keySize) :
+		
+			// Set record size to the size of a tag, nonce, status, value, blind, message, and MAC
+			recordSize(REWIND_CACHE_TAG_SIZE + CHACHA20_NONCE_SIZE + sizeof(uint8_t) + MAX_64_BIT_INTEGER_STRING_LENGTH + Secp256k1Zkp::blindSize() + Secp256k1Zkp::bulletproofMessageSize() + REWIND_CACHE_MAC_SIZE)
+		{
+		
+			// Check if key is invalid
+			if(keySize != CHACHA20_KEY_SIZE) {
+			
+				// Throw error
+				throw runtime_error("Key is invalid");
+			}
+			
+			// Get encryption key, tag key, and MAC key from the key
+			const char encryptionLabel[] = "encryption";
+			const char authenticationLabel[] = "authentication";
+			uint8_t encryptionKeys[SHA512_DIGEST_SIZE];
+			hmacSha512(encryptionKeys, key, keySize, reinterpret_cast<const uint8_t *>(encryptionLabel), sizeof(encryptionLabel) - sizeof('\0'));
+			hmacSha512(authenticationKeys, key, keySize, reinterpret_cast<const uint8_t *>(authenticationLabel), sizeof(authenticationLabel) - sizeof('\0'));
+			memcpy(encryptionKey, encryptionKeys, sizeof(encryptionKey));
+			clearMemory(encryptionKeys, sizeof(encryptionKeys));
+			
+			// Check if opening file failed
+			file = open(path, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+			if(file == -1) {
+			
+				// Clear keys
+				clearKeys();
+				
+				// Throw error
+				throw runtime_error("Opening rewind cache failed");
+			}
+			
+			// Try
+			try {
+			
+				// Check if getting file's size failed
+				struct stat fileStatus;
+				if(fstat(file, &fileStatus)) {
+				
+					// Throw error
+					throw runtime_error("Getting rewind cache's size failed");
+				}
+				
+				// Check if file is new
+				if(!fileStatus.st_size) {
+				
+					// Check if writing header failed
+					uint8_t header[REWIND_CACHE_HEADER_SIZE] = {};
+					memcpy(header, REWIND_CACHE_MAGIC, sizeof(REWIND_CACHE_MAGIC));
+					if(pwrite(file, header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+					
+						// Throw error
+						throw runtime_error("Writing rewind cache's header failed");
+					}
+					
+					// Map file with its initial capacity
+					map(REWIND_CACHE_HEADER_SIZE + REWIND_CACHE_INITIAL_CAPACITY * recordSize);
+				}
+				
+				// Otherwise
+				else {
+				
+					// Check if file is too small for its header
+					if(static_cast<size_t>(fileStatus.st_size) < REWIND_CACHE_HEADER_SIZE) {
+					
+						// Throw error
+						throw runtime_error("Rewind cache is invalid");
+					}
+					
+					// Map file
+					map(fileStatus.st_size);
+				}
+				
+				// Check if file's magic is invalid or its number of records doesn't fit in the file
+				numberOfRecords = readNumberOfRecords();
+				if(memcmp(data, REWIND_CACHE_MAGIC, sizeof(REWIND_CACHE_MAGIC)) || numberOfRecords > (size - REWIND_CACHE_HEADER_SIZE) / recordSize) {
+				
+					// Throw error
+					throw runtime_error("Rewind cache is invalid");
+				}
+				
+				// Go through all records
+				for(size_t i = 0; i < numberOfRecords; ++i) {
+				
+					// Add record's tag to the index with newer records replacing older ones
+					const size_t offset = REWIND_CACHE_HEADER_SIZE + i * recordSize;
+					index[string(reinterpret_cast<const char *>(&data[offset]), REWIND_CACHE_TAG_SIZE)] = offset;
+				}
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Unmap and close file
+				unmap();
+				close(file);
+				
+				// Clear keys
+				clearKeys();
+				
+				// Throw error
+				throw;
+			}
+		}
+		
+		// Destructor
+		~RewindCache() {
+		
+			// Unmap and close file
+			unmap();
+			close(file);
+			
+			// Clear keys
+			clearKeys();
+		}
+		
+		// Get
+		Status get(const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize, string &value, SecureBytes &blind, vector<uint8_t> &message) {
+		
+			// Lock cache
+			lock_guard<mutex> guard(lock);
+			
+			// Check if commit isn't cached for the nonce
+			const unordered_map<string, size_t>::const_iterator entry = index.find(getTag(commit, commitSize, nonce, nonceSize));
+			if(entry == index.cend()) {
+			
+				// Return unknown
+				return Status::UNKNOWN;
+			}
+			
+			// Check if record's MAC is invalid
+			const uint8_t *record = &data[entry->second];
+			const size_t authenticatedSize = recordSize - REWIND_CACHE_MAC_SIZE;
+			uint8_t mac[SHA512_DIGEST_SIZE];
+			hmacSha512(mac, &authenticationKeys[CHACHA20_KEY_SIZE], CHACHA20_KEY_SIZE, record, authenticatedSize);
+			uint8_t difference = 0;
+			for(size_t i = 0; i < REWIND_CACHE_MAC_SIZE; ++i) {
+			
+				// Include byte's difference
+				difference |= mac[i] ^ record[authenticatedSize + i];
+			}
+			if(difference) {
+			
+				// Return unknown so that the commit is rewound again and a new record replaces this one
+				return Status::UNKNOWN;
+			}
+			
+			// Decrypt record's contents directly from the mapped file
+			const uint8_t *recordNonce = &record[REWIND_CACHE_TAG_SIZE];
+			const uint8_t *ciphertext = &recordNonce[CHACHA20_NONCE_SIZE];
+			SecureBytes plaintext(authenticatedSize - REWIND_CACHE_TAG_SIZE - CHACHA20_NONCE_SIZE);
+			chaCha20(plaintext.data(), ciphertext, plaintext.size(), encryptionKey, recordNonce);
+			
+			// Check if record isn't ours
+			const Status status = static_cast<Status>(plaintext[0]);
+			if(status != Status::OURS) {
+			
+				// Clear plaintext
+				clearMemory(plaintext.data(), plaintext.size());
+				
+				// Return not ours
+				return Status::NOT_OURS;
+			}
+			
+			// Get value, blind, and message from the plaintext
+			const uint8_t *field = &plaintext[sizeof(uint8_t)];
+			value.assign(reinterpret_cast<const char *>(field), strnlen(reinterpret_cast<const char *>(field), MAX_64_BIT_INTEGER_STRING_LENGTH));
+			field += MAX_64_BIT_INTEGER_STRING_LENGTH;
+			blind.assign(field, field + Secp256k1Zkp::blindSize());
+			field += Secp256k1Zkp::blindSize();
+			message.assign(field, field + Secp256k1Zkp::bulletproofMessageSize());
+			
+			// Clear plaintext
+			clearMemory(plaintext.data(), plaintext.size());
+			
+			// Return ours
+			return Status::OURS;
+		}
+		
+		// Put
+		void put(const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize, Status status, const char *value, const uint8_t *blind, const uint8_t *message) {
+		
+			// Lock cache
+			lock_guard<mutex> guard(lock);
+			
+			// Check if file needs to grow to fit another record
+			const size_t offset = REWIND_CACHE_HEADER_SIZE + numberOfRecords * recordSize;
+			if(offset + recordSize > size) {
+			
+				// Double the file's size
+				map(REWIND_CACHE_HEADER_SIZE + max(numberOfRecords, REWIND_CACHE_INITIAL_CAPACITY) * 2 * recordSize);
+			}
+			
+			// Set record's tag and nonce
+			uint8_t *record = &data[offset];
+			const string tag = getTag(commit, commitSize, nonce, nonceSize);
+			memcpy(record, tag.data(), REWIND_CACHE_TAG_SIZE);
+			uint8_t *recordNonce = &record[REWIND_CACHE_TAG_SIZE];
+			randomBytes(recordNonce, CHACHA20_NONCE_SIZE);
+			
+			// Get record's plaintext
+			const size_t authenticatedSize = recordSize - REWIND_CACHE_MAC_SIZE;
+			SecureBytes plaintext(authenticatedSize - REWIND_CACHE_TAG_SIZE - CHACHA20_NONCE_SIZE);
+			plaintext[0] = static_cast<uint8_t>(status);
+			
+			// Check if record is ours
+			if(status == Status::OURS) {
+			
+				// Set value, blind, and message in the plaintext
+				uint8_t *field = &plaintext[sizeof(uint8_t)];
+				memcpy(field, value, strnlen(value, MAX_64_BIT_INTEGER_STRING_LENGTH - sizeof('\0')));
+				field += MAX_64_BIT_INTEGER_STRING_LENGTH;
+				memcpy(field, blind, Secp256k1Zkp::blindSize());
+				field += Secp256k1Zkp::blindSize();
+				memcpy(field, message, Secp256k1Zkp::bulletproofMessageSize());
+			}
+			
+			// Encrypt plaintext into the record
+			chaCha20(&recordNonce[CHACHA20_NONCE_SIZE], plaintext.data(), plaintext.size(), encryptionKey, recordNonce);
+			clearMemory(plaintext.data(), plaintext.size());
+			
+			// Set record's MAC
+			uint8_t mac[SHA512_DIGEST_SIZE];
+			hmacSha512(mac, &authenticationKeys[CHACHA20_KEY_SIZE], CHACHA20_KEY_SIZE, record, authenticatedSize);
+			memcpy(&record[authenticatedSize], mac, REWIND_CACHE_MAC_SIZE);
+			
+			// Commit record by updating the number of records after it's written
+			writeNumberOfRecords(++numberOfRecords);
+			
+			// Add record to the index
+			index[tag] = offset;
+		}
+	
+	// Private
+	private:
+	
+		// Get tag
+		string getTag(const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize) const {
+		
+			// Get commit followed by the nonce so that a commit's record only applies to the nonce that it was rewound with
+			SecureBytes commitAndNonce(commit, commit + commitSize);
+			commitAndNonce.insert(commitAndNonce.cend(), nonce, nonce + nonceSize);
+			
+			// Return keyed hash of the commit and nonce so that neither are stored in the clear
+			uint8_t tag[SHA512_DIGEST_SIZE];
+			hmacSha512(tag, authenticationKeys, CHACHA20_KEY_SIZE, commitAndNonce.data(), commitAndNonce.size());
+			clearMemory(commitAndNonce.data(), commitAndNonce.size());
+			return string(reinterpret_cast<const char *>(tag), REWIND_CACHE_TAG_SIZE);
+		}
+		
+		// Map
+		void map(size_t newSize) {
+		
+			// Check if resizing file failed
+			if(newSize != size && ftruncate(file, newSize)) {
+			
+				// Throw error
+				throw runtime_error("Resizing rewind cache failed");
+			}
+			
+			// Check if mapping file failed
+			void *mapping = mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+			if(mapping == MAP_FAILED) {
+			
+				// Throw error
+				throw runtime_error("Mapping rewind cache failed");
+			}
+			
+			// Unmap previous mapping
+			unmap();
+			
+			// Set data and size
+			data = static_cast<uint8_t *>(mapping);
+			size = newSize;
+		}
+		
+		// Unmap
+		void unmap() {
+		
+			// Check if file is mapped
+			if(data) {
+			
+				// Unmap file
+				munmap(data, size);
+				data = nullptr;
+			}
+		}
+		
+		// Read number of records
+		uint64_t readNumberOfRecords() const {
+		
+			// Go through all of the number of records' bytes
+			uint64_t result = 0;
+			for(size_t i = 0; i < sizeof(uint64_t); ++i) {
+			
+				// Include byte in the result
+				result = (result << CHAR_BIT) | data[sizeof(REWIND_CACHE_MAGIC) + i];
+			}
+			
+			// Return result
+			return result;
+		}
+		
+		// Write number of records
+		void writeNumberOfRecords(uint64_t value) {
+		
+			// Go through all of the number of records' bytes
+			for(size_t i = 0; i < sizeof(uint64_t); ++i) {
+			
+				// Set byte
+				data[sizeof(REWIND_CACHE_MAGIC) + i] = value >> ((sizeof(uint64_t) - 1 - i) * CHAR_BIT);
+			}
+		}
+		
+		// Clear keys
+		void clearKeys() {
+		
+			// Clear encryption key and authentication keys
+			clearMemory(encryptionKey, sizeof(encryptionKey));
+			clearMemory(authenticationKeys, sizeof(authenticationKeys));
+		}
+		
+		// Lock
+		mutex lock;
+		
+		// Record size
+		const size_t recordSize;
+		
+		// Encryption key
+		uint8_t encryptionKey[CHACHA20_KEY_SIZE];
+		
+		// Authentication keys
+		uint8_t authenticationKeys[SHA512_DIGEST_SIZE];
+		
+		// File
+		int file = -1;
+		
+		// Data
+		uint8_t *data = nullptr;
+		
+		// Size
+		size_t size = 0;
+		
+		// Number of records
+		uint64_t numberOfRecords = 0;
+		
+		// Index
+		unordered_map<string, size_t> index;
+};
+
+
+// Commit index class
+class CommitIndex {
+
+	// Public
+	public:
+	
+		// No entry
+		static const size_t NO_ENTRY = SIZE_MAX;
+		
+		// Constructor
+		CommitIndex(size_t numberOfCommits, size_t commitSize) :
+		
+			// Set commit size
+			commitSize(commitSize)
+		{
+		
+			// Set capacity to a power of two that keeps the load factor at or below one half
+			size_t capacity = 16;
+			while(capacity < numberOfCommits * 2) {
+			
+				// Double capacity
+				capacity *= 2;
+			}
+			
+			// Create entries
+			entries.resize(capacity, {0, NO_ENTRY, nullptr});
+			mask = capacity - 1;
+			
+			// Create random key so that commits can't be chosen to share a probe run
+			randomBytes(reinterpret_cast<uint8_t *>(key), sizeof(key));
+		}
+		
+		// Find or add
+		size_t findOrAdd(const uint8_t *commit, size_t value) {
+		
+			// Get commit's fingerprint from a keyed hash of it since its bytes can be chosen by whoever created it
+			const uint64_t fingerprint = sipHash(key, commit, commitSize);
+			
+			// Go through entries starting at the commit's slot
+			for(size_t i = fingerprint & mask;; i = (i + 1) & mask) {
+			
+				// Check if entry is empty
+				Entry &entry = entries[i];
+				if(entry.value == NO_ENTRY) {
+				
+					// Set entry to the commit
+					entry = {fingerprint, value, commit};
+					
+					// Return no entry
+					return NO_ENTRY;
+				}
+				
+				// Check if entry is the commit
+				if(entry.fingerprint == fingerprint && !memcmp(entry.commit, commit, commitSize)) {
+				
+					// Return entry's value
+					return entry.value;
+				}
+			}
+		}
+	
+	// Private
+	private:
+	
+		// Entry
+		struct Entry {
+		
+			// Fingerprint
+			uint64_t fingerprint;
+			
+			// Value
+			size_t value;
+			
+			// Commit
+			const uint8_t *commit;
+		};
+		
+		// Commit size
+		const size_t commitSize;
+		
+		// Mask
+		size_t mask;
+		
+		// Key
+		uint64_t key[2];
+		
+		// Entries
+		vector<Entry> entries;
+};
+
+
+// Secure arena class
+class SecureArena {
+
+	// Public
+	public:
+	
+		// Constructor
+		explicit SecureArena(uint8_t *reservedMemory) {
+		
+			// Check if no memory is reserved for the arena or making it usable failed
+			if(!reservedMemory || mprotect(reservedMemory, SECURE_ARENA_SIZE, PROT_READ | PROT_WRITE)) {
+			
+				// Leave arena empty so that allocations use the heap
+				return;
+			}
+			
+			// Set memory
+			memory = reservedMemory;
+			
+			// Lock memory so that it isn't swapped out which can fail if the process's locked memory limit is reached
+			mlock(memory, SECURE_ARENA_SIZE);
+			
+			// Check if memory can be excluded from core dumps
+			#ifdef MADV_DONTDUMP
+			
+				// Exclude memory from core dumps
+				madvise(memory, SECURE_ARENA_SIZE, MADV_DONTDUMP);
+			#endif
+		}
+		
+		// Allocate
+		void *allocate(size_t size) {
+		
+			// Check if arena is empty or size is too large for the arena
+			const size_t numberOfChunks = (size + SECURE_ARENA_CHUNK_SIZE - 1) / SECURE_ARENA_CHUNK_SIZE;
+			if(!memory || !numberOfChunks || numberOfChunks > NUMBER_OF_CHUNKS) {
+			
+				// Return nothing
+				return nullptr;
+			}
+			
+			// Lock arena
+			lock_guard<mutex> guard(lock);
+			
+			// Go through all chunks starting at the first free chunk
+			size_t runStart = firstFreeChunk;
+			for(size_t i = firstFreeChunk; i < NUMBER_OF_CHUNKS; ++i) {
+			
+				// Check if chunk is used
+				if(chunkIsUsed(i)) {
+				
+					// Restart run after the chunk
+					runStart = i + 1;
+				}
+				
+				// Otherwise check if run is large enough
+				else if(i + 1 - runStart == numberOfChunks) {
+				
+					// Go through all chunks in the run
+					for(size_t j = runStart; j <= i; ++j) {
+					
+						// Set chunk as used
+						usedChunks[j / CHAR_BIT] |= 1 << (j % CHAR_BIT);
+					}
+					
+					// Check if run started at the first free chunk
+					if(runStart == firstFreeChunk) {
+					
+						// Update first free chunk
+						firstFreeChunk = i + 1;
+					}
+					
+					// Return run's memory
+					return &memory[runStart * SECURE_ARENA_CHUNK_SIZE];
+				}
+			}
+			
+			// Return nothing
+			return nullptr;
+		}
+		
+		// Deallocate
+		bool deallocate(void *allocation, size_t size) {
+		
+			// Check if allocation isn't in the arena
+			uint8_t *bytes = static_cast<uint8_t *>(allocation);
+			if(!memory || bytes < memory || bytes >= &memory[SECURE_ARENA_SIZE]) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Clear allocation
+			clearMemory(bytes, size);
+			
+			// Lock arena
+			lock_guard<mutex> guard(lock);
+			
+			// Go through all of the allocation's chunks
+			const size_t start = (bytes - memory) / SECURE_ARENA_CHUNK_SIZE;
+			const size_t end = start + (size + SECURE_ARENA_CHUNK_SIZE - 1) / SECURE_ARENA_CHUNK_SIZE;
+			for(size_t i = start; i < end; ++i) {
+			
+				// Set chunk as free
+				usedChunks[i / CHAR_BIT] &= ~(1 << (i % CHAR_BIT));
+			}
+			
+			// Update first free chunk
+			firstFreeChunk = min(firstFreeChunk, start);
+			
+			// Return true
+			return true;
+		}
+	
+	// Private
+	private:
+	
+		// Number of chunks
+		static const size_t NUMBER_OF_CHUNKS = SECURE_ARENA_SIZE / SECURE_ARENA_CHUNK_SIZE;
+		
+		// Chunk is used
+		bool chunkIsUsed(size_t chunk) const {
+		
+			// Return if chunk's bit is set
+			return usedChunks[chunk / CHAR_BIT] & (1 << (chunk % CHAR_BIT));
+		}
+		
+		// Lock
+		mutex lock;
+		
+		// Memory
+		uint8_t *memory = nullptr;
+		
+		// Used chunks
+		uint8_t usedChunks[NUMBER_OF_CHUNKS / CHAR_BIT] = {};
+		
+		// First free chunk
+		size_t firstFreeChunk = 0;
+};
+
+// Secure arena lease class
+class SecureArenaLease {
+
+	// Public
+	public:
+	
+		// Constructor
+		SecureArenaLease();
+		
+		// Destructor
+		~SecureArenaLease();
+		
+		// Get current arena
+		static SecureArena *getCurrentArena();
+		
+		// Get owning arena
+		static SecureArena *getOwningArena(const void *allocation);
+		
+		// Arena
+		SecureArena *arena;
+};
+
+// Thread scratch space class
+class ThreadScratchSpace {
+
+	// Public
+	public:
+	
+		// Destructor
+		~ThreadScratchSpace() {
+		
+			// Check if scratch space exists
+			if(scratchSpace) {
+			
+				// Destroy scratch space
+				Secp256k1Zkp::secp256k1_scratch_space_destroy(scratchSpace);
+			}
+		}
+		
+		// Get
+		Secp256k1Zkp::secp256k1_scratch_space *get() {
+		
+			// Check if scratch space doesn't exist
+			if(!scratchSpace) {
+			
+				// Check if creating scratch space failed
+				scratchSpace = Secp256k1Zkp::secp256k1_scratch_space_create(Secp256k1Zkp::context, BULLETPROOF_VERIFICATION_SCRATCH_SPACE_SIZE);
+				if(!scratchSpace) {
+				
+					// Throw error
+					throw runtime_error("Creating scratch space failed");
+				}
+			}
+			
+			// Return scratch space
+			return scratchSpace;
+		}
+	
+	// Private
+	private:
+	
+		// Scratch space
+		Secp256k1Zkp::secp256k1_scratch_space *scratchSpace = nullptr;
+};
+
+
+// Check if operation stats are enabled
+#ifdef ENABLE_OPERATION_STATS
+
+	// Operation stats class
+	class OperationStats {
+	
+		// Public
+		public:
+		
+			// Add call
+			void addCall(uint64_t nanoseconds, bool failed, size_t numberOfBytesIn) {
+			
+				// Get latency bucket which is the number of bits in the latency
+				size_t bucket = 0;
+				for(uint64_t remaining = nanoseconds; remaining; remaining >>= 1) {
+				
+					// Increment bucket
+					++bucket;
+				}
+				
+				// Update counters without ordering since they're only read as a snapshot
+				calls.fetch_add(1, memory_order_relaxed);
+				failures.fetch_add(failed, memory_order_relaxed);
+				totalNanoseconds.fetch_add(nanoseconds, memory_order_relaxed);
+				bytesIn.fetch_add(numberOfBytesIn, memory_order_relaxed);
+				latencies[bucket].fetch_add(1, memory_order_relaxed);
+			}
+			
+			// Add bytes out
+			void addBytesOut(size_t numberOfBytesOut) {
+			
+				// Update bytes out
+				bytesOut.fetch_add(numberOfBytesOut, memory_order_relaxed);
+			}
+			
+			// Reset
+			void reset() {
+			
+				// Reset counters
+				calls.store(0, memory_order_relaxed);
+				failures.store(0, memory_order_relaxed);
+				totalNanoseconds.store(0, memory_order_relaxed);
+				bytesIn.store(0, memory_order_relaxed);
+				bytesOut.store(0, memory_order_relaxed);
+				
+				// Go through all latency buckets
+				for(atomic<uint64_t> &latency : latencies) {
+				
+					// Reset latency bucket
+					latency.store(0, memory_order_relaxed);
+				}
+			}
+			
+			// Get calls
+			uint64_t getCalls() const {
+			
+				// Return calls
+				return calls.load(memory_order_relaxed);
+			}
+			
+			// To JSON
+			string toJson(const char *name) const {
+			
+				// Get snapshot of the latency buckets
+				uint64_t latencySnapshot[NUMBER_OF_LATENCY_BUCKETS];
+				uint64_t numberOfLatencies = 0;
+				for(size_t i = 0; i < NUMBER_OF_LATENCY_BUCKETS; ++i) {
+				
+					// Set latency bucket in the snapshot
+					latencySnapshot[i] = latencies[i].load(memory_order_relaxed);
+					numberOfLatencies += latencySnapshot[i];
+				}
+				
+				// Return operation's stats as a JSON object
+				return "\"" + string(name) + "\":{\"Calls\":" + to_string(calls.load(memory_order_relaxed)) + ",\"Failures\":" + to_string(failures.load(memory_order_relaxed)) + ",\"TotalNanoseconds\":" + to_string(totalNanoseconds.load(memory_order_relaxed)) + ",\"P50Nanoseconds\":" + to_string(getPercentile(latencySnapshot, numberOfLatencies, 50)) + ",\"P99Nanoseconds\":" + to_string(getPercentile(latencySnapshot, numberOfLatencies, 99)) + ",\"BytesIn\":" + to_string(bytesIn.load(memory_order_relaxed)) + ",\"BytesOut\":" + to_string(bytesOut.load(memory_order_relaxed)) + "}";
+			}
+		
+		// Private
+		private:
+		
+			// Get percentile
+			static uint64_t getPercentile(const uint64_t latencySnapshot[], uint64_t numberOfLatencies, uint64_t percentile) {
+			
+				// Get rank of the percentile
+				const uint64_t rank = (numberOfLatencies * percentile + 99) / 100;
+				
+				// Go through all latency buckets
+				uint64_t count = 0;
+				for(size_t i = 0; i < NUMBER_OF_LATENCY_BUCKETS; ++i) {
+				
+					// Check if the percentile is in the bucket
+					count += latencySnapshot[i];
+					if(count && count >= rank) {
+					
+						// Return bucket's upper bound
+						return i ? UINT64_MAX >> (NUMBER_OF_LATENCY_BUCKETS - 1 - i) : 0;
+					}
+				}
+				
+				// Return zero
+				return 0;
+			}
+			
+			// Calls
+			atomic<uint64_t> calls;
+			
+			// Failures
+			atomic<uint64_t> failures;
+			
+			// Total nanoseconds
+			atomic<uint64_t> totalNanoseconds;
+			
+			// Bytes in
+			atomic<uint64_t> bytesIn;
+			
+			// Bytes out
+			atomic<uint64_t> bytesOut;
+			
+			// Latencies
+			atomic<uint64_t> latencies[NUMBER_OF_LATENCY_BUCKETS];
+	};
+	
+	// Operation tracker class
+	class OperationTracker {
+	
+		// Public
+		public:
+		
+			// Constructor
+			OperationTracker(OperationStats &stats, size_t bytesIn) :
+			
+				// Set stats to stats
+				stats(stats),
+				
+				// Set bytes in to bytes in
+				bytesIn(bytesIn),
+				
+				// Check if number of uncaught exceptions can be counted
+				#ifdef __cpp_lib_uncaught_exceptions
+				
+					// Set number of uncaught exceptions to the current number of uncaught exceptions
+					numberOfUncaughtExceptions(uncaught_exceptions()),
+				#endif
+				
+				// Set start to now
+				start(chrono::steady_clock::now())
+			{
+			}
+			
+			// Destructor
+			~OperationTracker() {
+			
+				// Get elapsed nanoseconds
+				const uint64_t nanoseconds = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+				
+				// Check if number of uncaught exceptions can be counted
+				#ifdef __cpp_lib_uncaught_exceptions
+				
+					// Set failed to if an exception is being thrown out of the operation
+					const bool failed = uncaught_exceptions() > numberOfUncaughtExceptions;
+				
+				// Otherwise
+				#else
+				
+					// Set failed to if an exception is being thrown
+					const bool failed = uncaught_exception();
+				#endif
+				
+				// Add call to stats
+				stats.addCall(nanoseconds, failed, bytesIn);
+			}
+			
+			// Track result
+			template<typename Type> Type trackResult(Type &&result) const {
+			
+				// Add result's size to stats' bytes out
+				stats.addBytesOut(getSize(result));
+				
+				// Return result
+				return move(result);
+			}
+			
+			// Sum sizes
+			static size_t sumSizes(const size_t sizes[], size_t numberOfSizes) {
+			
+				// Go through all sizes
+				size_t result = 0;
+				for(size_t i = 0; i < numberOfSizes; ++i) {
+				
+					// Add size to result
+					result += sizes[i];
+				}
+				
+				// Return result
+				return result;
+			}
+		
+		// Private
+		private:
+		
+			// Get size
+			template<typename Allocator> static size_t getSize(const vector<uint8_t, Allocator> &value) {
+			
+				// Return value's size
+				return value.size();
+			}
+			
+			// Get size
+			static size_t getSize(const string &value) {
+			
+				// Return value's size
+				return value.size();
+			}
+			
+			// Get size
+			template<typename First, typename Second> static size_t getSize(const tuple<First, Second> &value) {
+			
+				// Return sum of the value's sizes
+				return getSize(get<0>(value)) + getSize(get<1>(value));
+			}
+			
+			// Get size
+			template<typename First, typename Second, typename Third> static size_t getSize(const tuple<First, Second, Third> &value) {
+			
+				// Return sum of the value's sizes
+				return getSize(get<0>(value)) + getSize(get<1>(value)) + getSize(get<2>(value));
+			}
+			
+			// Stats
+			OperationStats &stats;
+			
+			// Bytes in
+			const size_t bytesIn;
+			
+			// Check if number of uncaught exceptions can be counted
+			#ifdef __cpp_lib_uncaught_exceptions
+			
+				// Number of uncaught exceptions
+				const int numberOfUncaughtExceptions;
+			#endif
+			
+			// Start
+			const chrono::steady_clock::time_point start;
+	};
+#endif
+
+// Global variables
+
+// Bulletproof sessions
+static Sessions<BulletproofSession> bulletproofSessions;
+
+// Aggsig sessions
+static Sessions<AggsigSession> aggsigSessions;
+
+// Nonce pool
+static NoncePool noncePool;
+
+// Commit accumulators
+static Sessions<CommitAccumulator> commitAccumulators;
+
+// Verification cache
+static VerificationCache verificationCache;
+
+// Thread count which uses the hardware concurrency when zero
+static atomic<size_t> threadCount(0);
+
+// Thread scratch space which lets threads verify bulletproofs at the same time instead of sharing secp256k1-zkp's single scratch space
+static thread_local ThreadScratchSpace threadScratchSpace;
+
+// Rewind caches
+static Sessions<RewindCache> rewindCaches;
+
+// Secure arenas lock, secure arenas, and unused secure arenas which are never destroyed since secure memory can be released while the program exits
+static mutex *const secureArenasLock = new mutex();
+static list<SecureArena> *const secureArenas = new list<SecureArena>();
+static vector<SecureArena *> *const unusedSecureArenas = new vector<SecureArena *>();
+
+// Secure arena owners which map each arena sized part of the secure arenas memory to the arena using it
+static atomic<SecureArena *> secureArenaOwners[MAXIMUM_NUMBER_OF_SECURE_ARENAS];
+
+// Secure arena lease
+static thread_local SecureArenaLease secureArenaLease;
+
+// Current secure arena and secure arena lease released which remain usable after the current thread's secure arena lease is destroyed
+static thread_local SecureArena *currentSecureArena = nullptr;
+static thread_local bool secureArenaLeaseReleased = false;
+
+
+// Check if tracing is enabled
+#ifdef ENABLE_TRACING
+
+	// Trace lock
+	static mutex traceLock;
+	
+	// Trace file
+	static int traceFile = -1;
+	
+	// Trace events
+	static string traceEvents;
+	
+	// Trace has events
+	static bool traceHasEvents;
+	
+	// Is tracing
+	static atomic<bool> isTracing(false);
+	
+	// Check if Android
+	#ifdef __ANDROID__
+	
+		// Android trace begin section and end section which are looked up at runtime since they don't exist before API level 23
+		static void (*const androidTraceBeginSection)(const char *sectionName) = reinterpret_cast<void (*)(const char *)>(dlsym(RTLD_DEFAULT, "ATrace_beginSection"));
+		static void (*const androidTraceEndSection)() = reinterpret_cast<void (*)()>(dlsym(RTLD_DEFAULT, "ATrace_endSection"));
+	#endif
+#endif
+
+// Check if operation stats are enabled
+#ifdef ENABLE_OPERATION_STATS
+
+	// Operation stats
+	static OperationStats operationStats[static_cast<size_t>(Operation::NUMBER_OF_OPERATIONS)];
+	
+	// Operation names
+	#define OPERATION(operation, function) #function,
+	static const char *const OPERATION_NAMES[] = {
+		OPERATIONS
+	};
+	#undef OPERATION
+#endif
+
+// Command functions
+#define COMMAND(operation, function) [](const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) -> SecureBytes { return invokeCommand(function, contextSeed, contextSeedSize, arguments); },
+static SecureBytes (*const COMMAND_FUNCTIONS[])(const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) = {
+	COMMANDS
+};
+#undef COMMAND
+
+
+// Supporting function implementation
+
+// Blind switch
+SecureBytes blindSwitch(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value) {
+
+	// Track operation
+	TRACK_OPERATION(BLIND_SWITCH, blindSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if performing blind switch failed
+	SecureBytes result(Secp256k1Zkp::blindSize());
+	if(!Secp256k1Zkp::blindSwitch(result.data(), blind, blindSize, value)) {
+	
+		// Throw error
+		throw runtime_error("Performing blind switch failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Blind sum
+SecureBytes blindSum(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *positiveBlinds, size_t positiveBlindsSizes[], size_t numberOfPositiveBlinds, const uint8_t *negativeBlinds, size_t negativeBlindsSizes[], size_t numberOfNegativeBlinds) {
+
+	// Track operation
+	TRACK_OPERATION(BLIND_SUM, OperationTracker::sumSizes(positiveBlindsSizes, numberOfPositiveBlinds) + OperationTracker::sumSizes(negativeBlindsSizes, numberOfNegativeBlinds));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Initialize blinds
+	vector<const uint8_t *> blinds(numberOfPositiveBlinds + numberOfNegativeBlinds);
+	
+	// Go through all positive blinds
+	const uint8_t *blind = positiveBlinds;
+	for(size_t i = 0; i < numberOfPositiveBlinds; ++i) {
+	
+		// Check if blind is invalid
+		if(positiveBlindsSizes[i] != Secp256k1Zkp::blindSize()) {
+		
+			// Throw error
+			throw runtime_error("Blind is invalid");
+		}
+		
+		// Set blind in blinds
+		blinds[i] = blind;
+		
+		// Go to next blind
+		blind += positiveBlindsSizes[i];
+	}
+	
+	// Go through all negative blinds
+	blind = negativeBlinds;
+	for(size_t i = 0; i < numberOfNegativeBlinds; ++i) {
+	
+		// Check if blind is invalid
+		if(negativeBlindsSizes[i] != Secp256k1Zkp::blindSize()) {
+		
+			// Throw error
+			throw runtime_error("Blind is invalid");
+		}
+		
+		// Set blind in blinds
+		blinds[i + numberOfPositiveBlinds] = blind;
+		
+		// Go to next blind
+		blind += negativeBlindsSizes[i];
+	}
+	
+	// Check if performing blind sum failed
+	SecureBytes result(Secp256k1Zkp::blindSize());
+	if(!Secp256k1Zkp::secp256k1_pedersen_blind_sum(Secp256k1Zkp::context, result.data(), blinds.data(), blinds.size(), numberOfPositiveBlinds)) {
+	
+		// Throw error
+		throw runtime_error("Performing blind sum failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Is valid secret key
+bool isValidSecretKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(IS_VALID_SECRET_KEY, secretKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+
+	// Check if secret key is not a valid secret key
+	if(!Secp256k1Zkp::isValidSecretKey(secretKey, secretKeySize)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Is valid public key
+bool isValidPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(IS_VALID_PUBLIC_KEY, publicKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if public key is not a valid public key
+	if(!Secp256k1Zkp::isValidPublicKey(publicKey, publicKeySize)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Is valid commit
+bool isValidCommit(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *commit, size_t commitSize) {
+
+	// Track operation
+	TRACK_OPERATION(IS_VALID_COMMIT, commitSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if commit is not a valid commit
+	if(!Secp256k1Zkp::isValidCommit(commit, commitSize)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Is valid single-signer signature
+bool isValidSingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize) {
+
+	// Track operation
+	TRACK_OPERATION(IS_VALID_SINGLE_SIGNER_SIGNATURE, signatureSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if signature is not a valid single-signer signature
+	if(!Secp256k1Zkp::isValidSingleSignerSignature(signature, signatureSize)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Create bulletproof blindless
+vector<uint8_t> createBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value, const uint8_t *nonce, size_t nonceSize, const uint8_t *privateNonce, size_t privateNonceSize, const uint8_t *extraCommit, size_t extraCommitSize, const uint8_t *message, size_t messageSize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_BULLETPROOF, blindSize + nonceSize + privateNonceSize + extraCommitSize + messageSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if creating bulletproof failed
+	vector<uint8_t> proof(Secp256k1Zkp::bulletproofProofSize());
+	char proofSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
+	if(!Secp256k1Zkp::createBulletproof(proof.data(), proofSize, blind, blindSize, value, nonce, nonceSize, privateNonce, privateNonceSize, extraCommit, extraCommitSize, message, messageSize)) {
+	
+		// Throw error
+		throw runtime_error("Creating bulletproof failed");
+	}
+	
+	// Set proof's size to proof size
+	proof.resize(strtoull(proofSize, nullptr, 10));
+	
+	// Return proof
+	return TRACK_RESULT(proof);
+}
+
+// Create bulletproof blindless
+vector<uint8_t> createBulletproofBlindless(const uint8_t *contextSeed, size_t contextSeedSize, uint8_t *tauX, size_t tauXSize, const uint8_t *tOne, size_t tOneSize, const uint8_t *tTwo, size_t tTwoSize, const uint8_t *commit, size_t commitSize, const char *value, const uint8_t *nonce, size_t nonceSize, const uint8_t *extraCommit, size_t extraCommitSize, const uint8_t *message, size_t messageSize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_BULLETPROOF_BLINDLESS, tauXSize + tOneSize + tTwoSize + commitSize + nonceSize + extraCommitSize + messageSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if creating bulletproof blindless failed
+	vector<uint8_t> proof(Secp256k1Zkp::bulletproofProofSize());
+	char proofSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
+	if(!Secp256k1Zkp::createBulletproofBlindless(proof.data(), proofSize, tauX, tauXSize, tOne, tOneSize, tTwo, tTwoSize, commit, commitSize, value, nonce, nonceSize, extraCommit, extraCommitSize, message, messageSize)) {
+	
+		// Throw error
+		throw runtime_error("Creating bulletproof blindless failed");
+	}
+	
+	// Set proof's size to proof size
+	proof.resize(strtoull(proofSize, nullptr, 10));
+	
+	// Return proof
+	return TRACK_RESULT(proof);
+}
+
+// Rewind bulletproof
+tuple<string, SecureBytes, vector<uint8_t>> rewindBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize) {
+
+	// Track operation
+	TRACK_OPERATION(REWIND_BULLETPROOF, proofSize + commitSize + nonceSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if performing rewind bulletproof failed
+	char value[MAX_64_BIT_INTEGER_STRING_LENGTH];
+	SecureBytes blind(Secp256k1Zkp::blindSize());
+	vector<uint8_t> message(Secp256k1Zkp::bulletproofMessageSize());
+	if(!Secp256k1Zkp::rewindBulletproof(value, blind.data(), message.data(), proof, proofSize, commit, commitSize, nonce, nonceSize)) {
+	
+		// Throw error
+		throw runtime_error("Performing rewind bulletproof failed");
+	}
+	
+	// Return bulletproof data
+	return TRACK_RESULT(make_tuple(value, blind, message));
+}
+
+// Verify bulletproof
+bool verifyBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *extraCommit, size_t extraCommitSize) {
+
+	// Track operation
+	TRACK_OPERATION(VERIFY_BULLETPROOF, proofSize + commitSize + extraCommitSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if verification cache is enabled
+	string key;
+	if(verificationCache.isEnabled()) {
+	
+		// Check if bulletproof's result is cached
+		key = VerificationCache::getKey(VerificationType::BULLETPROOF, {{proof, proofSize}, {commit, commitSize}, {extraCommit, extraCommitSize}});
+		bool result;
+		if(verificationCache.get(key, result)) {
+		
+			// Return result
+			return result;
+		}
+	}
+	
+	// Verify bulletproof
+	const bool result = verifyBulletproofInThreadScratchSpace(proof, proofSize, commit, commitSize, extraCommit, extraCommitSize);
+	
+	// Check if verification cache is enabled
+	if(!key.empty()) {
+	
+		// Cache bulletproof's result
+		verificationCache.set(key, result);
+	}
+	
+	// Return result
+	return result;
+}
+
+// Public key from secret key
+vector<uint8_t> publicKeyFromSecretKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(PUBLIC_KEY_FROM_SECRET_KEY, secretKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if getting public key from secret key failed
+	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize());
+	if(!Secp256k1Zkp::publicKeyFromSecretKey(publicKey.data(), secretKey, secretKeySize)) {
+	
+		// Throw error
+		throw runtime_error("Getting public key from secret key failed");
+	}
+	
+	// Return public key
+	return TRACK_RESULT(publicKey);
+}
+
+// Public key from data
+vector<uint8_t> publicKeyFromData(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *data, size_t dataSize) {
+
+	// Track operation
+	TRACK_OPERATION(PUBLIC_KEY_FROM_DATA, dataSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if getting public key from data failed
+	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize());
+	if(!Secp256k1Zkp::publicKeyFromData(publicKey.data(), data, dataSize)) {
+	
+		// Throw error
+		throw runtime_error("Getting public key from data failed");
+	}
+	
+	// Return public key
+	return TRACK_RESULT(publicKey);
+}
+
+// Uncompress public key
+vector<uint8_t> uncompressPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(UNCOMPRESS_PUBLIC_KEY, publicKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if uncompressing the public key failed
+	vector<uint8_t> uncompressedPublicKey(Secp256k1Zkp::uncompressedPublicKeySize());
+	if(!Secp256k1Zkp::uncompressPublicKey(uncompressedPublicKey.data(), publicKey, publicKeySize)) {
+	
+		// Throw error
+		throw runtime_error("Uncompressing the public key failed");
+	}
+	
+	// Return uncompressed public key
+	return TRACK_RESULT(uncompressedPublicKey);
+}
+
+// Secret key tweak add
+SecureBytes secretKeyTweakAdd(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *tweak, size_t tweakSize) {
+
+	// Track operation
+	TRACK_OPERATION(SECRET_KEY_TWEAK_ADD, secretKeySize + tweakSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if performing secret key tweak add failed
+	SecureBytes result(Secp256k1Zkp::secretKeySize());
+	if(!Secp256k1Zkp::secretKeyTweakAdd(result.data(), secretKey, secretKeySize, tweak, tweakSize)) {
+	
+		// Throw error
+		throw runtime_error("Performing secret key tweak add failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Public key tweak add
+vector<uint8_t> publicKeyTweakAdd(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *tweak, size_t tweakSize) {
+
+	// Track operation
+	TRACK_OPERATION(PUBLIC_KEY_TWEAK_ADD, publicKeySize + tweakSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if performing public key tweak add failed
+	vector<uint8_t> result(Secp256k1Zkp::publicKeySize());
+	if(!Secp256k1Zkp::publicKeyTweakAdd(result.data(), publicKey, publicKeySize, tweak, tweakSize)) {
+	
+		// Throw error
+		throw runtime_error("Performing public key tweak add failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Secret key tweak multiply
+SecureBytes secretKeyTweakMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *tweak, size_t tweakSize) {
+
+	// Track operation
+	TRACK_OPERATION(SECRET_KEY_TWEAK_MULTIPLY, secretKeySize + tweakSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if performing secret key tweak multiply failed
+	SecureBytes result(Secp256k1Zkp::secretKeySize());
+	if(!Secp256k1Zkp::secretKeyTweakMultiply(result.data(), secretKey, secretKeySize, tweak, tweakSize)) {
+	
+		// Throw error
+		throw runtime_error("Performing secret key tweak multiply failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Public key tweak multiply
+vector<uint8_t> publicKeyTweakMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *tweak, size_t tweakSize) {
+
+	// Track operation
+	TRACK_OPERATION(PUBLIC_KEY_TWEAK_MULTIPLY, publicKeySize + tweakSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if performing public key tweak multiply failed
+	vector<uint8_t> result(Secp256k1Zkp::publicKeySize());
+	if(!Secp256k1Zkp::publicKeyTweakMultiply(result.data(), publicKey, publicKeySize, tweak, tweakSize)) {
+	
+		// Throw error
+		throw runtime_error("Performing public key tweak multiply failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Shared secret key from secret key and public key
+SecureBytes sharedSecretKeyFromSecretKeyAndPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *publicKey, size_t publicKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(SHARED_SECRET_KEY_FROM_SECRET_KEY_AND_PUBLIC_KEY, secretKeySize + publicKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if getting shared secret key from secret key and public key failed
+	SecureBytes sharedSecretKey(Secp256k1Zkp::secretKeySize());
+	if(!Secp256k1Zkp::sharedSecretKeyFromSecretKeyAndPublicKey(sharedSecretKey.data(), secretKey, secretKeySize, publicKey, publicKeySize)) {
+	
+		// Throw error
+		throw runtime_error("Getting shared secret key from secret key and public key failed");
+	}
+	
+	// Return shared secret key
+	return TRACK_RESULT(sharedSecretKey);
+}
+
+// Pedersen commit
+vector<uint8_t> pedersenCommit(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value) {
+
+	// Track operation
+	TRACK_OPERATION(PEDERSEN_COMMIT, blindSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if performing Pedersen commit failed
+	vector<uint8_t> result(Secp256k1Zkp::commitSize());
+	if(!Secp256k1Zkp::pedersenCommit(result.data(), blind, blindSize, value)) {
+	
+		// Throw error
+		throw runtime_error("Performing Pedersen commit failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Pedersen commit sum
+vector<uint8_t> pedersenCommitSum(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *positiveCommits, size_t positiveCommitsSizes[], size_t numberOfPositiveCommits, const uint8_t *negativeCommits, size_t negativeCommitsSizes[], size_t numberOfNegativeCommits) {
+
+	// Track operation
+	TRACK_OPERATION(PEDERSEN_COMMIT_SUM, OperationTracker::sumSizes(positiveCommitsSizes, numberOfPositiveCommits) + OperationTracker::sumSizes(negativeCommitsSizes, numberOfNegativeCommits));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Initialize total
+	Secp256k1Zkp::secp256k1_pedersen_commitment total;
+	bool totalIsInfinity = true;
+	
+	// Add positive commits to the total
+	accumulateCommits(total, totalIsInfinity, positiveCommits, positiveCommitsSizes, numberOfPositiveCommits, true);
+	
+	// Subtract negative commits from the total
+	accumulateCommits(total, totalIsInfinity, negativeCommits, negativeCommitsSizes, numberOfNegativeCommits, false);
+	
+	// Check if total is infinity
+	if(totalIsInfinity) {
+	
+		// Throw error
+		throw runtime_error("Performing Pedersen commit sum failed");
+	}
+	
+	// Check if serializing total failed
+	vector<uint8_t> result(Secp256k1Zkp::commitSize());
+	if(!Secp256k1Zkp::secp256k1_pedersen_commitment_serialize(Secp256k1Zkp::context, result.data(), &total)) {
+	
+		// Throw error
+		throw runtime_error("Performing Pedersen commit sum failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Pedersen commit to public key
+vector<uint8_t> pedersenCommitToPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *commit, size_t commitSize) {
+
+	// Track operation
+	TRACK_OPERATION(PEDERSEN_COMMIT_TO_PUBLIC_KEY, commitSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if getting public key from Pedersen commit failed
+	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize());
+	if(!Secp256k1Zkp::pedersenCommitToPublicKey(publicKey.data(), commit, commitSize)) {
+	
+		// Throw error
+		throw runtime_error("Getting public key from Pedersen commit failed");
+	}
+	
+	// Return public key
+	return TRACK_RESULT(publicKey);
+}
+
+// Public key to Pedersen commit
+vector<uint8_t> publicKeyToPedersenCommit(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(PUBLIC_KEY_TO_PEDERSEN_COMMIT, publicKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if getting Pedersen commit from public key failed
+	vector<uint8_t> commit(Secp256k1Zkp::commitSize());
+	if(!Secp256k1Zkp::publicKeyToPedersenCommit(commit.data(), publicKey, publicKeySize)) {
+	
+		// Throw error
+		throw runtime_error("Getting Pedersen commit from public key failed");
+	}
+	
+	// Return commit
+	return TRACK_RESULT(commit);
+}
+
+// Create single-signer signature
+vector<uint8_t> createSingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *message, size_t messageSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *secretNonce, size_t secretNonceSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *publicNonce, size_t publicNonceSize, const uint8_t *publicNonceTotal, size_t publicNonceTotalSize, const uint8_t *seed, size_t seedSize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_SINGLE_SIGNER_SIGNATURE, messageSize + secretKeySize + secretNonceSize + publicKeySize + publicNonceSize + publicNonceTotalSize + seedSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if creating single-signer signature failed
+	vector<uint8_t> signature(Secp256k1Zkp::singleSignerSignatureSize());
+	if(!Secp256k1Zkp::createSingleSignerSignature(signature.data(), message, messageSize, secretKey, secretKeySize, secretNonce, secretNonceSize, publicKey, publicKeySize, publicNonce, publicNonceSize, publicNonceTotal, publicNonceTotalSize, seed, seedSize)) {
+	
+		// Throw error
+		throw runtime_error("Creating single-signer signature failed");
+	}
+	
+	// Return signature
+	return TRACK_RESULT(signature);
+}
+
+// Add single-signer signatures
+vector<uint8_t> addSingleSignerSignatures(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signatures, size_t signaturesSizes[], size_t numberOfSignatures, const uint8_t *publicNonceTotal, size_t publicNonceTotalSize) {
+
+	// Track operation
+	TRACK_OPERATION(ADD_SINGLE_SIGNER_SIGNATURES, OperationTracker::sumSizes(signaturesSizes, numberOfSignatures) + publicNonceTotalSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if adding the first chunk of signatures failed
+	vector<uint8_t> result(Secp256k1Zkp::singleSignerSignatureSize());
+	size_t numberOfAddedSignatures = min(numberOfSignatures, SUM_CHUNK_SIZE);
+	if(!Secp256k1Zkp::addSingleSignerSignatures(result.data(), signatures, signaturesSizes, numberOfAddedSignatures, publicNonceTotal, publicNonceTotalSize)) {
+	
+		// Throw error
+		throw runtime_error("Adding single-signer signatures failed");
+	}
+	
+	// Go through all added signatures
+	const uint8_t *signature = signatures;
+	for(size_t i = 0; i < numberOfAddedSignatures; ++i) {
+	
+		// Go to next signature
+		signature += signaturesSizes[i];
+	}
+	
+	// Go through all remaining chunks of signatures
+	vector<uint8_t> chunk;
+	vector<size_t> chunkSizes;
+	while(numberOfAddedSignatures < numberOfSignatures) {
+	
+		// Set chunk to the result
+		chunk.assign(result.cbegin(), result.cend());
+		chunkSizes.assign(1, result.size());
+		
+		// Go through the chunk's signatures
+		for(; numberOfAddedSignatures < numberOfSignatures && chunkSizes.size() < SUM_CHUNK_SIZE; ++numberOfAddedSignatures) {
+		
+			// Add signature to the chunk
+			chunk.insert(chunk.cend(), signature, signature + signaturesSizes[numberOfAddedSignatures]);
+			chunkSizes.push_back(signaturesSizes[numberOfAddedSignatures]);
+			
+			// Go to next signature
+			signature += signaturesSizes[numberOfAddedSignatures];
+		}
+		
+		// Check if adding the chunk's signatures failed
+		if(!Secp256k1Zkp::addSingleSignerSignatures(result.data(), chunk.data(), chunkSizes.data(), chunkSizes.size(), publicNonceTotal, publicNonceTotalSize)) {
+		
+			// Throw error
+			throw runtime_error("Adding single-signer signatures failed");
+		}
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Verify single-signer signature
+bool verifySingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize, const uint8_t *message, size_t messageSize, const uint8_t *publicNonce, size_t publicNonceSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *publicKeyTotal, size_t publicKeyTotalSize, bool isPartial) {
+
+	// Track operation
+	TRACK_OPERATION(VERIFY_SINGLE_SIGNER_SIGNATURE, signatureSize + messageSize + publicNonceSize + publicKeySize + publicKeyTotalSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if verification cache is enabled
+	string key;
+	if(verificationCache.isEnabled()) {
+	
+		// Check if single-signer signature's result is cached
+		const uint8_t isPartialByte = isPartial;
+		key = VerificationCache::getKey(VerificationType::SINGLE_SIGNER_SIGNATURE, {{signature, signatureSize}, {message, messageSize}, {publicNonce, publicNonceSize}, {publicKey, publicKeySize}, {publicKeyTotal, publicKeyTotalSize}, {&isPartialByte, sizeof(isPartialByte)}});
+		bool result;
+		if(verificationCache.get(key, result)) {
+		
+			// Return result
+			return result;
+		}
+	}
+	
+	// Verify single-signer signature
+	const bool result = Secp256k1Zkp::verifySingleSignerSignature(signature, signatureSize, message, messageSize, publicNonce, publicNonceSize, publicKey, publicKeySize, publicKeyTotal, publicKeyTotalSize, isPartial);
+	
+	// Check if verification cache is enabled
+	if(!key.empty()) {
+	
+		// Cache single-signer signature's result
+		verificationCache.set(key, result);
+	}
+	
+	// Return result
+	return result;
+}
+
+// Single-signer signature from data
+vector<uint8_t> singleSignerSignatureFromData(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *data, size_t dataSize) {
+
+	// Track operation
+	TRACK_OPERATION(SINGLE_SIGNER_SIGNATURE_FROM_DATA, dataSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if getting single-signer signature from data failed
+	vector<uint8_t> signature(Secp256k1Zkp::singleSignerSignatureSize());
+	if(!Secp256k1Zkp::singleSignerSignatureFromData(signature.data(), data, dataSize)) {
+	
+		// Throw error
+		throw runtime_error("Getting single-signer signature from data failed");
+	}
+	
+	// Return signature
+	return TRACK_RESULT(signature);
+}
+
+// Compact single-signer signature
+vector<uint8_t> compactSingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize) {
+
+	// Track operation
+	TRACK_OPERATION(COMPACT_SINGLE_SIGNER_SIGNATURE, signatureSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if compacting single-signer signature failed
+	vector<uint8_t> result(Secp256k1Zkp::singleSignerSignatureSize());
+	if(!Secp256k1Zkp::compactSingleSignerSignature(result.data(), signature, signatureSize)) {
+	
+		// Throw error
+		throw runtime_error("Compacting single-signer signature failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Uncompact single-signer signature
+vector<uint8_t> uncompactSingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize) {
+
+	// Track operation
+	TRACK_OPERATION(UNCOMPACT_SINGLE_SIGNER_SIGNATURE, signatureSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if uncompacting single-signer signature failed
+	vector<uint8_t> result(Secp256k1Zkp::uncompactSingleSignerSignatureSize());
+	if(!Secp256k1Zkp::uncompactSingleSignerSignature(result.data(), signature, signatureSize)) {
+	
+		// Throw error
+		throw runtime_error("Uncompacting single-signer signature failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Combine public keys
+vector<uint8_t> combinePublicKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKeys, size_t publicKeysSizes[], size_t numberOfPublicKeys) {
+
+	// Track operation
+	TRACK_OPERATION(COMBINE_PUBLIC_KEYS, OperationTracker::sumSizes(publicKeysSizes, numberOfPublicKeys));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Initialize total
+	Secp256k1Zkp::secp256k1_pubkey total;
+	bool totalIsInfinity = true;
+	
+	// Go through all chunks of public keys
+	vector<Secp256k1Zkp::secp256k1_pubkey> chunk(min(numberOfPublicKeys, SUM_CHUNK_SIZE));
+	vector<const Secp256k1Zkp::secp256k1_pubkey *> chunkPointers;
+	const uint8_t *publicKey = publicKeys;
+	for(size_t i = 0; i < numberOfPublicKeys;) {
+	
+		// Check if total isn't infinity
+		chunkPointers.clear();
+		if(!totalIsInfinity) {
+		
+			// Add total to the chunk
+			chunkPointers.push_back(&total);
+		}
+		
+		// Go through the chunk's public keys
+		for(size_t j = 0; i < numberOfPublicKeys && j < chunk.size(); ++i, ++j) {
+		
+			// Check if parsing public key failed
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_parse(Secp256k1Zkp::context, &chunk[j], publicKey, publicKeysSizes[i])) {
+			
+				// Throw error
+				throw runtime_error("Combining public keys failed");
+			}
+			
+			// Add public key to the chunk
+			chunkPointers.push_back(&chunk[j]);
+			
+			// Go to next public key
+			publicKey += publicKeysSizes[i];
+		}
+		
+		// Set total to the sum of the chunk or infinity if its public keys cancel out
+		Secp256k1Zkp::secp256k1_pubkey chunkTotal;
+		totalIsInfinity = !Secp256k1Zkp::secp256k1_ec_pubkey_combine(Secp256k1Zkp::context, &chunkTotal, chunkPointers.data(), chunkPointers.size());
+		
+		// Update total
+		total = chunkTotal;
+	}
+	
+	// Check if total is infinity
+	if(totalIsInfinity) {
+	
+		// Throw error
+		throw runtime_error("Combining public keys failed");
+	}
+	
+	// Check if serializing total failed
+	vector<uint8_t> result(Secp256k1Zkp::publicKeySize());
+	size_t resultSize = result.size();
+	if(!Secp256k1Zkp::secp256k1_ec_pubkey_serialize(Secp256k1Zkp::context, result.data(), &resultSize, &total, SECP256K1_EC_COMPRESSED)) {
+	
+		// Throw error
+		throw runtime_error("Combining public keys failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Create secret nonce
+SecureBytes createSecretNonce(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *seed, size_t seedSize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_SECRET_NONCE, seedSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if creating secure nonce failed
+	SecureBytes nonce(Secp256k1Zkp::nonceSize());
+	if(!Secp256k1Zkp::createSecretNonce(nonce.data(), seed, seedSize)) {
+	
+		// Throw error
+		throw runtime_error("Creating secure nonce failed");
+	}
+	
+	// Return nonce
+	return TRACK_RESULT(nonce);
+}
+
+// Create message hash signature
+vector<uint8_t> createMessageHashSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *messageHash, size_t messageHashSize, const uint8_t *secretKey, size_t secretKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_MESSAGE_HASH_SIGNATURE, messageHashSize + secretKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if creating message hash signature failed
+	vector<uint8_t> signature(Secp256k1Zkp::maximumMessageHashSignatureSize());
+	char signatureSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
+	if(!Secp256k1Zkp::createMessageHashSignature(signature.data(), signatureSize, messageHash, messageHashSize, secretKey, secretKeySize)) {
+	
+		// Throw error
+		throw runtime_error("Creating message hash signature failed");
+	}
+	
+	// Set signature's size to signature size
+	signature.resize(strtoull(signatureSize, nullptr, 10));
+	
+	// Return signature
+	return TRACK_RESULT(signature);
+}
+
+// Verify message hash signature
+bool verifyMessageHashSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize, const uint8_t *messageHash, size_t messageHashSize, const uint8_t *publicKey, size_t publicKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(VERIFY_MESSAGE_HASH_SIGNATURE, signatureSize + messageHashSize + publicKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if message hash signature isn't verified
+	if(!Secp256k1Zkp::verifyMessageHashSignature(signature, signatureSize, messageHash, messageHashSize, publicKey, publicKeySize)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return true
+	return true;
+}
+
+// Create bulletproof session
+uint64_t createBulletproofSession(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize, const uint8_t *privateNonce, size_t privateNonceSize, const uint8_t *extraCommit, size_t extraCommitSize, const uint8_t *message, size_t messageSize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_BULLETPROOF_SESSION, blindSize + commitSize + nonceSize + privateNonceSize + extraCommitSize + messageSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return adding bulletproof session to the bulletproof sessions
+	return bulletproofSessions.add(make_shared<BulletproofSession>(blind, blindSize, value, commit, commitSize, nonce, nonceSize, privateNonce, privateNonceSize, extraCommit, extraCommitSize, message, messageSize));
+}
+
+// Bulletproof session round one
+tuple<vector<uint8_t>, vector<uint8_t>> bulletproofSessionRoundOne(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session) {
+
+	// Track operation
+	TRACK_OPERATION(BULLETPROOF_SESSION_ROUND_ONE, 0);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return performing round one with the bulletproof session
+	return TRACK_RESULT(bulletproofSessions.get(session)->roundOne());
+}
+
+// Bulletproof session round two
+vector<uint8_t> bulletproofSessionRoundTwo(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *tOne, size_t tOneSize, const uint8_t *tTwo, size_t tTwoSize) {
+
+	// Track operation
+	TRACK_OPERATION(BULLETPROOF_SESSION_ROUND_TWO, tOneSize + tTwoSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return performing round two with the bulletproof session
+	return TRACK_RESULT(bulletproofSessions.get(session)->roundTwo(tOne, tOneSize, tTwo, tTwoSize));
+}
+
+// Bulletproof session finalize
+vector<uint8_t> bulletproofSessionFinalize(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *tauX, size_t tauXSize) {
+
+	// Track operation
+	TRACK_OPERATION(BULLETPROOF_SESSION_FINALIZE, tauXSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return finalizing the bulletproof session
+	return TRACK_RESULT(bulletproofSessions.get(session)->finalize(tauX, tauXSize));
+}
+
+// Destroy bulletproof session
+void destroyBulletproofSession(uint64_t session) {
+
+	// Remove bulletproof session from the bulletproof sessions
+	bulletproofSessions.remove(session);
+}
+
+// Create aggsig session
+uint64_t createAggsigSession(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *message, size_t messageSize, const uint8_t *publicKeyTotal, size_t publicKeyTotalSize, const uint8_t *publicNonceTotal, size_t publicNonceTotalSize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_AGGSIG_SESSION, messageSize + publicKeyTotalSize + publicNonceTotalSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return adding aggsig session to the aggsig sessions
+	return aggsigSessions.add(make_shared<AggsigSession>(message, messageSize, publicKeyTotal, publicKeyTotalSize, publicNonceTotal, publicNonceTotalSize));
+}
+
+// Aggsig session partial sign
+vector<uint8_t> aggsigSessionPartialSign(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *secretNonce, size_t secretNonceSize) {
+
+	// Track operation
+	TRACK_OPERATION(AGGSIG_SESSION_PARTIAL_SIGN, secretKeySize + secretNonceSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return creating partial signature with the aggsig session
+	return TRACK_RESULT(aggsigSessions.get(session)->partialSign(secretKey, secretKeySize, secretNonce, secretNonceSize));
+}
+
+// Aggsig session partial verify
+bool aggsigSessionPartialVerify(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *signature, size_t signatureSize, const uint8_t *publicKey, size_t publicKeySize) {
+
+	// Track operation
+	TRACK_OPERATION(AGGSIG_SESSION_PARTIAL_VERIFY, signatureSize + publicKeySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return if partial signature is verified with the aggsig session
+	return aggsigSessions.get(session)->partialVerify(signature, signatureSize, publicKey, publicKeySize);
+}
+
+// Aggsig session aggregate
+vector<uint8_t> aggsigSessionAggregate(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *signatures, size_t signaturesSizes[], size_t numberOfSignatures) {
+
+	// Track operation
+	TRACK_OPERATION(AGGSIG_SESSION_AGGREGATE, OperationTracker::sumSizes(signaturesSizes, numberOfSignatures));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return aggregating signatures with the aggsig session
+	return TRACK_RESULT(aggsigSessions.get(session)->aggregate(signatures, signaturesSizes, numberOfSignatures));
+}
+
+// Aggsig session verify
+bool aggsigSessionVerify(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *signature, size_t signatureSize) {
+
+	// Track operation
+	TRACK_OPERATION(AGGSIG_SESSION_VERIFY, signatureSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return if signature is verified with the aggsig session
+	return aggsigSessions.get(session)->verify(signature, signatureSize);
+}
+
+// Destroy aggsig session
+void destroyAggsigSession(uint64_t session) {
+
+	// Remove aggsig session from the aggsig sessions
+	aggsigSessions.remove(session);
+}
+
+// Create nonce pair
+tuple<SecureBytes, vector<uint8_t>> createNoncePair(const uint8_t *contextSeed, size_t contextSeedSize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_NONCE_PAIR, 0);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return taking nonce pair from the nonce pool
+	return TRACK_RESULT(noncePool.take());
+}
+
+// Public keys from secret keys
+vector<uint8_t> publicKeysFromSecretKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKeys, size_t secretKeysSizes[], size_t numberOfSecretKeys) {
+
+	// Track operation
+	TRACK_OPERATION(PUBLIC_KEYS_FROM_SECRET_KEYS, OperationTracker::sumSizes(secretKeysSizes, numberOfSecretKeys));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Get secret keys pointers
+	const vector<const uint8_t *> secretKeysPointers = getPointers(secretKeys, secretKeysSizes, numberOfSecretKeys);
+	
+	// Get public keys in parallel
+	const size_t publicKeySize = Secp256k1Zkp::publicKeySize();
+	vector<uint8_t> result(numberOfSecretKeys * publicKeySize);
+	parallelFor(numberOfSecretKeys, [&](size_t start, size_t end) {
+	
+		// Go through the secret keys
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if secret key is invalid
+			if(secretKeysSizes[i] != Secp256k1Zkp::secretKeySize()) {
+			
+				// Throw error
+				throw runtime_error("Getting public key from secret key failed");
+			}
+		}
+		
+		// Check if getting the chunk's public keys with one shared inversion to normalize them failed
+		vector<Secp256k1Zkp::secp256k1_pubkey> publicKeys(end - start);
+		if(!Secp256k1Zkp::secp256k1_ec_pubkey_create_batch(Secp256k1Zkp::context, publicKeys.data(), &secretKeysPointers[start], end - start)) {
+		
+			// Throw error
+			throw runtime_error("Getting public key from secret key failed");
+		}
+		
+		// Go through the public keys
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if serializing public key failed
+			size_t serializedPublicKeySize = publicKeySize;
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_serialize(Secp256k1Zkp::context, &result[i * publicKeySize], &serializedPublicKeySize, &publicKeys[i - start], SECP256K1_EC_COMPRESSED)) {
+			
+				// Throw error
+				throw runtime_error("Serializing public key failed");
+			}
+		}
+	});
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Pedersen commits
+vector<uint8_t> pedersenCommits(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blinds, size_t blindsSizes[], const char *values[], size_t numberOfCommits) {
+
+	// Track operation
+	TRACK_OPERATION(PEDERSEN_COMMITS, OperationTracker::sumSizes(blindsSizes, numberOfCommits));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Get value generator's table
+	static const vector<uint8_t> pedersenValueTable = getPedersenValueTable();
+	
+	// Get blinds pointers
+	const vector<const uint8_t *> blindsPointers = getPointers(blinds, blindsSizes, numberOfCommits);
+	
+	// Get commits in parallel
+	const size_t commitSize = Secp256k1Zkp::commitSize();
+	vector<uint8_t> result(numberOfCommits * commitSize);
+	parallelFor(numberOfCommits, [&](size_t start, size_t end) {
+	
+		// Go through the blinds and values
+		vector<uint64_t> chunkValues(end - start);
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if blind is invalid
+			if(blindsSizes[i] != Secp256k1Zkp::blindSize()) {
+			
+				// Throw error
+				throw runtime_error("Performing Pedersen commit failed");
+			}
+			
+			// Get value
+			chunkValues[i - start] = valueFromString(values[i]);
+		}
+		
+		// Check if performing the chunk's Pedersen commits with one shared inversion to normalize them failed
+		vector<Secp256k1Zkp::secp256k1_pedersen_commitment> commits(end - start);
+		const bool committed = Secp256k1Zkp::secp256k1_pedersen_commit_batch(Secp256k1Zkp::context, commits.data(), &blindsPointers[start], chunkValues.data(), end - start, pedersenValueTable.data());
+		clearMemory(chunkValues.data(), chunkValues.size() * sizeof(uint64_t));
+		if(!committed) {
+		
+			// Throw error
+			throw runtime_error("Performing Pedersen commit failed");
+		}
+		
+		// Go through the commits
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if serializing commit failed
+			if(!Secp256k1Zkp::secp256k1_pedersen_commitment_serialize(Secp256k1Zkp::context, &result[i * commitSize], &commits[i - start])) {
+			
+				// Throw error
+				throw runtime_error("Performing Pedersen commit failed");
+			}
+		}
+	});
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Blind switches
+SecureBytes blindSwitches(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blinds, size_t blindsSizes[], const char *values[], size_t numberOfBlinds) {
+
+	// Track operation
+	TRACK_OPERATION(BLIND_SWITCHES, OperationTracker::sumSizes(blindsSizes, numberOfBlinds));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Get blinds pointers
+	const vector<const uint8_t *> blindsPointers = getPointers(blinds, blindsSizes, numberOfBlinds);
+	
+	// Get blind switches in parallel with the same function as a single blind switch
+	const size_t blindSize = Secp256k1Zkp::blindSize();
+	SecureBytes result(numberOfBlinds * blindSize);
+	parallelFor(numberOfBlinds, [&](size_t start, size_t end) {
+	
+		// Go through the blinds and values
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if performing blind switch failed
+			if(!Secp256k1Zkp::blindSwitch(&result[i * blindSize], blindsPointers[i], blindsSizes[i], values[i])) {
+			
+				// Throw error
+				throw runtime_error("Performing blind switch failed");
+			}
+		}
+	});
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Shared secret keys from secret key and public keys
+SecureBytes sharedSecretKeysFromSecretKeyAndPublicKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *publicKeys, size_t publicKeysSizes[], size_t numberOfPublicKeys) {
+
+	// Track operation
+	TRACK_OPERATION(SHARED_SECRET_KEYS_FROM_SECRET_KEY_AND_PUBLIC_KEYS, secretKeySize + OperationTracker::sumSizes(publicKeysSizes, numberOfPublicKeys));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if secret key isn't valid
+	if(secretKeySize != Secp256k1Zkp::secretKeySize() || !Secp256k1Zkp::secp256k1_ec_seckey_verify(Secp256k1Zkp::context, secretKey)) {
+	
+		// Throw error
+		throw runtime_error("Secret key isn't valid");
+	}
+	
+	// Get public keys pointers
+	const vector<const uint8_t *> publicKeysPointers = getPointers(publicKeys, publicKeysSizes, numberOfPublicKeys);
+	
+	// Initialize shared secret keys
+	const size_t sharedSecretKeySize = Secp256k1Zkp::secretKeySize();
+	SecureBytes result(numberOfPublicKeys * sharedSecretKeySize);
+	
+	// Try
+	try {
+	
+		// Get shared secret keys in parallel with the same derivation as a single shared secret key
+		parallelFor(numberOfPublicKeys, [&](size_t start, size_t end) {
+		
+			// Go through the public keys
+			for(size_t i = start; i < end; ++i) {
+			
+				// Check if getting shared secret key from the secret key and public key failed
+				if(!Secp256k1Zkp::sharedSecretKeyFromSecretKeyAndPublicKey(&result[i * sharedSecretKeySize], secretKey, secretKeySize, publicKeysPointers[i], publicKeysSizes[i])) {
+				
+					// Throw error
+					throw runtime_error("Getting shared secret key from secret key and public key failed");
+				}
+			}
+		});
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Clear shared secret keys that were already created
+		clearMemory(result.data(), result.size());
+		
+		// Throw error
+		throw;
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Derive child secret keys
+SecureBytes deriveChildSecretKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *chainCode, size_t chainCodeSize, uint32_t startIndex, uint32_t numberOfIndices, bool isHardened) {
+
+	// Track operation
+	TRACK_OPERATION(DERIVE_CHILD_SECRET_KEYS, secretKeySize + chainCodeSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if secret key, chain code, or indices are invalid
+	if(secretKeySize != Secp256k1Zkp::secretKeySize() || !Secp256k1Zkp::secp256k1_ec_seckey_verify(Secp256k1Zkp::context, secretKey) || chainCodeSize != CHAIN_CODE_SIZE || startIndex >= HARDENED_INDEX || numberOfIndices > HARDENED_INDEX - startIndex) {
+	
+		// Throw error
+		throw runtime_error("Secret key, chain code, or indices are invalid");
+	}
+	
+	// Check if getting public key from the secret key failed
+	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize());
+	if(!isHardened && !Secp256k1Zkp::publicKeyFromSecretKey(publicKey.data(), secretKey, secretKeySize)) {
+	
+		// Throw error
+		throw runtime_error("Getting public key from secret key failed");
+	}
+	
+	// Derive child keys in parallel
+	const size_t childKeySize = Secp256k1Zkp::secretKeySize() + CHAIN_CODE_SIZE + Secp256k1Zkp::publicKeySize();
+	SecureBytes result(numberOfIndices * childKeySize);
+	parallelFor(numberOfIndices, [&](size_t start, size_t end) {
+	
+		// Initialize data to the hardened prefix and secret key or the public key followed by an index
+		SecureBytes data;
+		if(isHardened) {
+		
+			// Set data to a zero byte and the secret key
+			data.push_back(0);
+			data.insert(data.cend(), secretKey, secretKey + secretKeySize);
+		}
+		else {
+		
+			// Set data to the public key
+			data.assign(publicKey.cbegin(), publicKey.cend());
+		}
+		data.resize(data.size() + sizeof(uint32_t));
+		
+		// Go through all child keys
+		uint8_t hmac[SHA512_DIGEST_SIZE];
+		for(size_t i = start; i < end; ++i) {
+		
+			// Set index in the data as a big endian value
+			const uint32_t index = (startIndex + i) | (isHardened ? HARDENED_INDEX : 0);
+			for(size_t j = 0; j < sizeof(index); ++j) {
+			
+				// Set index byte
+				data[data.size() - 1 - j] = index >> (j * 8);
+			}
+			
+			// Get HMAC of the data with the chain code
+			hmacSha512(hmac, chainCode, chainCodeSize, data.data(), data.size());
+			
+			// Check if tweaking the secret key by the HMAC's left half failed
+			uint8_t *childKey = &result[i * childKeySize];
+			memcpy(childKey, secretKey, secretKeySize);
+			if(!Secp256k1Zkp::secp256k1_ec_privkey_tweak_add(Secp256k1Zkp::context, childKey, hmac)) {
+			
+				// Clear HMAC and data
+				clearMemory(hmac, sizeof(hmac));
+				clearMemory(data.data(), data.size());
+				
+				// Throw error
+				throw runtime_error("Deriving child secret key failed");
+			}
+			
+			// Set child chain code to the HMAC's right half
+			memcpy(&childKey[secretKeySize], &hmac[SHA512_DIGEST_SIZE / 2], CHAIN_CODE_SIZE);
+		}
+		
+		// Clear HMAC and data
+		clearMemory(hmac, sizeof(hmac));
+		clearMemory(data.data(), data.size());
+		
+		// Go through all child keys
+		vector<const uint8_t *> childSecretKeys(end - start);
+		for(size_t i = start; i < end; ++i) {
+		
+			// Add child secret key to the list
+			childSecretKeys[i - start] = &result[i * childKeySize];
+		}
+		
+		// Check if getting the child public keys with one shared inversion to normalize them failed
+		vector<Secp256k1Zkp::secp256k1_pubkey> childPublicKeys(end - start);
+		if(!Secp256k1Zkp::secp256k1_ec_pubkey_create_batch(Secp256k1Zkp::context, childPublicKeys.data(), childSecretKeys.data(), end - start)) {
+		
+			// Throw error
+			throw runtime_error("Getting child public key failed");
+		}
+		
+		// Go through all child keys
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if serializing child public key failed
+			size_t childPublicKeySize = Secp256k1Zkp::publicKeySize();
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_serialize(Secp256k1Zkp::context, &result[i * childKeySize + secretKeySize + CHAIN_CODE_SIZE], &childPublicKeySize, &childPublicKeys[i - start], SECP256K1_EC_COMPRESSED)) {
+			
+				// Throw error
+				throw runtime_error("Getting child public key failed");
+			}
+		}
+	});
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Derive child public keys
+vector<uint8_t> deriveChildPublicKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *chainCode, size_t chainCodeSize, uint32_t startIndex, uint32_t numberOfIndices) {
+
+	// Track operation
+	TRACK_OPERATION(DERIVE_CHILD_PUBLIC_KEYS, publicKeySize + chainCodeSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if parsing public key failed
+	Secp256k1Zkp::secp256k1_pubkey parentPublicKey;
+	if(!Secp256k1Zkp::secp256k1_ec_pubkey_parse(Secp256k1Zkp::context, &parentPublicKey, publicKey, publicKeySize)) {
+	
+		// Throw error
+		throw runtime_error("Parsing public key failed");
+	}
+	
+	// Check if chain code or indices are invalid
+	if(chainCodeSize != CHAIN_CODE_SIZE || startIndex >= HARDENED_INDEX || numberOfIndices > HARDENED_INDEX - startIndex) {
+	
+		// Throw error
+		throw runtime_error("Chain code or indices are invalid");
+	}
+	
+	// Check if serializing public key failed
+	vector<uint8_t> serializedPublicKey(Secp256k1Zkp::publicKeySize());
+	size_t serializedPublicKeySize = serializedPublicKey.size();
+	if(!Secp256k1Zkp::secp256k1_ec_pubkey_serialize(Secp256k1Zkp::context, serializedPublicKey.data(), &serializedPublicKeySize, &parentPublicKey, SECP256K1_EC_COMPRESSED)) {
+	
+		// Throw error
+		throw runtime_error("Serializing public key failed");
+	}
+	
+	// Derive child keys in parallel
+	const size_t childKeySize = CHAIN_CODE_SIZE + Secp256k1Zkp::publicKeySize();
+	vector<uint8_t> result(numberOfIndices * childKeySize);
+	parallelFor(numberOfIndices, [&](size_t start, size_t end) {
+	
+		// Initialize data to the public key followed by an index
+		vector<uint8_t> data(serializedPublicKey);
+		data.resize(data.size() + sizeof(uint32_t));
+		
+		// Go through all child keys
+		uint8_t hmac[SHA512_DIGEST_SIZE];
+		vector<uint8_t> tweaks((end - start) * SHA512_DIGEST_SIZE / 2);
+		vector<const uint8_t *> tweaksPointers(end - start);
+		for(size_t i = start; i < end; ++i) {
+		
+			// Set index in the data as a big endian value
+			const uint32_t index = startIndex + i;
+			for(size_t j = 0; j < sizeof(index); ++j) {
+			
+				// Set index byte
+				data[data.size() - 1 - j] = index >> (j * 8);
+			}
+			
+			// Get HMAC of the data with the chain code
+			hmacSha512(hmac, chainCode, chainCodeSize, data.data(), data.size());
+			
+			// Set child's tweak to the HMAC's left half
+			tweaksPointers[i - start] = &tweaks[(i - start) * SHA512_DIGEST_SIZE / 2];
+			memcpy(&tweaks[(i - start) * SHA512_DIGEST_SIZE / 2], hmac, SHA512_DIGEST_SIZE / 2);
+			
+			// Set child chain code to the HMAC's right half
+			memcpy(&result[i * childKeySize], &hmac[SHA512_DIGEST_SIZE / 2], CHAIN_CODE_SIZE);
+		}
+		
+		// Check if tweaking the public key by the tweaks with one shared inversion to normalize the child public keys failed
+		vector<Secp256k1Zkp::secp256k1_pubkey> childPublicKeys(end - start);
+		if(!Secp256k1Zkp::secp256k1_ec_pubkey_tweak_add_batch(Secp256k1Zkp::context, childPublicKeys.data(), &parentPublicKey, tweaksPointers.data(), end - start)) {
+		
+			// Throw error
+			throw runtime_error("Deriving child public key failed");
+		}
+		
+		// Go through all child keys
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if serializing child public key failed
+			size_t childPublicKeySize = Secp256k1Zkp::publicKeySize();
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_serialize(Secp256k1Zkp::context, &result[i * childKeySize + CHAIN_CODE_SIZE], &childPublicKeySize, &childPublicKeys[i - start], SECP256K1_EC_COMPRESSED)) {
+			
+				// Throw error
+				throw runtime_error("Serializing child public key failed");
+			}
+		}
+	});
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Create commit accumulator
+uint64_t createCommitAccumulator(const uint8_t *contextSeed, size_t contextSeedSize) {
+
+	// Track operation
+	TRACK_OPERATION(CREATE_COMMIT_ACCUMULATOR, 0);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return adding commit accumulator to the commit accumulators
+	return commitAccumulators.add(make_shared<CommitAccumulator>());
+}
+
+// Commit accumulator add
+void commitAccumulatorAdd(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator, const uint8_t *commits, size_t commitsSizes[], size_t numberOfCommits) {
+
+	// Track operation
+	TRACK_OPERATION(COMMIT_ACCUMULATOR_ADD, OperationTracker::sumSizes(commitsSizes, numberOfCommits));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Add commits to the commit accumulator
+	commitAccumulators.get(accumulator)->add(commits, commitsSizes, numberOfCommits, true);
+}
+
+// Commit accumulator subtract
+void commitAccumulatorSubtract(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator, const uint8_t *commits, size_t commitsSizes[], size_t numberOfCommits) {
+
+	// Track operation
+	TRACK_OPERATION(COMMIT_ACCUMULATOR_SUBTRACT, OperationTracker::sumSizes(commitsSizes, numberOfCommits));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Subtract commits from the commit accumulator
+	commitAccumulators.get(accumulator)->add(commits, commitsSizes, numberOfCommits, false);
+}
+
+// Commit accumulator checkpoint
+uint64_t commitAccumulatorCheckpoint(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator) {
+
+	// Track operation
+	TRACK_OPERATION(COMMIT_ACCUMULATOR_CHECKPOINT, 0);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return creating checkpoint with the commit accumulator
+	return commitAccumulators.get(accumulator)->checkpoint();
+}
+
+// Commit accumulator restore
+void commitAccumulatorRestore(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator, uint64_t checkpoint) {
+
+	// Track operation
+	TRACK_OPERATION(COMMIT_ACCUMULATOR_RESTORE, 0);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Restore commit accumulator to the checkpoint
+	commitAccumulators.get(accumulator)->restore(checkpoint);
+}
+
+// Commit accumulator total
+vector<uint8_t> commitAccumulatorTotal(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator) {
+
+	// Track operation
+	TRACK_OPERATION(COMMIT_ACCUMULATOR_TOTAL, 0);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return getting commit accumulator's total which is empty if the total is zero
+	return TRACK_RESULT(commitAccumulators.get(accumulator)->getTotal());
+}
+
+// Destroy commit accumulator
+void destroyCommitAccumulator(uint64_t accumulator) {
+
+	// Remove commit accumulator from the commit accumulators
+	commitAccumulators.remove(accumulator);
+}
+
+// Multi scalar multiply
+vector<uint8_t> multiScalarMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *points, size_t pointsSizes[], const uint8_t *scalars, size_t scalarsSizes[], size_t numberOfPoints) {
+
+	// Track operation
+	TRACK_OPERATION(MULTI_SCALAR_MULTIPLY, OperationTracker::sumSizes(pointsSizes, numberOfPoints) + OperationTracker::sumSizes(scalarsSizes, numberOfPoints));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Get points pointers and scalars pointers
+	const vector<const uint8_t *> pointsPointers = getPointers(points, pointsSizes, numberOfPoints);
+	const vector<const uint8_t *> scalarsPointers = getPointers(scalars, scalarsSizes, numberOfPoints);
+	
+	// Parse points in parallel
+	vector<Secp256k1Zkp::secp256k1_pubkey> parsedPoints(numberOfPoints);
+	vector<const Secp256k1Zkp::secp256k1_pubkey *> parsedPointsPointers(numberOfPoints);
+	parallelFor(numberOfPoints, [&](size_t start, size_t end) {
+	
+		// Trace parsing points
+		TRACE_SPAN("parsePoints");
+		
+		// Go through the points and scalars
+		for(size_t i = start; i < end; ++i) {
+		
+			// Check if scalar is invalid
+			if(scalarsSizes[i] != Secp256k1Zkp::secretKeySize()) {
+			
+				// Throw error
+				throw runtime_error("Scalar is invalid");
+			}
+			
+			// Check if parsing point failed
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_parse(Secp256k1Zkp::context, &parsedPoints[i], pointsPointers[i], pointsSizes[i])) {
+			
+				// Throw error
+				throw runtime_error("Parsing point failed");
+			}
+			
+			// Set parsed point's pointer
+			parsedPointsPointers[i] = &parsedPoints[i];
+		}
+	});
+	
+	// Check if creating scratch space failed
+	Secp256k1Zkp::secp256k1_scratch_space *scratchSpace = Secp256k1Zkp::secp256k1_scratch_space_create(Secp256k1Zkp::context, MULTI_SCALAR_MULTIPLY_SCRATCH_SPACE_SIZE);
+	if(!scratchSpace) {
+	
+		// Throw error
+		throw runtime_error("Creating scratch space failed");
+	}
+	
+	// Perform multi scalar multiply in the scratch space in variable time
+	Secp256k1Zkp::secp256k1_pubkey total;
+	int totalIsInfinity;
+	const bool multiplied = Secp256k1Zkp::secp256k1_ecmult_multi_pubkeys(Secp256k1Zkp::context, scratchSpace, &total, &totalIsInfinity, parsedPointsPointers.data(), scalarsPointers.data(), numberOfPoints);
+	
+	// Destroy scratch space
+	Secp256k1Zkp::secp256k1_scratch_space_destroy(scratchSpace);
+	
+	// Check if performing multi scalar multiply failed
+	if(!multiplied) {
+	
+		// Throw error
+		throw runtime_error("Performing multi scalar multiply failed");
+	}
+	
+	// Check if total is infinity
+	if(totalIsInfinity) {
+	
+		// Return nothing since the products cancel out
+		return TRACK_RESULT(vector<uint8_t>());
+	}
+	
+	// Check if serializing total failed
+	vector<uint8_t> result(Secp256k1Zkp::publicKeySize());
+	size_t resultSize = result.size();
+	if(!Secp256k1Zkp::secp256k1_ec_pubkey_serialize(Secp256k1Zkp::context, result.data(), &resultSize, &total, SECP256K1_EC_COMPRESSED)) {
+	
+		// Throw error
+		throw runtime_error("Serializing multi scalar multiply result failed");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Scalar batch inverse
+SecureBytes scalarBatchInverse(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *scalars, size_t scalarsSizes[], size_t numberOfScalars) {
+
+	// Track operation
+	TRACK_OPERATION(SCALAR_BATCH_INVERSE, OperationTracker::sumSizes(scalarsSizes, numberOfScalars));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Go through all scalars
+	const vector<const uint8_t *> scalarsPointers = getPointers(scalars, scalarsSizes, numberOfScalars);
+	for(size_t i = 0; i < numberOfScalars; ++i) {
+	
+		// Check if scalar is invalid or zero
+		if(!scalarIsValid(scalarsPointers[i], scalarsSizes[i]) || scalarIsZero(scalarsPointers[i])) {
+		
+			// Throw error
+			throw runtime_error("Scalar can't be inverted");
+		}
+	}
+	
+	// Check if inverting the scalars with one shared inversion failed
+	SecureBytes result(numberOfScalars * SCALAR_SIZE);
+	if(!Secp256k1Zkp::secp256k1_scalar_batch_inverse(result.data(), scalarsPointers.data(), numberOfScalars)) {
+	
+		// Clear result
+		clearMemory(result.data(), result.size());
+		
+		// Throw error
+		throw runtime_error("Scalar can't be inverted");
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Evaluate scalar program
+SecureBytes evaluateScalarProgram(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *scalars, size_t scalarsSizes[], size_t numberOfScalars, const uint8_t *program, size_t programSize) {
+
+	// Track operation
+	TRACK_OPERATION(EVALUATE_SCALAR_PROGRAM, OperationTracker::sumSizes(scalarsSizes, numberOfScalars) + programSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if program is invalid
+	if(programSize % SCALAR_INSTRUCTION_SIZE) {
+	
+		// Throw error
+		throw runtime_error("Scalar program is invalid");
+	}
+	
+	// Go through all scalars
+	const size_t numberOfInstructions = programSize / SCALAR_INSTRUCTION_SIZE;
+	SecureBytes registers((numberOfScalars + numberOfInstructions) * SCALAR_SIZE);
+	const uint8_t *scalar = scalars;
+	for(size_t i = 0; i < numberOfScalars; ++i) {
+	
+		// Check if scalar is invalid
+		if(!scalarIsValid(scalar, scalarsSizes[i])) {
+		
+			// Clear registers
+			clearMemory(registers.data(), registers.size());
+		
+			// Throw error
+			throw runtime_error("Scalar is invalid");
+		}
+		
+		// Set scalar's register to the scalar
+		memcpy(&registers[i * SCALAR_SIZE], scalar, SCALAR_SIZE);
+		
+		// Go to next scalar
+		scalar += scalarsSizes[i];
+	}
+	
+	// Go through all instructions
+	for(size_t i = 0; i < numberOfInstructions; ++i) {
+	
+		// Get instruction's operation and operands
+		const uint8_t *instruction = &program[i * SCALAR_INSTRUCTION_SIZE];
+		const size_t firstOperand = (static_cast<size_t>(instruction[1]) << 8) | instruction[2];
+		const size_t secondOperand = (static_cast<size_t>(instruction[3]) << 8) | instruction[4];
+		
+		// Check if operands don't refer to previous registers
+		if(firstOperand >= numberOfScalars + i || secondOperand >= numberOfScalars + i) {
+		
+			// Clear registers
+			clearMemory(registers.data(), registers.size());
+			
+			// Throw error
+			throw runtime_error("Scalar program operand is invalid");
+		}
+		
+		// Check if operation is invalid
+		if(instruction[0] > static_cast<uint8_t>(ScalarOperation::INVERSE)) {
+		
+			// Clear registers
+			clearMemory(registers.data(), registers.size());
+			
+			// Throw error
+			throw runtime_error("Scalar program operation is invalid");
+		}
+	}
+	
+	// Check if running the program on the registers failed which only happens when inverting zero
+	if(!Secp256k1Zkp::secp256k1_scalar_program_evaluate(registers.data(), numberOfScalars, program, numberOfInstructions)) {
+	
+		// Clear registers
+		clearMemory(registers.data(), registers.size());
+		
+		// Throw error
+		throw runtime_error("Scalar can't be inverted");
+	}
+	
+	// Get instructions' results
+	SecureBytes result(registers.cbegin() + numberOfScalars * SCALAR_SIZE, registers.cend());
+	
+	// Clear registers
+	clearMemory(registers.data(), registers.size());
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Execute commands
+SecureBytes executeCommands(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *commands, size_t commandsSize) {
+
+	// Track operation
+	TRACK_OPERATION(EXECUTE_COMMANDS, commandsSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Initialize read big-endian size
+	auto readSize = [&commands, &commandsSize](size_t &offset) -> size_t {
+	
+		// Check if size isn't in the commands
+		if(commandsSize - offset < COMMAND_ARGUMENT_SIZE_SIZE) {
+		
+			// Throw error
+			throw runtime_error("Commands are invalid");
+		}
+		
+		// Go through all of the size's bytes
+		size_t result = 0;
+		for(size_t i = 0; i < COMMAND_ARGUMENT_SIZE_SIZE; ++i) {
+		
+			// Include byte in the result
+			result = (result << CHAR_BIT) | commands[offset++];
+		}
+		
+		// Return result
+		return result;
+	};
+	
+	// Go through all commands
+	vector<CommandOperation> operations;
+	vector<vector<SecureBytes>> arguments;
+	vector<vector<size_t>> references;
+	vector<size_t> levels;
+	size_t numberOfLevels = 0;
+	for(size_t offset = 0; offset < commandsSize;) {
+	
+		// Check if command's operation or number of arguments aren't in the commands or the operation is invalid
+		if(commandsSize - offset < 2 || commands[offset] >= static_cast<uint8_t>(CommandOperation::NUMBER_OF_COMMANDS)) {
+		
+			// Throw error
+			throw runtime_error("Commands are invalid");
+		}
+		
+		// Add command's operation and arguments
+		operations.push_back(static_cast<CommandOperation>(commands[offset++]));
+		arguments.emplace_back(commands[offset++]);
+		references.emplace_back(arguments.back().size(), SIZE_MAX);
+		levels.push_back(0);
+		
+		// Go through all of the command's arguments
+		for(size_t i = 0; i < arguments.back().size(); ++i) {
+		
+			// Check if argument's type isn't in the commands
+			if(offset == commandsSize) {
+			
+				// Throw error
+				throw runtime_error("Commands are invalid");
+			}
+			
+			// Check argument's type
+			switch(static_cast<CommandArgumentType>(commands[offset++])) {
+			
+				// Data
+				case CommandArgumentType::DATA: {
+				
+					// Check if argument's data isn't in the commands
+					const size_t size = readSize(offset);
+					if(commandsSize - offset < size) {
+					
+						// Throw error
+						throw runtime_error("Commands are invalid");
+					}
+					
+					// Set argument to its data
+					arguments.back()[i].assign(&commands[offset], &commands[offset + size]);
+					offset += size;
+					
+					// Break
+					break;
+				}
+				
+				// Reference
+				case CommandArgumentType::REFERENCE: {
+				
+					// Check if argument doesn't reference a previous command
+					const size_t reference = readSize(offset);
+					if(reference >= operations.size() - 1) {
+					
+						// Throw error
+						throw runtime_error("Commands are invalid");
+					}
+					
+					// Set argument's reference
+					references.back()[i] = reference;
+					
+					// Run command after the referenced command
+					levels.back() = max(levels.back(), levels[reference] + 1);
+					
+					// Break
+					break;
+				}
+				
+				// Default
+				default:
+				
+					// Throw error
+					throw runtime_error("Commands are invalid");
+			}
+		}
+		
+		// Update number of levels
+		numberOfLevels = max(numberOfLevels, levels.back() + 1);
+	}
+	
+	// Go through all levels
+	vector<SecureBytes> results(operations.size());
+	vector<uint8_t> succeeded(operations.size());
+	vector<size_t> levelCommands;
+	for(size_t level = 0; level < numberOfLevels; ++level) {
+	
+		// Get the level's commands
+		levelCommands.clear();
+		for(size_t i = 0; i < operations.size(); ++i) {
+		
+			// Check if command is in the level
+			if(levels[i] == level) {
+			
+				// Add command to the level's commands
+				levelCommands.push_back(i);
+			}
+		}
+		
+		// Run the level's commands in parallel since they don't depend on each other
+		parallelFor(levelCommands.size(), [&](size_t start, size_t end) {
+		
+			// Go through the commands
+			for(size_t i = start; i < end; ++i) {
+			
+				// Go through all of the command's arguments
+				const size_t command = levelCommands[i];
+				bool referencesSucceeded = true;
+				for(size_t j = 0; j < arguments[command].size(); ++j) {
+				
+					// Check if argument is a reference
+					if(references[command][j] != SIZE_MAX) {
+					
+						// Set argument to the referenced command's result
+						referencesSucceeded = referencesSucceeded && succeeded[references[command][j]];
+						arguments[command][j] = results[references[command][j]];
+					}
+				}
+				
+				// Check if all referenced commands succeeded
+				if(referencesSucceeded) {
+				
+					// Try
+					try {
+					
+						// Run command
+						results[command] = COMMAND_FUNCTIONS[static_cast<size_t>(operations[command])](contextSeed, contextSeedSize, arguments[command]);
+						succeeded[command] = true;
+					}
+					
+					// Catch errors
+					catch(...) {
+					
+						// Leave command as failed
+					}
+				}
+				
+				// Go through all of the command's arguments
+				for(SecureBytes &argument : arguments[command]) {
+				
+					// Clear argument
+					clearMemory(argument.data(), argument.size());
+				}
+			}
+		});
+	}
+	
+	// Go through all results
+	SecureBytes result;
+	for(size_t i = 0; i < results.size(); ++i) {
+	
+		// Append result's status to the result
+		result.push_back(succeeded[i]);
+		
+		// Go through all of the result's size's bytes
+		for(size_t j = COMMAND_ARGUMENT_SIZE_SIZE; j; --j) {
+		
+			// Append byte to the result
+			result.push_back((results[i].size() >> ((j - 1) * CHAR_BIT)) & UINT8_MAX);
+		}
+		
+		// Append result's data to the result
+		result.insert(result.cend(), results[i].cbegin(), results[i].cend());
+		
+		// Clear result's data
+		clearMemory(results[i].data(), results[i].size());
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
+
+// Set verification cache capacity
+void setVerificationCacheCapacity(size_t capacity) {
+
+	// Set verification cache's capacity
+	verificationCache.setCapacity(capacity);
+}
+
+// Get verification cache statistics
+tuple<uint64_t, uint64_t, uint64_t> getVerificationCacheStatistics() {
+
+	// Return verification cache's statistics
+	return verificationCache.getStatistics();
+}
+
+// Set thread count
+void setThreadCount(size_t count) {
+
+	// Set thread count
+	threadCount.store(count, memory_order_relaxed);
+}
+
+// Open rewind cache
+uint64_t openRewindCache(const uint8_t *contextSeed, size_t contextSeedSize, const char *path, const uint8_t *key, size_t keySize) {
+
+	// Track operation
+	TRACK_OPERATION(OPEN_REWIND_CACHE, keySize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Return adding rewind cache to the rewind caches
+	return rewindCaches.add(make_shared<RewindCache>(path, key, keySize));
+}
+
+// Rewind bulletproof with cache
+tuple<string, SecureBytes, vector<uint8_t>> rewindBulletproofWithCache(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t cache, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize) {
+
+	// Track operation
+	TRACK_OPERATION(REWIND_BULLETPROOF_WITH_CACHE, proofSize + commitSize + nonceSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if commit was already classified by the rewind cache
+	const shared_ptr<RewindCache> rewindCache = rewindCaches.get(cache);
+	string cachedValue;
+	SecureBytes cachedBlind;
+	vector<uint8_t> cachedMessage;
+	switch(rewindCache->get(commit, commitSize, nonce, nonceSize, cachedValue, cachedBlind, cachedMessage)) {
+	
+		// Ours
+		case RewindCache::Status::OURS:
+		
+			// Return bulletproof data
+			return TRACK_RESULT(make_tuple(cachedValue, cachedBlind, cachedMessage));
+		
+		// Not ours
+		case RewindCache::Status::NOT_OURS:
+		
+			// Throw error
+			throw runtime_error("Performing rewind bulletproof failed");
+		
+		// Default
+		default:
+		
+			// Break
+			break;
+	}
+	
+	// Check if performing rewind bulletproof failed
+	char value[MAX_64_BIT_INTEGER_STRING_LENGTH];
+	SecureBytes blind(Secp256k1Zkp::blindSize());
+	vector<uint8_t> message(Secp256k1Zkp::bulletproofMessageSize());
+	if(!Secp256k1Zkp::rewindBulletproof(value, blind.data(), message.data(), proof, proofSize, commit, commitSize, nonce, nonceSize)) {
+	
+		// Check if commit is valid and proof verifies for it
+		if(verifyBulletproofInThreadScratchSpace(proof, proofSize, commit, commitSize, nullptr, 0)) {
+		
+			// Cache that commit isn't ours since the rewind failing isn't caused by a malformed commit or proof
+			rewindCache->put(commit, commitSize, nonce, nonceSize, RewindCache::Status::NOT_OURS, nullptr, nullptr, nullptr);
+		}
+		
+		// Throw error
+		throw runtime_error("Performing rewind bulletproof failed");
+	}
+	
+	// Cache commit's bulletproof data
+	rewindCache->put(commit, commitSize, nonce, nonceSize, RewindCache::Status::OURS, value, blind.data(), message.data());
+	
+	// Return bulletproof data
+	return TRACK_RESULT(make_tuple(value, blind, message));
+}
+
+// Close rewind cache
+void closeRewindCache(uint64_t cache) {
+
+	// Remove rewind cache from the rewind caches
+	rewindCaches.remove(cache);
+}
+
+// Scan outputs
+tuple<uint64_t, uint64_t> scanOutputs(const uint8_t *contextSeed, size_t contextSeedSize, const char *inputPath, uint64_t startOffset, const char *outputPath, const uint8_t *nonce, size_t nonceSize) {
+
+	// Track operation
+	TRACK_OPERATION(SCAN_OUTPUTS, nonceSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if opening input file failed
+	const int inputFile = open(inputPath, O_RDONLY | O_CLOEXEC);
+	if(inputFile == -1) {
+	
+		// Throw error
+		throw runtime_error("Opening input file failed");
+	}
+	
+	// Check if getting input file's size failed
+	struct stat inputFileStatus;
+	if(fstat(inputFile, &inputFileStatus)) {
+	
+		// Close input file
+		close(inputFile);
+		
+		// Throw error
+		throw runtime_error("Getting input file's size failed");
+	}
+	
+	// Check if input file doesn't have any new data since the start offset
+	const size_t inputSize = inputFileStatus.st_size;
+	if(inputSize <= startOffset) {
+	
+		// Close input file
+		close(inputFile);
+		
+		// Return start offset and no matches
+		return tuple<uint64_t, uint64_t>{startOffset, 0};
+	}
+	
+	// Check if mapping input file failed
+	void *mapping = mmap(nullptr, inputSize, PROT_READ, MAP_SHARED, inputFile, 0);
+	close(inputFile);
+	if(mapping == MAP_FAILED) {
+	
+		// Throw error
+		throw runtime_error("Mapping input file failed");
+	}
+	const uint8_t *input = static_cast<const uint8_t *>(mapping);
+	
+	// Hint that the input file will be read sequentially
+	madvise(mapping, inputSize, MADV_SEQUENTIAL);
+	
+	// Check if opening output file failed
+	const int outputFile = open(outputPath, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR);
+	if(outputFile == -1) {
+	
+		// Unmap input file
+		munmap(mapping, inputSize);
+		
+		// Throw error
+		throw runtime_error("Opening output file failed");
+	}
+	
+	// Check if getting output file's size failed
+	struct stat outputFileStatus;
+	if(fstat(outputFile, &outputFileStatus)) {
+	
+		// Close output file
+		close(outputFile);
+		
+		// Unmap input file
+		munmap(mapping, inputSize);
+		
+		// Throw error
+		throw runtime_error("Getting output file's size failed");
+	}
+	
+	// Try
+	size_t offset = startOffset;
+	uint64_t numberOfMatches = 0;
+	try {
+	
+		// Initialize batch records and matches
+		const size_t commitSize = Secp256k1Zkp::commitSize();
+		const size_t matchSize = commitSize + sizeof(uint64_t) + Secp256k1Zkp::blindSize() + Secp256k1Zkp::bulletproofMessageSize();
+		vector<pair<const uint8_t *, size_t>> records;
+		records.reserve(SCAN_BATCH_SIZE);
+		SecureBytes matches(SCAN_BATCH_SIZE * matchSize);
+		vector<uint8_t> isMatch(SCAN_BATCH_SIZE);
+		const size_t pageSize = sysconf(_SC_PAGESIZE);
+		
+		// Loop while not at the end of the input file's complete records
+		while(true) {
+		
+			// Go through all complete records in the batch
+			records.clear();
+			while(records.size() < SCAN_BATCH_SIZE && inputSize - offset >= commitSize + SCAN_PROOF_SIZE_SIZE) {
+			
+				// Get record's proof size
+				const uint8_t *record = &input[offset];
+				size_t proofSize = 0;
+				for(size_t i = 0; i < SCAN_PROOF_SIZE_SIZE; ++i) {
+				
+					// Include byte in the proof size
+					proofSize = (proofSize << CHAR_BIT) | record[commitSize + i];
+				}
+				
+				// Check if record is incomplete
+				if(inputSize - offset - commitSize - SCAN_PROOF_SIZE_SIZE < proofSize) {
+				
+					// Break
+					break;
+				}
+				
+				// Add record to the batch
+				records.emplace_back(record, proofSize);
+				offset += commitSize + SCAN_PROOF_SIZE_SIZE + proofSize;
+			}
+			
+			// Check if batch is empty
+			if(records.empty()) {
+			
+				// Break
+				break;
+			}
+			
+			// Prefetch a batch sized amount of the next data while this batch is rewound
+			const size_t batchSize = &input[offset] - records.front().first;
+			const size_t prefetchStart = offset / pageSize * pageSize;
+			madvise(const_cast<uint8_t *>(&input[prefetchStart]), min(inputSize - prefetchStart, offset - prefetchStart + batchSize), MADV_WILLNEED);
+			
+			// Rewind batch's records in parallel
+			parallelFor(records.size(), [&](size_t start, size_t end) {
+			
+				// Go through the records
+				for(size_t i = start; i < end; ++i) {
+				
+					// Check if performing rewind bulletproof on the record succeeded
+					const uint8_t *commit = records[i].first;
+					char value[MAX_64_BIT_INTEGER_STRING_LENGTH];
+					uint8_t *match = &matches[i * matchSize];
+					isMatch[i] = Secp256k1Zkp::rewindBulletproof(value, &match[commitSize + sizeof(uint64_t)], &match[commitSize + sizeof(uint64_t) + Secp256k1Zkp::blindSize()], &commit[commitSize + SCAN_PROOF_SIZE_SIZE], records[i].second, commit, commitSize, nonce, nonceSize);
+					if(isMatch[i]) {
+					
+						// Set match's commit and value
+						memcpy(match, commit, commitSize);
+						const uint64_t valueNumber = valueFromString(value);
+						for(size_t j = 0; j < sizeof(uint64_t); ++j) {
+						
+							// Set value byte
+							match[commitSize + j] = valueNumber >> ((sizeof(uint64_t) - 1 - j) * CHAR_BIT);
+						}
+					}
+				}
+			});
+			
+			// Go through all records in the batch
+			for(size_t i = 0; i < records.size(); ++i) {
+			
+				// Check if record is a match
+				if(isMatch[i]) {
+				
+					// Write match to the output file
+					writeAll(outputFile, &matches[i * matchSize], matchSize);
+					
+					// Increment number of matches
+					++numberOfMatches;
+				}
+			}
+			
+			// Clear batch's matches including anything a failed rewind left behind
+			clearMemory(matches.data(), records.size() * matchSize);
+		}
+		
+		// Clear matches
+		clearMemory(matches.data(), matches.size());
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Check if removing the matches that were written so that retrying from the start offset doesn't duplicate them failed
+		if(ftruncate(outputFile, outputFileStatus.st_size)) {
+		
+			// Leave output file as is since the original error is rethrown
+		}
+		
+		// Close output file
+		close(outputFile);
+		
+		// Unmap input file
+		munmap(mapping, inputSize);
+		
+		// Throw error
+		throw;
+	}
+	
+	// Close output file
+	close(outputFile);
+	
+	// Unmap input file
+	munmap(mapping, inputSize);
+	
+	// Return offset after the last complete record and number of matches
+	return tuple<uint64_t, uint64_t>{offset, numberOfMatches};
+}
+
+// Aggregate transactions
+tuple<vector<uint8_t>, vector<uint8_t>, vector<uint8_t>> aggregateTransactions(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *inputs, size_t inputsSizes[], size_t numberOfInputs, const uint8_t *outputs, size_t outputsSizes[], size_t numberOfOutputs, const uint8_t *kernelExcesses, size_t kernelExcessesSizes[], size_t numberOfKernelExcesses, const uint8_t *offsets, size_t offsetsSizes[], size_t numberOfOffsets, const char *fees[], size_t numberOfFees) {
+
+	// Track operation
+	TRACK_OPERATION(AGGREGATE_TRANSACTIONS, OperationTracker::sumSizes(inputsSizes, numberOfInputs) + OperationTracker::sumSizes(outputsSizes, numberOfOutputs) + OperationTracker::sumSizes(kernelExcessesSizes, numberOfKernelExcesses) + OperationTracker::sumSizes(offsetsSizes, numberOfOffsets));
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Get inputs, outputs, kernel excesses, and offsets pointers
+	const vector<const uint8_t *> inputsPointers = getPointers(inputs, inputsSizes, numberOfInputs);
+	const vector<const uint8_t *> outputsPointers = getPointers(outputs, outputsSizes, numberOfOutputs);
+	const vector<const uint8_t *> kernelExcessesPointers = getPointers(kernelExcesses, kernelExcessesSizes, numberOfKernelExcesses);
+	const vector<const uint8_t *> offsetsPointers = getPointers(offsets, offsetsSizes, numberOfOffsets);
+	
+	// Go through all inputs, outputs, and kernel excesses
+	const size_t commitSize = Secp256k1Zkp::commitSize();
+	for(size_t i = 0; i < numberOfInputs + numberOfOutputs + numberOfKernelExcesses; ++i) {
+	
+		// Check if commit is invalid
+		if((i < numberOfInputs ? inputsSizes[i] : (i < numberOfInputs + numberOfOutputs ? outputsSizes[i - numberOfInputs] : kernelExcessesSizes[i - numberOfInputs - numberOfOutputs])) != commitSize) {
+		
+			// Throw error
+			throw runtime_error("Commit is invalid");
+		}
+	}
+	
+	// Go through all offsets
+	for(size_t i = 0; i < numberOfOffsets; ++i) {
+	
+		// Check if offset is invalid
+		if(!scalarIsValid(offsetsPointers[i], offsetsSizes[i])) {
+		
+			// Throw error
+			throw runtime_error("Offset is invalid");
+		}
+	}
+	
+	// Go through all fees
+	uint64_t totalFee = 0;
+	for(size_t i = 0; i < numberOfFees; ++i) {
+	
+		// Check if total fee overflows
+		const uint64_t fee = valueFromString(fees[i]);
+		if(fee > UINT64_MAX - totalFee) {
+		
+			// Throw error
+			throw runtime_error("Fees are invalid");
+		}
+		
+		// Add fee to the total fee
+		totalFee += fee;
+	}
+	
+	// Go through all outputs
+	CommitIndex index(numberOfInputs + numberOfOutputs, commitSize);
+	vector<uint8_t> isCutThrough(numberOfInputs + numberOfOutputs, false);
+	for(size_t i = 0; i < numberOfOutputs; ++i) {
+	
+		// Check if output is a duplicate
+		if(index.findOrAdd(outputsPointers[i], i) != CommitIndex::NO_ENTRY) {
+		
+			// Throw error
+			throw runtime_error("Duplicate output");
+		}
+	}
+	
+	// Go through all inputs
+	for(size_t i = 0; i < numberOfInputs; ++i) {
+	
+		// Check if input spends an output or is a duplicate
+		const size_t match = index.findOrAdd(inputsPointers[i], numberOfOutputs + i);
+		if(match != CommitIndex::NO_ENTRY) {
+		
+			// Check if input is a duplicate of another input or an already spent output
+			if(match >= numberOfOutputs || isCutThrough[match]) {
+			
+				// Throw error
+				throw runtime_error("Duplicate input");
+			}
+			
+			// Cut through the input and the output it spends
+			isCutThrough[match] = true;
+			isCutThrough[numberOfOutputs + i] = true;
+		}
+	}
+	
+	// Initialize positive and negative commits
+	vector<Secp256k1Zkp::secp256k1_pedersen_commitment> positiveCommits;
+	positiveCommits.reserve(numberOfOutputs + 1);
+	vector<Secp256k1Zkp::secp256k1_pedersen_commitment> negativeCommits;
+	negativeCommits.reserve(numberOfInputs + numberOfKernelExcesses);
+	
+	// Initialize parse commit
+	auto parseCommit = [](vector<Secp256k1Zkp::secp256k1_pedersen_commitment> &commits, const uint8_t *commit) {
+	
+		// Check if parsing commit failed
+		commits.emplace_back();
+		if(!Secp256k1Zkp::secp256k1_pedersen_commitment_parse(Secp256k1Zkp::context, &commits.back(), commit)) {
+		
+			// Throw error
+			throw runtime_error("Commit is invalid");
+		}
+	};
+	
+	// Go through all outputs
+	vector<uint8_t> remainingOutputs;
+	remainingOutputs.reserve(numberOfOutputs * commitSize);
+	for(size_t i = 0; i < numberOfOutputs; ++i) {
+	
+		// Check if output wasn't cut through
+		if(!isCutThrough[i]) {
+		
+			// Add output to the remaining outputs and positive commits
+			remainingOutputs.insert(remainingOutputs.cend(), outputsPointers[i], outputsPointers[i] + commitSize);
+			parseCommit(positiveCommits, outputsPointers[i]);
+		}
+	}
+	
+	// Go through all inputs
+	vector<uint8_t> remainingInputs;
+	remainingInputs.reserve(numberOfInputs * commitSize);
+	for(size_t i = 0; i < numberOfInputs; ++i) {
+	
+		// Check if input wasn't cut through
+		if(!isCutThrough[numberOfOutputs + i]) {
+		
+			// Add input to the remaining inputs and negative commits
+			remainingInputs.insert(remainingInputs.cend(), inputsPointers[i], inputsPointers[i] + commitSize);
+			parseCommit(negativeCommits, inputsPointers[i]);
+		}
+	}
+	
+	// Go through all kernel excesses
+	for(size_t i = 0; i < numberOfKernelExcesses; ++i) {
+	
+		// Add kernel excess to the negative commits
+		parseCommit(negativeCommits, kernelExcessesPointers[i]);
+	}
+	
+	// Initialize offset and negated offset
+	vector<uint8_t> offset(Secp256k1Zkp::blindSize());
+	uint8_t negatedOffset[SCALAR_SIZE];
+	
+	// Check if offsets exist
+	if(numberOfOffsets) {
+	
+		// Sum offsets
+		scalarSum(offset.data(), offsetsPointers.data(), numberOfOffsets, numberOfOffsets);
+		scalarSum(negatedOffset, offsetsPointers.data(), numberOfOffsets, 0);
+	}
+	
+	// Otherwise
+	else {
+	
+		// Clear negated offset
+		memset(negatedOffset, 0, sizeof(negatedOffset));
+	}
+	
+	// Check if the offset or fee contribute to the balance
+	if(totalFee || !scalarIsZero(negatedOffset)) {
+	
+		// Check if committing to the negated offset and total fee failed
+		const string totalFeeString = to_string(totalFee);
+		vector<uint8_t> offsetCommit(commitSize);
+		if(!Secp256k1Zkp::pedersenCommit(offsetCommit.data(), negatedOffset, sizeof(negatedOffset), totalFeeString.c_str())) {
+		
+			// Clear negated offset
+			clearMemory(negatedOffset, sizeof(negatedOffset));
+			
+			// Throw error
+			throw runtime_error("Performing Pedersen commit failed");
+		}
+		
+		// Add offset commit to the positive commits
+		parseCommit(positiveCommits, offsetCommit.data());
+	}
+	
+	// Clear negated offset
+	clearMemory(negatedOffset, sizeof(negatedOffset));
+	
+	// Get positive and negative commits pointers
+	vector<const Secp256k1Zkp::secp256k1_pedersen_commitment *> positiveCommitsPointers(positiveCommits.size());
+	for(size_t i = 0; i < positiveCommits.size(); ++i) {
+	
+		// Set positive commit pointer
+		positiveCommitsPointers[i] = &positiveCommits[i];
+	}
+	vector<const Secp256k1Zkp::secp256k1_pedersen_commitment *> negativeCommitsPointers(negativeCommits.size());
+	for(size_t i = 0; i < negativeCommits.size(); ++i) {
+	
+		// Set negative commit pointer
+		negativeCommitsPointers[i] = &negativeCommits[i];
+	}
+	
+	// Check if the aggregate transaction doesn't balance
+	if(!Secp256k1Zkp::secp256k1_pedersen_verify_tally(Secp256k1Zkp::context, positiveCommitsPointers.data(), positiveCommitsPointers.size(), negativeCommitsPointers.data(), negativeCommitsPointers.size())) {
+	
+		// Throw error
+		throw runtime_error("Transactions don't balance");
+	}
+	
+	// Return remaining inputs, remaining outputs, and offset
+	return TRACK_RESULT(make_tuple(remainingInputs, remainingOutputs, offset));
+}
+
+// Validate block
+tuple<uint8_t, uint64_t> validateBlock(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *inputs, size_t inputsSizes[], size_t numberOfInputs, const uint8_t *outputs, size_t outputsSizes[], size_t numberOfOutputs, const uint8_t *proofs, size_t proofsSizes[], size_t numberOfProofs, const uint8_t *kernelExcesses, size_t kernelExcessesSizes[], size_t numberOfKernelExcesses, const uint8_t *signatures, size_t signaturesSizes[], size_t numberOfSignatures, const uint8_t *messages, size_t messagesSizes[], size_t numberOfMessages, const uint8_t *offset, size_t offsetSize, const char *reward) {
+
+	// Track operation
+	TRACK_OPERATION(VALIDATE_BLOCK, OperationTracker::sumSizes(inputsSizes, numberOfInputs) + OperationTracker::sumSizes(outputsSizes, numberOfOutputs) + OperationTracker::sumSizes(proofsSizes, numberOfProofs) + OperationTracker::sumSizes(kernelExcessesSizes, numberOfKernelExcesses) + OperationTracker::sumSizes(signaturesSizes, numberOfSignatures) + OperationTracker::sumSizes(messagesSizes, numberOfMessages) + offsetSize);
+	
+	// Initialize
+	initialize(contextSeed, contextSeedSize);
+	
+	// Check if the number of proofs, signatures, or messages doesn't match what they belong to
+	if(numberOfProofs != numberOfOutputs || numberOfSignatures != numberOfKernelExcesses || numberOfMessages != numberOfKernelExcesses) {
+	
+		// Throw error
+		throw runtime_error("Block is invalid");
+	}
+	
+	// Check if offset is invalid
+	if(!scalarIsValid(offset, offsetSize)) {
+	
+		// Throw error
+		throw runtime_error("Offset is invalid");
+	}
+	
+	// Get reward
+	const uint64_t rewardValue = valueFromString(reward);
+	
+	// Get inputs, outputs, proofs, kernel excesses, signatures, and messages pointers
+	const vector<const uint8_t *> inputsPointers = getPointers(inputs, inputsSizes, numberOfInputs);
+	const vector<const uint8_t *> outputsPointers = getPointers(outputs, outputsSizes, numberOfOutputs);
+	const vector<const uint8_t *> proofsPointers = getPointers(proofs, proofsSizes, numberOfProofs);
+	const vector<const uint8_t *> kernelExcessesPointers = getPointers(kernelExcesses, kernelExcessesSizes, numberOfKernelExcesses);
+	const vector<const uint8_t *> signaturesPointers = getPointers(signatures, signaturesSizes, numberOfSignatures);
+	const vector<const uint8_t *> messagesPointers = getPointers(messages, messagesSizes, numberOfMessages);
+	
+	// Initialize failure
+	mutex failureLock;
+	atomic<bool> failed(false);
+	BlockValidationResult failureResult = BlockValidationResult::VALID;
+	uint64_t failureIndex = 0;
+	
+	// Initialize fail
+	auto fail = [&failureLock, &failed, &failureResult, &failureIndex](BlockValidationResult result, uint64_t index) {
+	
+		// Lock failure
+		lock_guard<mutex> guard(failureLock);
+		
+		// Check if no failure has been recorded yet
+		if(!failed) {
+		
+			// Record failure
+			failureResult = result;
+			failureIndex = index;
+			failed = true;
+		}
+	};
+	
+	// Parse all inputs, outputs, and kernel excesses once in parallel
+	const size_t commitSize = Secp256k1Zkp::commitSize();
+	const size_t numberOfCommits = numberOfInputs + numberOfOutputs + numberOfKernelExcesses;
+	vector<Secp256k1Zkp::secp256k1_pedersen_commitment> commits(numberOfCommits);
+	parallelFor(numberOfCommits, [&](size_t start, size_t end) {
+	
+		// Trace parsing commits
+		TRACE_SPAN("parseCommits");
+		
+		// Go through the commits while no failure has occurred
+		for(size_t i = start; i < end && !failed; ++i) {
+		
+			// Get commit's kind, index, data, and size
+			const BlockValidationResult kind = i < numberOfInputs ? BlockValidationResult::INVALID_INPUT : (i < numberOfInputs + numberOfOutputs ? BlockValidationResult::INVALID_OUTPUT : BlockValidationResult::INVALID_KERNEL_EXCESS);
+			const size_t index = kind == BlockValidationResult::INVALID_INPUT ? i : (kind == BlockValidationResult::INVALID_OUTPUT ? i - numberOfInputs : i - numberOfInputs - numberOfOutputs);
+			const uint8_t *commit = kind == BlockValidationResult::INVALID_INPUT ? inputsPointers[index] : (kind == BlockValidationResult::INVALID_OUTPUT ? outputsPointers[index] : kernelExcessesPointers[index]);
+			const size_t size = kind == BlockValidationResult::INVALID_INPUT ? inputsSizes[index] : (kind == BlockValidationResult::INVALID_OUTPUT ? outputsSizes[index] : kernelExcessesSizes[index]);
+			
+			// Check if parsing commit failed
+			if(size != commitSize || !Secp256k1Zkp::secp256k1_pedersen_commitment_parse(Secp256k1Zkp::context, &commits[i], commit)) {
+			
+				// Fail
+				fail(kind, index);
+			}
+		}
+	});
+	
+	// Check if parsing failed
+	if(failed) {
+	
+		// Return failure
+		return tuple<uint8_t, uint64_t>{static_cast<uint8_t>(failureResult), failureIndex};
+	}
+	
+	// Get tasks with the balance check first since it's the cheapest and then the proof batches and signature groups
+	const size_t numberOfProofTasks = (numberOfOutputs + BLOCK_VALIDATION_PROOFS_PER_BATCH - 1) / BLOCK_VALIDATION_PROOFS_PER_BATCH;
+	const size_t numberOfSignatureTasks = (numberOfKernelExcesses + BLOCK_VALIDATION_KERNELS_PER_TASK - 1) / BLOCK_VALIDATION_KERNELS_PER_TASK;
+	const size_t numberOfTasks = 1 + numberOfProofTasks + numberOfSignatureTasks;
+	
+	// Initialize workers' scratch spaces
+	vector<Secp256k1Zkp::secp256k1_scratch_space *> scratchSpaces(min(getNumberOfThreads(), numberOfTasks), nullptr);
+	
+	// Initialize verify proof
+	auto verifyProof = [&](size_t index, Secp256k1Zkp::secp256k1_scratch_space *scratchSpace) -> bool {
+	
+		// Return if proof is verified
+		return Secp256k1Zkp::secp256k1_bulletproof_rangeproof_verify(Secp256k1Zkp::context, scratchSpace, Secp256k1Zkp::generators, proofsPointers[index], proofsSizes[index], nullptr, &commits[numberOfInputs + index], 1, BULLETPROOF_NUMBER_OF_BITS, &Secp256k1Zkp::secp256k1_generator_const_h, nullptr, 0);
+	};
+	
+	// Try
+	size_t numberOfWorkers = scratchSpaces.size();
+	try {
+	
+		// Run tasks until they're all done or one fails
+		runTasks(numberOfTasks, [&](size_t task, size_t worker) -> bool {
+		
+			// Check if task is the balance check
+			if(!task) {
+			
+				// Get positive and negative commits pointers
+				vector<const Secp256k1Zkp::secp256k1_pedersen_commitment *> positiveCommits(numberOfOutputs);
+				for(size_t i = 0; i < numberOfOutputs; ++i) {
+				
+					// Set positive commit pointer to the output
+					positiveCommits[i] = &commits[numberOfInputs + i];
+				}
+				vector<const Secp256k1Zkp::secp256k1_pedersen_commitment *> negativeCommits(numberOfInputs + numberOfKernelExcesses + 1);
+				for(size_t i = 0; i < numberOfInputs; ++i) {
+				
+					// Set negative commit pointer to the input
+					negativeCommits[i] = &commits[i];
+				}
+				for(size_t i = 0; i < numberOfKernelExcesses; ++i) {
+				
+					// Set negative commit pointer to the kernel excess
+					negativeCommits[numberOfInputs + i] = &commits[numberOfInputs + numberOfOutputs + i];
+				}
+				
+				// Check if committing to the offset and reward failed
+				Secp256k1Zkp::secp256k1_pedersen_commitment offsetCommit;
+				if(!Secp256k1Zkp::secp256k1_pedersen_commit(Secp256k1Zkp::context, &offsetCommit, offset, rewardValue, &Secp256k1Zkp::secp256k1_generator_const_h, &Secp256k1Zkp::secp256k1_generator_const_g)) {
+				
+					// Check if the offset and reward don't contribute to the balance
+					if(rewardValue || !scalarIsZero(offset)) {
+					
+						// Throw error
+						throw runtime_error("Performing Pedersen commit failed");
+					}
+					
+					// Remove offset commit from the negative commits
+					negativeCommits.pop_back();
+				}
+				
+				// Otherwise
+				else {
+				
+					// Add offset commit to the negative commits
+					negativeCommits.back() = &offsetCommit;
+				}
+				
+				// Check if the block doesn't balance
+				if(!Secp256k1Zkp::secp256k1_pedersen_verify_tally(Secp256k1Zkp::context, positiveCommits.data(), positiveCommits.size(), negativeCommits.data(), negativeCommits.size())) {
+				
+					// Fail
+					fail(BlockValidationResult::UNBALANCED, 0);
+					
+					// Return false
+					return false;
+				}
+			}
+			
+			// Otherwise check if task is a proof batch
+			else if(task <= numberOfProofTasks) {
+			
+				// Check if worker doesn't have a scratch space
+				if(!scratchSpaces[worker]) {
+				
+					// Check if creating scratch space failed
+					scratchSpaces[worker] = Secp256k1Zkp::secp256k1_scratch_space_create(Secp256k1Zkp::context, BLOCK_VALIDATION_SCRATCH_SPACE_SIZE);
+					if(!scratchSpaces[worker]) {
+					
+						// Throw error
+						throw runtime_error("Creating scratch space failed");
+					}
+				}
+				
+				// Get batch's proofs and a value generator for each of them
+				const size_t start = (task - 1) * BLOCK_VALIDATION_PROOFS_PER_BATCH;
+				const size_t end = min(start + BLOCK_VALIDATION_PROOFS_PER_BATCH, numberOfOutputs);
+				bool sameSize = true;
+				vector<const Secp256k1Zkp::secp256k1_pedersen_commitment *> batchCommits(end - start);
+				const vector<Secp256k1Zkp::secp256k1_generator> valueGenerators(end - start, Secp256k1Zkp::secp256k1_generator_const_h);
+				for(size_t i = start; i < end; ++i) {
+				
+					// Set batch commit and check if proof's size matches the batch's
+					batchCommits[i - start] = &commits[numberOfInputs + i];
+					sameSize = sameSize && proofsSizes[i] == proofsSizes[start];
+				}
+				
+				// Check if proofs all have the same size and verifying them as a batch succeeded
+				if(sameSize && Secp256k1Zkp::secp256k1_bulletproof_rangeproof_verify_multi(Secp256k1Zkp::context, scratchSpaces[worker], Secp256k1Zkp::generators, &proofsPointers[start], end - start, proofsSizes[start], nullptr, batchCommits.data(), 1, BULLETPROOF_NUMBER_OF_BITS, valueGenerators.data(), nullptr, nullptr)) {
+				
+					// Return true
+					return true;
+				}
+				
+				// Go through the batch's proofs to find which one is invalid
+				for(size_t i = start; i < end && !failed; ++i) {
+				
+					// Check if verifying proof failed
+					if(!verifyProof(i, scratchSpaces[worker])) {
+					
+						// Fail
+						fail(BlockValidationResult::INVALID_PROOF, i);
+						
+						// Return false
+						return false;
+					}
+				}
+			}
+			
+			// Otherwise
+			else {
+			
+				// Go through the group's kernels
+				const size_t start = (task - 1 - numberOfProofTasks) * BLOCK_VALIDATION_KERNELS_PER_TASK;
+				const size_t end = min(start + BLOCK_VALIDATION_KERNELS_PER_TASK, numberOfKernelExcesses);
+				for(size_t i = start; i < end && !failed; ++i) {
+				
+					// Check if kernel's message is invalid, parsing its signature failed, getting its public key failed, or verifying its signature failed
+					Secp256k1Zkp::secp256k1_ecdsa_signature signature;
+					Secp256k1Zkp::secp256k1_pubkey publicKey;
+					if(messagesSizes[i] != SINGLE_SIGNER_MESSAGE_SIZE || signaturesSizes[i] != Secp256k1Zkp::singleSignerSignatureSize() || !Secp256k1Zkp::secp256k1_ecdsa_signature_parse_compact(Secp256k1Zkp::context, &signature, signaturesPointers[i]) || !Secp256k1Zkp::secp256k1_pedersen_commitment_to_pubkey(Secp256k1Zkp::context, &publicKey, &commits[numberOfInputs + numberOfOutputs + i]) || !Secp256k1Zkp::secp256k1_aggsig_verify_single(Secp256k1Zkp::context, signature.data, messagesPointers[i], nullptr, &publicKey, &publicKey, nullptr, false)) {
+					
+						// Fail
+						fail(BlockValidationResult::INVALID_SIGNATURE, i);
+						
+						// Return false
+						return false;
+					}
+				}
+			}
+			
+			// Return if no failure has occurred
+			return !failed;
+		}, numberOfWorkers);
+	}
+	
+	// Catch errors
+	catch(...) {
+	
+		// Go through all scratch spaces
+		for(Secp256k1Zkp::secp256k1_scratch_space *scratchSpace : scratchSpaces) {
+		
+			// Check if scratch space exists
+			if(scratchSpace) {
+			
+				// Destroy scratch space
+				Secp256k1Zkp::secp256k1_scratch_space_destroy(scratchSpace);
+			}
+		}
+		
+		// Throw error
+		throw;
+	}
+	
+	// Go through all scratch spaces
+	for(Secp256k1Zkp::secp256k1_scratch_space *scratchSpace : scratchSpaces) {
+	
+		// Check if scratch space exists
+		if(scratchSpace) {
+		
+			// Destroy scratch space
+			Secp256k1Zkp::secp256k1_scratch_space_destroy(scratchSpace);
+		}
+	}
+	
+	// Return result
+	return tuple<uint8_t, uint64_t>{static_cast<uint8_t>(failureResult), failureIndex};
+}
+
+// Secure allocate
+void *secureAllocate(size_t size) {
+
+	// Check if allocating from the current thread's secure arena succeeded
+	SecureArena *arena = SecureArenaLease::getCurrentArena();
+	void *result = arena ? arena->allocate(size) : nullptr;
+	if(result) {
+	
+		// Return result
+		return result;
+	}
+	
+	// Return allocating from the heap
+	return ::operator new(size);
+}
+
+// Secure deallocate
+void secureDeallocate(void *memory, size_t size) {
+
+	// Check if memory was allocated from a secure arena
+	SecureArena *arena = SecureArenaLease::getOwningArena(memory);
+	if(arena && arena->deallocate(memory, size)) {
+	
+		// Return
+		return;
+	}
+	
+	// Clear memory and release it to the heap
+	clearMemory(memory, size);
+	::operator delete(memory);
+}
+
+// Get stats
+string getStats() {
+
+	// Check if operation stats are enabled
+	#ifdef ENABLE_OPERATION_STATS
+	
+		// Go through all operations
+		string result = "{";
+		for(size_t i = 0; i < static_cast<size_t>(Operation::NUMBER_OF_OPERATIONS); ++i) {
+		
+			// Check if operation was called
+			if(operationStats[i].getCalls()) {
+			
+				// Append operation's stats to result
+				result += ((result.size() > sizeof('{')) ? "," : "") + operationStats[i].toJson(OPERATION_NAMES[i]);
+			}
+		}
+		
+		// Return result
+		return result + "}";
+	
+	// Otherwise
+	#else
+	
+		// Return no stats
+		return "{}";
+	#endif
+}
 
-	// Header files
-	#include "../Secp256k1-zkp-NPM-Package-master/main.cpp"
+// Reset stats
+void resetStats() {
+
+	// Check if operation stats are enabled
+	#ifdef ENABLE_OPERATION_STATS
+	
+		// Go through all operations
+		for(OperationStats &stats : operationStats) {
+		
+			// Reset operation's stats
+			stats.reset();
+		}
+	#endif
 }
 
+// Start trace
+void startTrace(const char *path) {
 
-// Constants
+	// Check if tracing is enabled
+	#ifdef ENABLE_TRACING
+	
+		// Lock trace
+		lock_guard<mutex> guard(traceLock);
+		
+		// Check if a trace is already started
+		if(traceFile != -1) {
+		
+			// Throw error
+			throw runtime_error("Trace is already started");
+		}
+		
+		// Check if opening trace file failed
+		const int file = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+		if(file == -1) {
+		
+			// Throw error
+			throw runtime_error("Opening trace file failed");
+		}
+		
+		// Set trace file to the file and start its events
+		traceFile = file;
+		traceEvents = "{\"traceEvents\":[\n";
+		traceHasEvents = false;
+		
+		// Set is tracing
+		isTracing = true;
+	
+	// Otherwise
+	#else
+	
+		// Ignore path
+		(void)path;
+		
+		// Throw error
+		throw runtime_error("Tracing isn't enabled");
+	#endif
+}
 
-// Max 64-bit integer string length
-static const size_t MAX_64_BIT_INTEGER_STRING_LENGTH = sizeof("18446744073709551615");
+// Stop trace
+void stopTrace() {
 
+	// Check if tracing is enabled
+	#ifdef ENABLE_TRACING
+	
+		// Lock trace
+		lock_guard<mutex> guard(traceLock);
+		
+		// Check if a trace isn't started
+		if(traceFile == -1) {
+		
+			// Return
+			return;
+		}
+		
+		// Clear is tracing
+		isTracing = false;
+		
+		// End trace events
+		traceEvents += "\n]}\n";
+		
+		// Try
+		try {
+		
+			// Write trace events to the trace file
+			writeAll(traceFile, reinterpret_cast<const uint8_t *>(traceEvents.data()), traceEvents.size());
+		}
+		
+		// Catch errors
+		catch(...) {
+		
+			// Close trace file
+			close(traceFile);
+			traceFile = -1;
+			traceEvents.clear();
+			
+			// Throw error
+			throw;
+		}
+		
+		// Close trace file
+		close(traceFile);
+		traceFile = -1;
+		traceEvents.clear();
+	#endif
+}
 
-// Function prototypes
+// SHA-256 hashes
+vector<uint8_t> sha256Hashes(const uint8_t *messages, size_t messagesSizes[], size_t numberOfMessages) {
 
-// Initialize
-static void initialize(const uint8_t *seed, size_t seedSize);
+	// Track operation
+	TRACK_OPERATION(SHA256_HASHES, OperationTracker::sumSizes(messagesSizes, numberOfMessages));
+	
+	// Get SHA-256 transform and lanes transform
+	static const Sha256TransformFunction sha256Transform = getSha256Transform();
+	static const Sha256LanesTransformFunction sha256LanesTransform = getSha256LanesTransform();
+	
+	// Get messages pointers
+	const vector<const uint8_t *> messagesPointers = getPointers(messages, messagesSizes, numberOfMessages);
+	
+	// Check if hashing messages in lanes
+	vector<uint8_t> result(numberOfMessages * SHA256_DIGEST_SIZE);
+	if(sha256LanesTransform) {
+	
+		// Hash groups of messages in parallel
+		parallelFor((numberOfMessages + SHA256_NUMBER_OF_LANES - 1) / SHA256_NUMBER_OF_LANES, [&](size_t start, size_t end) {
+		
+			// Go through the groups
+			for(size_t i = start; i < end; ++i) {
+			
+				// Go through all lanes
+				uint32_t states[sizeof(SHA256_INITIAL_STATE) / sizeof(SHA256_INITIAL_STATE[0])][SHA256_NUMBER_OF_LANES];
+				uint8_t paddings[SHA256_NUMBER_OF_LANES][SHA256_BLOCK_SIZE * 2] = {};
+				size_t numbersOfBlocks[SHA256_NUMBER_OF_LANES] = {};
+				size_t mostBlocks = 0;
+				for(size_t j = 0; j < SHA256_NUMBER_OF_LANES; ++j) {
+				
+					// Go through all state words
+					for(size_t k = 0; k < sizeof(states) / sizeof(states[0]); ++k) {
+					
+						// Set lane's state word to the initial state word
+						states[k][j] = SHA256_INITIAL_STATE[k];
+					}
+					
+					// Check if lane has a message
+					const size_t message = i * SHA256_NUMBER_OF_LANES + j;
+					if(message < numberOfMessages) {
+					
+						// Pad message and get its number of blocks
+						numbersOfBlocks[j] = messagesSizes[message] / SHA256_BLOCK_SIZE + sha256Pad(paddings[j], messagesPointers[message], messagesSizes[message]);
+						mostBlocks = max(mostBlocks, numbersOfBlocks[j]);
+					}
+				}
+				
+				// Go through all blocks
+				for(size_t j = 0; j < mostBlocks; ++j) {
+				
+					// Go through all lanes
+					const uint8_t *blocks[SHA256_NUMBER_OF_LANES];
+					for(size_t k = 0; k < SHA256_NUMBER_OF_LANES; ++k) {
+					
+						// Set lane's block to the message's block, its padding, or any padding if the lane is finished since that lane's state is no longer used
+						const size_t message = i * SHA256_NUMBER_OF_LANES + k;
+						const size_t numberOfMessageBlocks = (message < numberOfMessages) ? messagesSizes[message] / SHA256_BLOCK_SIZE : 0;
+						blocks[k] = (j < numberOfMessageBlocks) ? &messagesPointers[message][j * SHA256_BLOCK_SIZE] : ((j < numbersOfBlocks[k]) ? &paddings[k][(j - numberOfMessageBlocks) * SHA256_BLOCK_SIZE] : paddings[k]);
+					}
+					
+					// Transform states with the blocks
+					sha256LanesTransform(states, blocks);
+					
+					// Go through all lanes
+					for(size_t k = 0; k < SHA256_NUMBER_OF_LANES; ++k) {
+					
+						// Check if lane's message is finished
+						if(numbersOfBlocks[k] == j + 1) {
+						
+							// Go through all state words
+							uint8_t *hash = &result[(i * SHA256_NUMBER_OF_LANES + k) * SHA256_DIGEST_SIZE];
+							for(size_t l = 0; l < sizeof(states) / sizeof(states[0]); ++l) {
+							
+								// Go through all bytes in the state word
+								for(size_t m = 0; m < sizeof(states[0][0]); ++m) {
+								
+									// Set hash byte to the lane's state word's big endian byte
+									hash[l * sizeof(states[0][0]) + m] = states[l][k] >> ((sizeof(states[0][0]) - 1 - m) * 8);
+								}
+							}
+						}
+					}
+				}
+			}
+		});
+	}
+	
+	// Otherwise
+	else {
+	
+		// Hash messages in parallel
+		parallelFor(numberOfMessages, [&](size_t start, size_t end) {
+		
+			// Go through the messages
+			for(size_t i = start; i < end; ++i) {
+			
+				// Transform initial state with the message's blocks and padding
+				uint32_t state[sizeof(SHA256_INITIAL_STATE) / sizeof(SHA256_INITIAL_STATE[0])];
+				memcpy(state, SHA256_INITIAL_STATE, sizeof(state));
+				sha256Transform(state, messagesPointers[i], messagesSizes[i] / SHA256_BLOCK_SIZE);
+				uint8_t padding[SHA256_BLOCK_SIZE * 2];
+				sha256Transform(state, padding, sha256Pad(padding, messagesPointers[i], messagesSizes[i]));
+				
+				// Go through all state words
+				uint8_t *hash = &result[i * SHA256_DIGEST_SIZE];
+				for(size_t j = 0; j < sizeof(state) / sizeof(state[0]); ++j) {
+				
+					// Go through all bytes in the state word
+					for(size_t k = 0; k < sizeof(state[0]); ++k) {
+					
+						// Set hash byte to the state word's big endian byte
+						hash[j * sizeof(state[0]) + k] = state[j] >> ((sizeof(state[0]) - 1 - k) * 8);
+					}
+				}
+			}
+		});
+	}
+	
+	// Return result
+	return TRACK_RESULT(result);
+}
 
+// SHA-256 transform
+void secp256k1_sha256_transform(uint32_t *state, const uint32_t *chunk) {
 
-// Supporting function implementation
+	// Get SHA-256 transform
+	static const Sha256TransformFunction sha256Transform = getSha256Transform();
+	
+	// Transform state with the chunk
+	sha256Transform(state, reinterpret_cast<const uint8_t *>(chunk), 1);
+}
 
-// Blind switch
-vector<uint8_t> blindSwitch(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value) {
+// Seed size
+size_t seedSize() {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Return seed size
+	return Secp256k1Zkp::seedSize();
+}
+
+// Initialize
+void initialize(const uint8_t *seed, size_t seedSize) {
+
+	// Trace initializing
+	TRACE_SPAN(__func__);
 	
-	// Check if performing blind switch failed
-	vector<uint8_t> result(Secp256k1Zkp::blindSize());
-	if(!Secp256k1Zkp::blindSwitch(result.data(), blind, blindSize, value)) {
+	// Check if secp256k1-zkp context isn't initialized
+	if(!Secp256k1Zkp::context) {
+	
+		// Initialize secp256k1-zkp
+		Secp256k1Zkp::initialize(seed, seedSize);
+		
+		// Check if secp256k1-zkp context was initialized
+		if(Secp256k1Zkp::context) {
+		
+			// Check if registering uninitializing secp256k1-zkp on exit failed
+			if(atexit([]() {
+			
+				// Stop nonce pool
+				noncePool.stop();
+			
+				// Uninitialize secp256k1-zkp
+				Secp256k1Zkp::uninitialize();
+			})) {
+			
+				// Uninitialize secp256k1-zkp
+				Secp256k1Zkp::uninitialize();
+			
+				// Throw error
+				throw runtime_error("Registering uninitializing secp256k1-zkp on exit failed");
+			}
+		}
+	}
+	
+	// Check if initializing secp256k1-zkp failed
+	if(!Secp256k1Zkp::context || !Secp256k1Zkp::scratchSpace || !Secp256k1Zkp::generators) {
 	
 		// Throw error
-		throw runtime_error("Performing blind switch failed");
+		throw runtime_error("Initializing secp256k1-zkp failed");
+	}
+}
+
+// Value from string
+uint64_t valueFromString(const char *value) {
+
+	// Check if value isn't a number
+	if(!value || !*value || strspn(value, "0123456789") != strlen(value)) {
+	
+		// Throw error
+		throw runtime_error("Value is invalid");
+	}
+	
+	// Check if value is too large
+	errno = 0;
+	const unsigned long long result = strtoull(value, nullptr, 10);
+	if(errno == ERANGE) {
+	
+		// Throw error
+		throw runtime_error("Value is invalid");
 	}
 	
 	// Return result
 	return result;
 }
 
-// Blind sum
-vector<uint8_t> blindSum(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *positiveBlinds, size_t positiveBlindsSizes[], size_t numberOfPositiveBlinds, const uint8_t *negativeBlinds, size_t negativeBlindsSizes[], size_t numberOfNegativeBlinds) {
+// Get Pedersen value table
+vector<uint8_t> getPedersenValueTable() {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Initialize blinds and blinds sizes
-	vector<uint8_t> blinds;
-	vector<size_t> blindsSizes(numberOfPositiveBlinds + numberOfNegativeBlinds);
+	// Return table of multiples of the value generator that commits look up a value's digits in
+	vector<uint8_t> table(Secp256k1Zkp::secp256k1_pedersen_value_table_size());
+	Secp256k1Zkp::secp256k1_pedersen_value_table_build(table.data(), &Secp256k1Zkp::secp256k1_generator_const_h);
+	return table;
+}
+
+// Is aggsig with sighash compatible
+bool isAggsigWithSighashCompatible() {
+
+	// Get known secret keys, secret nonces, and message for a two party signature
+	uint8_t secretKeys[2][32];
+	uint8_t secretNonces[2][32];
+	uint8_t message[SINGLE_SIGNER_MESSAGE_SIZE];
+	memset(secretKeys[0], 0x11, sizeof(secretKeys[0]));
+	memset(secretKeys[1], 0x22, sizeof(secretKeys[1]));
+	memset(secretNonces[0], 0x33, sizeof(secretNonces[0]));
+	memset(secretNonces[1], 0x44, sizeof(secretNonces[1]));
+	memset(message, 0x55, sizeof(message));
 	
-	// Go through all positive blinds
-	const uint8_t *blind = positiveBlinds;
-	for(size_t i = 0; i < numberOfPositiveBlinds; ++i) {
+	// Go through the secret nonces and their negations so that the public nonce total's y coordinate is a quadratic residue in one of them
+	for(int negated = 0; negated < 2; ++negated) {
 	
-		// Append blind buffer to blinds
-		blinds.insert(blinds.cend(), blind, blind + positiveBlindsSizes[i]);
+		// Go through both parties
+		Secp256k1Zkp::secp256k1_pubkey publicKeys[2];
+		Secp256k1Zkp::secp256k1_pubkey publicNonces[2];
+		for(size_t i = 0; i < 2; ++i) {
+		
+			// Check if negating the party's secret nonce failed
+			uint8_t registers[2][32];
+			const uint8_t program[] = {static_cast<uint8_t>(ScalarOperation::NEGATE), 0, 0, 0, 0};
+			memcpy(registers[0], secretNonces[i], sizeof(registers[0]));
+			if(negated && !Secp256k1Zkp::secp256k1_scalar_program_evaluate(registers[0], 1, program, 1)) {
+			
+				// Return false
+				return false;
+			}
+			memcpy(secretNonces[i], registers[negated], sizeof(secretNonces[i]));
+			
+			// Check if getting the party's public key or public nonce failed
+			if(!Secp256k1Zkp::secp256k1_ec_pubkey_create(Secp256k1Zkp::context, &publicKeys[i], secretKeys[i]) || !Secp256k1Zkp::secp256k1_ec_pubkey_create(Secp256k1Zkp::context, &publicNonces[i], secretNonces[i])) {
+			
+				// Return false
+				return false;
+			}
+		}
 		
-		// Append blind's size to blinds sizes
-		blindsSizes[i] = positiveBlindsSizes[i];
+		// Check if getting the public key total, public nonce total, or sighash failed
+		const Secp256k1Zkp::secp256k1_pubkey *publicKeysPointers[] = {&publicKeys[0], &publicKeys[1]};
+		const Secp256k1Zkp::secp256k1_pubkey *publicNoncesPointers[] = {&publicNonces[0], &publicNonces[1]};
+		Secp256k1Zkp::secp256k1_pubkey publicKeyTotal;
+		Secp256k1Zkp::secp256k1_pubkey publicNonceTotal;
+		uint8_t sighash[SINGLE_SIGNER_MESSAGE_SIZE];
+		if(!Secp256k1Zkp::secp256k1_ec_pubkey_combine(Secp256k1Zkp::context, &publicKeyTotal, publicKeysPointers, 2) || !Secp256k1Zkp::secp256k1_ec_pubkey_combine(Secp256k1Zkp::context, &publicNonceTotal, publicNoncesPointers, 2) || !Secp256k1Zkp::secp256k1_aggsig_sighash_single(Secp256k1Zkp::context, sighash, message, &publicNonceTotal, &publicKeyTotal)) {
 		
-		// Go to next blind
-		blind += positiveBlindsSizes[i];
+			// Return false
+			return false;
+		}
+		
+		// Go through both parties
+		Secp256k1Zkp::secp256k1_ecdsa_signature signatures[2];
+		for(size_t i = 0; i < 2; ++i) {
+		
+			// Check if creating the party's partial signature with and without the sighash failed or gave different results
+			uint8_t signature[sizeof(signatures[i].data)];
+			if(!Secp256k1Zkp::secp256k1_aggsig_sign_single(Secp256k1Zkp::context, signatures[i].data, message, secretKeys[i], secretNonces[i], nullptr, &publicNonceTotal, &publicNonceTotal, &publicKeyTotal, nullptr) || !Secp256k1Zkp::secp256k1_aggsig_sign_single_with_sighash(Secp256k1Zkp::context, signature, sighash, secretKeys[i], secretNonces[i], &publicNonceTotal) || memcmp(signature, signatures[i].data, sizeof(signature))) {
+			
+				// Return false
+				return false;
+			}
+			
+			// Check if verifying the partial signature with and without the sighash against both parties' public keys gave different results or didn't only verify it for its own party
+			for(size_t j = 0; j < 2; ++j) {
+			
+				// Check if results are different or wrong
+				const bool verified = Secp256k1Zkp::secp256k1_aggsig_verify_single(Secp256k1Zkp::context, signatures[i].data, message, &publicNonceTotal, &publicKeys[j], &publicKeyTotal, nullptr, true);
+				if(verified != static_cast<bool>(Secp256k1Zkp::secp256k1_aggsig_verify_single_with_sighash(Secp256k1Zkp::context, signatures[i].data, sighash, &publicKeys[j], true)) || verified != (i == j)) {
+				
+					// Return false
+					return false;
+				}
+			}
+		}
+		
+		// Check if aggregating the partial signatures failed
+		const uint8_t *signaturesPointers[] = {signatures[0].data, signatures[1].data};
+		Secp256k1Zkp::secp256k1_ecdsa_signature signature;
+		if(!Secp256k1Zkp::secp256k1_aggsig_add_signatures_single(Secp256k1Zkp::context, signature.data, signaturesPointers, 2, &publicNonceTotal)) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Go through the signature and a modified signature
+		for(int modified = 0; modified < 2; ++modified) {
+		
+			// Check if verifying the signature with and without the sighash gave different results or the wrong result
+			signature.data[sizeof(signature.data) - 1] ^= modified;
+			const bool verified = Secp256k1Zkp::secp256k1_aggsig_verify_single(Secp256k1Zkp::context, signature.data, message, &publicNonceTotal, &publicKeyTotal, &publicKeyTotal, nullptr, false);
+			if(verified != static_cast<bool>(Secp256k1Zkp::secp256k1_aggsig_verify_single_with_sighash(Secp256k1Zkp::context, signature.data, sighash, &publicKeyTotal, false)) || verified != !modified) {
+			
+				// Return false
+				return false;
+			}
+		}
 	}
 	
-	// Go through all negative blinds
-	blind = negativeBlinds;
-	for(size_t i = 0; i < numberOfNegativeBlinds; ++i) {
+	// Return true
+	return true;
+}
+
+// Clear memory
+void clearMemory(void *memory, size_t size) {
+
+	// Go through all bytes in the memory
+	volatile uint8_t *bytes = reinterpret_cast<volatile uint8_t *>(memory);
+	for(size_t i = 0; i < size; ++i) {
+	
+		// Clear byte
+		bytes[i] = 0;
+	}
+}
+
+// Get secure arenas memory
+uint8_t *getSecureArenasMemory() {
+
+	// Reserve address space for all secure arenas once without making it usable so that an allocation's arena can be found from its address
+	static void *const mapping = mmap(nullptr, MAXIMUM_NUMBER_OF_SECURE_ARENAS * SECURE_ARENA_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	
+	// Return secure arenas memory or nothing if reserving it failed
+	return (mapping != MAP_FAILED) ? static_cast<uint8_t *>(mapping) : nullptr;
+}
+
+// Random bytes
+void randomBytes(uint8_t *result, size_t size) {
+
+	// Check if Apple
+	#ifdef __APPLE__
+	
+		// Fill result with random bytes
+		arc4random_buf(result, size);
 	
-		// Append blind buffer to blinds
-		blinds.insert(blinds.cend(), blind, blind + negativeBlindsSizes[i]);
+	// Otherwise
+	#else
+	
+		// Check if opening random device failed
+		const int randomDevice = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+		if(randomDevice == -1) {
 		
-		// Append blind's size to blinds sizes
-		blindsSizes[i + numberOfPositiveBlinds] = negativeBlindsSizes[i];
+			// Throw error
+			throw runtime_error("Opening random device failed");
+		}
 		
-		// Go to next blind
-		blind += negativeBlindsSizes[i];
-	}
+		// Go through all bytes in the result
+		for(size_t i = 0; i < size;) {
+		
+			// Check if reading from random device failed
+			const ssize_t bytesRead = read(randomDevice, &result[i], size - i);
+			if(bytesRead <= 0) {
+			
+				// Check if read was interrupted
+				if(bytesRead == -1 && errno == EINTR) {
+				
+					// Continue
+					continue;
+				}
+				
+				// Close random device
+				close(randomDevice);
+				
+				// Throw error
+				throw runtime_error("Reading from random device failed");
+			}
+			
+			// Update index
+			i += bytesRead;
+		}
+		
+		// Close random device
+		close(randomDevice);
+	#endif
+}
+
+// Accumulate commits
+void accumulateCommits(Secp256k1Zkp::secp256k1_pedersen_commitment &total, bool &totalIsInfinity, const uint8_t *commits, size_t commitsSizes[], size_t numberOfCommits, bool isPositive) {
+
+	// Trace accumulating commits
+	TRACE_SPAN(__func__);
 	
-	// Check if performing blind sum failed
-	vector<uint8_t> result(Secp256k1Zkp::blindSize());
-	if(!Secp256k1Zkp::blindSum(result.data(), blinds.data(), blindsSizes.data(), numberOfPositiveBlinds + numberOfNegativeBlinds, numberOfPositiveBlinds)) {
+	// Go through all chunks of commits
+	vector<Secp256k1Zkp::secp256k1_pedersen_commitment> chunk(min(numberOfCommits, SUM_CHUNK_SIZE));
+	vector<const Secp256k1Zkp::secp256k1_pedersen_commitment *> chunkPointers;
+	const uint8_t *commit = commits;
+	for(size_t i = 0; i < numberOfCommits;) {
 	
-		// Throw error
-		throw runtime_error("Performing blind sum failed");
+		// Go through the chunk's commits
+		chunkPointers.clear();
+		for(size_t j = 0; i < numberOfCommits && j < chunk.size(); ++i, ++j) {
+		
+			// Check if parsing commit failed
+			if(commitsSizes[i] != Secp256k1Zkp::commitSize() || !Secp256k1Zkp::secp256k1_pedersen_commitment_parse(Secp256k1Zkp::context, &chunk[j], commit)) {
+			
+				// Throw error
+				throw runtime_error("Parsing commit failed");
+			}
+			
+			// Add commit to the chunk
+			chunkPointers.push_back(&chunk[j]);
+			
+			// Go to next commit
+			commit += commitsSizes[i];
+		}
+		
+		// Check if adding commits
+		Secp256k1Zkp::secp256k1_pedersen_commitment chunkTotal;
+		if(isPositive) {
+		
+			// Check if total isn't infinity
+			if(!totalIsInfinity) {
+			
+				// Add total to the chunk
+				chunkPointers.push_back(&total);
+			}
+			
+			// Set total to the sum of the chunk or infinity if its commits cancel out
+			totalIsInfinity = !Secp256k1Zkp::secp256k1_pedersen_commit_sum(Secp256k1Zkp::context, &chunkTotal, chunkPointers.data(), chunkPointers.size(), nullptr, 0);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Set total to the total minus the chunk or infinity if they cancel out
+			const Secp256k1Zkp::secp256k1_pedersen_commitment *totals[] = {&total};
+			totalIsInfinity = !Secp256k1Zkp::secp256k1_pedersen_commit_sum(Secp256k1Zkp::context, &chunkTotal, totals, totalIsInfinity ? 0 : 1, chunkPointers.data(), chunkPointers.size());
+		}
+		
+		// Update total
+		total = chunkTotal;
+	}
+}
+
+// Get pointers
+vector<const uint8_t *> getPointers(const uint8_t *data, const size_t sizes[], size_t numberOfItems) {
+
+	// Go through all items
+	vector<const uint8_t *> result(numberOfItems);
+	for(size_t i = 0; i < numberOfItems; ++i) {
+	
+		// Set item's pointer
+		result[i] = data;
+		
+		// Go to next item
+		data += sizes[i];
 	}
 	
 	// Return result
 	return result;
 }
 
-// Is valid secret key
-bool isValidSecretKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize) {
+// Parallel for
+void parallelFor(size_t numberOfItems, const function<void(size_t start, size_t end)> &body) {
+
+	// Get number of threads
+	const size_t numberOfThreads = max<size_t>(min(getNumberOfThreads(), numberOfItems / MINIMUM_ITEMS_PER_THREAD), 1);
+	
+	// Check if only one thread is used
+	if(numberOfThreads == 1) {
+	
+		// Perform body on all items
+		body(0, numberOfItems);
+		
+		// Return
+		return;
+	}
+	
+	// Go through all threads
+	vector<thread> threads;
+	vector<exception_ptr> errors(numberOfThreads);
+	for(size_t i = 0; i < numberOfThreads; ++i) {
+	
+		// Get thread's items
+		const size_t start = numberOfItems * i / numberOfThreads;
+		const size_t end = numberOfItems * (i + 1) / numberOfThreads;
+		
+		// Try
+		try {
+		
+			// Start thread that performs body on its items
+			threads.emplace_back([&body, &errors, i, start, end]() {
+			
+				// Trace performing body on items
+				TRACE_SPAN("parallelFor");
+				
+				// Try
+				try {
+				
+					// Perform body on items
+					body(start, end);
+				}
+				
+				// Catch errors
+				catch(...) {
+				
+					// Save error
+					errors[i] = current_exception();
+				}
+			});
+		}
+		
+		// Catch errors
+		catch(const system_error &error) {
+		
+			// Try
+			try {
+			
+				// Perform body on items in the current thread
+				body(start, end);
+			}
+			
+			// Catch errors
+			catch(...) {
+			
+				// Save error
+				errors[i] = current_exception();
+			}
+		}
+	}
+	
+	// Go through all threads
+	for(thread &worker : threads) {
+	
+		// Wait for thread to finish
+		worker.join();
+	}
+	
+	// Go through all errors
+	for(const exception_ptr &error : errors) {
+	
+		// Check if error exists
+		if(error) {
+		
+			// Throw error
+			rethrow_exception(error);
+		}
+	}
+}
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+// Get number of threads
+size_t getNumberOfThreads() {
 
-	// Check if secret key is not a valid secret key
-	if(!Secp256k1Zkp::isValidSecretKey(secretKey, secretKeySize)) {
+	// Check if the thread count is set
+	const size_t result = threadCount.load(memory_order_relaxed);
+	if(result) {
 	
-		// Return false
-		return false;
+		// Return result
+		return result;
 	}
 	
-	// Return true
-	return true;
+	// Return hardware concurrency
+	return max<unsigned int>(thread::hardware_concurrency(), 1);
 }
 
-// Is valid public key
-bool isValidPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize) {
+// Verify bulletproof in thread scratch space
+bool verifyBulletproofInThreadScratchSpace(const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *extraCommit, size_t extraCommitSize) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if public key is not a valid public key
-	if(!Secp256k1Zkp::isValidPublicKey(publicKey, publicKeySize)) {
+	// Check if commit's size is invalid or parsing it failed
+	Secp256k1Zkp::secp256k1_pedersen_commitment parsedCommit;
+	if(commitSize != Secp256k1Zkp::commitSize() || !Secp256k1Zkp::secp256k1_pedersen_commitment_parse(Secp256k1Zkp::context, &parsedCommit, commit)) {
 	
 		// Return false
 		return false;
 	}
 	
-	// Return true
-	return true;
+	// Return if proof verifies for the commit in the current thread's scratch space
+	return Secp256k1Zkp::secp256k1_bulletproof_rangeproof_verify(Secp256k1Zkp::context, threadScratchSpace.get(), Secp256k1Zkp::generators, proof, proofSize, nullptr, &parsedCommit, 1, BULLETPROOF_NUMBER_OF_BITS, &Secp256k1Zkp::secp256k1_generator_const_h, extraCommitSize ? extraCommit : nullptr, extraCommitSize);
 }
 
-// Is valid commit
-bool isValidCommit(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *commit, size_t commitSize) {
+// Run tasks
+void runTasks(size_t numberOfTasks, const function<bool(size_t task, size_t worker)> &body, size_t &numberOfWorkers) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Initialize next task and stop
+	atomic<size_t> nextTask(0);
+	atomic<bool> stop(false);
 	
-	// Check if commit is not a valid commit
-	if(!Secp256k1Zkp::isValidCommit(commit, commitSize)) {
+	// Initialize work
+	auto work = [&body, &nextTask, &stop, numberOfTasks](size_t worker) {
 	
-		// Return false
-		return false;
+		// Trace performing work
+		TRACE_SPAN("runTasks");
+		
+		// Loop while tasks remain and none have requested to stop
+		while(!stop) {
+		
+			// Check if no tasks remain
+			const size_t task = nextTask++;
+			if(task >= numberOfTasks) {
+			
+				// Break
+				break;
+			}
+			
+			// Check if performing task requested to stop
+			if(!body(task, worker)) {
+			
+				// Stop
+				stop = true;
+			}
+		}
+	};
+	
+	// Go through all workers except the current thread
+	vector<thread> threads;
+	vector<exception_ptr> errors(numberOfWorkers);
+	for(size_t i = 1; i < numberOfWorkers; ++i) {
+	
+		// Try
+		try {
+		
+			// Start thread that performs work
+			threads.emplace_back([&work, &errors, &stop, i]() {
+			
+				// Try
+				try {
+				
+					// Perform work
+					work(i);
+				}
+				
+				// Catch errors
+				catch(...) {
+				
+					// Save error
+					errors[i] = current_exception();
+					
+					// Stop
+					stop = true;
+				}
+			});
+		}
+		
+		// Catch errors
+		catch(const system_error &error) {
+		
+			// Set number of workers to the workers that were started
+			numberOfWorkers = i;
+			
+			// Break
+			break;
+		}
 	}
 	
-	// Return true
-	return true;
-}
-
-// Is valid single-signer signature
-bool isValidSingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize) {
-
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Try
+	try {
 	
-	// Check if signature is not a valid single-signer signature
-	if(!Secp256k1Zkp::isValidSingleSignerSignature(signature, signatureSize)) {
+		// Perform work in the current thread
+		work(0);
+	}
 	
-		// Return false
-		return false;
+	// Catch errors
+	catch(...) {
+	
+		// Save error
+		errors[0] = current_exception();
+		
+		// Stop
+		stop = true;
 	}
 	
-	// Return true
-	return true;
+	// Go through all threads
+	for(thread &worker : threads) {
+	
+		// Wait for thread to finish
+		worker.join();
+	}
+	
+	// Go through all errors
+	for(const exception_ptr &error : errors) {
+	
+		// Check if error exists
+		if(error) {
+		
+			// Throw error
+			rethrow_exception(error);
+		}
+	}
 }
 
-// Create bulletproof blindless
-vector<uint8_t> createBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value, const uint8_t *nonce, size_t nonceSize, const uint8_t *privateNonce, size_t privateNonceSize, const uint8_t *extraCommit, size_t extraCommitSize, const uint8_t *message, size_t messageSize) {
+// HMAC-SHA512
+void hmacSha512(uint8_t *result, const uint8_t *key, size_t keySize, const uint8_t *data, size_t dataSize) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Set padded key to the key or its hash if it's too long
+	uint8_t paddedKey[SHA512_BLOCK_SIZE] = {};
+	if(keySize > SHA512_BLOCK_SIZE) {
 	
-	// Check if creating bulletproof failed
-	vector<uint8_t> proof(Secp256k1Zkp::bulletproofProofSize());
-	char proofSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
-	if(!Secp256k1Zkp::createBulletproof(proof.data(), proofSize, blind, blindSize, value, nonce, nonceSize, privateNonce, privateNonceSize, extraCommit, extraCommitSize, message, messageSize)) {
+		// Set padded key to the key's hash
+		Sha512 keyHash;
+		keyHash.update(key, keySize);
+		keyHash.finalize(paddedKey);
+	}
+	else {
 	
-		// Throw error
-		throw runtime_error("Creating bulletproof failed");
+		// Set padded key to the key
+		memcpy(paddedKey, key, keySize);
 	}
 	
-	// Set proof's size to proof size
-	proof.resize(strtoull(proofSize, nullptr, 10));
+	// Get inner and outer padded keys
+	uint8_t innerPaddedKey[SHA512_BLOCK_SIZE];
+	uint8_t outerPaddedKey[SHA512_BLOCK_SIZE];
+	for(size_t i = 0; i < SHA512_BLOCK_SIZE; ++i) {
 	
-	// Return proof
-	return proof;
+		// Set inner and outer padded key bytes
+		innerPaddedKey[i] = paddedKey[i] ^ 0x36;
+		outerPaddedKey[i] = paddedKey[i] ^ 0x5C;
+	}
+	
+	// Get inner hash
+	uint8_t innerHash[SHA512_DIGEST_SIZE];
+	Sha512 inner;
+	inner.update(innerPaddedKey, sizeof(innerPaddedKey));
+	inner.update(data, dataSize);
+	inner.finalize(innerHash);
+	
+	// Get outer hash
+	Sha512 outer;
+	outer.update(outerPaddedKey, sizeof(outerPaddedKey));
+	outer.update(innerHash, sizeof(innerHash));
+	outer.finalize(result);
+	
+	// Clear padded keys and inner hash
+	clearMemory(paddedKey, sizeof(paddedKey));
+	clearMemory(innerPaddedKey, sizeof(innerPaddedKey));
+	clearMemory(outerPaddedKey, sizeof(outerPaddedKey));
+	clearMemory(innerHash, sizeof(innerHash));
 }
 
-// Create bulletproof blindless
-vector<uint8_t> createBulletproofBlindless(const uint8_t *contextSeed, size_t contextSeedSize, uint8_t *tauX, size_t tauXSize, const uint8_t *tOne, size_t tOneSize, const uint8_t *tTwo, size_t tTwoSize, const uint8_t *commit, size_t commitSize, const char *value, const uint8_t *nonce, size_t nonceSize, const uint8_t *extraCommit, size_t extraCommitSize, const uint8_t *message, size_t messageSize) {
+// Scalar is valid
+bool scalarIsValid(const uint8_t *scalar, size_t scalarSize) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if creating bulletproof blindless failed
-	vector<uint8_t> proof(Secp256k1Zkp::bulletproofProofSize());
-	char proofSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
-	if(!Secp256k1Zkp::createBulletproofBlindless(proof.data(), proofSize, tauX, tauXSize, tOne, tOneSize, tTwo, tTwoSize, commit, commitSize, value, nonce, nonceSize, extraCommit, extraCommitSize, message, messageSize)) {
+	// Return if scalar has the correct size and is less than the order
+	return scalarSize == SCALAR_SIZE && memcmp(scalar, SCALAR_ORDER, SCALAR_SIZE) < 0;
+}
+
+// Scalar is zero
+bool scalarIsZero(const uint8_t *scalar) {
+
+	// Go through all of the scalar's bytes
+	uint8_t result = 0;
+	for(size_t i = 0; i < SCALAR_SIZE; ++i) {
 	
-		// Throw error
-		throw runtime_error("Creating bulletproof blindless failed");
+		// Include byte in the result
+		result |= scalar[i];
 	}
 	
-	// Set proof's size to proof size
-	proof.resize(strtoull(proofSize, nullptr, 10));
-	
-	// Return proof
-	return proof;
+	// Return if all bytes are zero
+	return !result;
 }
 
-// Rewind bulletproof
-tuple<string, vector<uint8_t>, vector<uint8_t>> rewindBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize) {
+// Scalar sum
+void scalarSum(uint8_t *result, const uint8_t *const *scalars, size_t numberOfScalars, size_t numberOfPositiveScalars) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if performing rewind bulletproof failed
-	char value[MAX_64_BIT_INTEGER_STRING_LENGTH];
-	vector<uint8_t> blind(Secp256k1Zkp::blindSize());
-	vector<uint8_t> message(Secp256k1Zkp::bulletproofMessageSize());
-	if(!Secp256k1Zkp::rewindBulletproof(value, blind.data(), message.data(), proof, proofSize, commit, commitSize, nonce, nonceSize)) {
+	// Check if summing the scalars failed
+	if(!Secp256k1Zkp::secp256k1_pedersen_blind_sum(Secp256k1Zkp::context, result, scalars, numberOfScalars, numberOfPositiveScalars)) {
 	
 		// Throw error
-		throw runtime_error("Performing rewind bulletproof failed");
+		throw runtime_error("Scalar sum failed");
 	}
-	
-	// Return bulletproof data
-	return {value, blind, message};
 }
 
-// Verify bulletproof
-bool verifyBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *extraCommit, size_t extraCommitSize) {
+// SipHash
+uint64_t sipHash(const uint64_t key[2], const uint8_t *data, size_t dataSize) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Initialize state
+	uint64_t state[] = {key[0] ^ 0x736F6D6570736575, key[1] ^ 0x646F72616E646F6D, key[0] ^ 0x6C7967656E657261, key[1] ^ 0x7465646279746573};
 	
-	// Check if bulletproof isn't verified
-	if(!Secp256k1Zkp::verifyBulletproof(proof, proofSize, commit, commitSize, extraCommit, extraCommitSize)) {
+	// Initialize round
+	auto round = [&state]() {
 	
-		// Return false
-		return false;
+		// Initialize rotate left
+		auto rotateLeft = [](uint64_t value, unsigned int amount) -> uint64_t {
+		
+			// Return value rotated left by the amount
+			return (value << amount) | (value >> (sizeof(value) * CHAR_BIT - amount));
+		};
+		
+		// Mix state
+		state[0] += state[1];
+		state[1] = rotateLeft(state[1], 13) ^ state[0];
+		state[0] = rotateLeft(state[0], 32);
+		state[2] += state[3];
+		state[3] = rotateLeft(state[3], 16) ^ state[2];
+		state[0] += state[3];
+		state[3] = rotateLeft(state[3], 21) ^ state[0];
+		state[2] += state[1];
+		state[1] = rotateLeft(state[1], 17) ^ state[2];
+		state[2] = rotateLeft(state[2], 32);
+	};
+	
+	// Go through all of the data's words and the final word which includes the data's size
+	for(size_t i = 0; i <= dataSize / sizeof(uint64_t); ++i) {
+	
+		// Get word as a little endian value
+		uint64_t word = (i == dataSize / sizeof(uint64_t)) ? static_cast<uint64_t>(dataSize) << ((sizeof(uint64_t) - 1) * CHAR_BIT) : 0;
+		for(size_t j = 0; j < sizeof(uint64_t) && i * sizeof(uint64_t) + j < dataSize; ++j) {
+		
+			// Include byte in the word
+			word |= static_cast<uint64_t>(data[i * sizeof(uint64_t) + j]) << (j * CHAR_BIT);
+		}
+		
+		// Compress word into the state
+		state[3] ^= word;
+		round();
+		round();
+		state[0] ^= word;
 	}
 	
-	// Return true
-	return true;
+	// Finalize state
+	state[2] ^= UINT8_MAX;
+	round();
+	round();
+	round();
+	round();
+	
+	// Return result
+	return state[0] ^ state[1] ^ state[2] ^ state[3];
 }
 
-// Public key from secret key
-vector<uint8_t> publicKeyFromSecretKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize) {
+// Invoke command
+SecureBytes invokeCommand(vector<uint8_t> (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if getting public key from secret key failed
-	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize());
-	if(!Secp256k1Zkp::publicKeyFromSecretKey(publicKey.data(), secretKey, secretKeySize)) {
+	// Check if the number of arguments is invalid
+	if(arguments.size() != 1) {
 	
 		// Throw error
-		throw runtime_error("Getting public key from secret key failed");
+		throw runtime_error("Number of command arguments is invalid");
 	}
 	
-	// Return public key
-	return publicKey;
+	// Return running function
+	const vector<uint8_t> result = function(contextSeed, contextSeedSize, arguments[0].data(), arguments[0].size());
+	return SecureBytes(result.cbegin(), result.cend());
 }
 
-// Public key from data
-vector<uint8_t> publicKeyFromData(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *data, size_t dataSize) {
+// Invoke command
+SecureBytes invokeCommand(vector<uint8_t> (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const uint8_t *second, size_t secondSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if getting public key from data failed
-	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize());
-	if(!Secp256k1Zkp::publicKeyFromData(publicKey.data(), data, dataSize)) {
+	// Check if the number of arguments is invalid
+	if(arguments.size() != 2) {
 	
 		// Throw error
-		throw runtime_error("Getting public key from data failed");
+		throw runtime_error("Number of command arguments is invalid");
 	}
 	
-	// Return public key
-	return publicKey;
+	// Return running function
+	const vector<uint8_t> result = function(contextSeed, contextSeedSize, arguments[0].data(), arguments[0].size(), arguments[1].data(), arguments[1].size());
+	return SecureBytes(result.cbegin(), result.cend());
 }
 
-// Uncompress public key
-vector<uint8_t> uncompressPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize) {
+// Invoke command
+SecureBytes invokeCommand(vector<uint8_t> (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const char *value), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if uncompressing the public key failed
-	vector<uint8_t> uncompressedPublicKey(Secp256k1Zkp::uncompressedPublicKeySize());
-	if(!Secp256k1Zkp::uncompressPublicKey(uncompressedPublicKey.data(), publicKey, publicKeySize)) {
+	// Check if the number of arguments is invalid
+	if(arguments.size() != 2) {
 	
 		// Throw error
-		throw runtime_error("Uncompressing the public key failed");
+		throw runtime_error("Number of command arguments is invalid");
 	}
 	
-	// Return uncompressed public key
-	return uncompressedPublicKey;
+	// Return running function with the value as a string
+	const string value(arguments[1].cbegin(), arguments[1].cend());
+	const vector<uint8_t> result = function(contextSeed, contextSeedSize, arguments[0].data(), arguments[0].size(), value.c_str());
+	return SecureBytes(result.cbegin(), result.cend());
 }
 
-// Secret key tweak add
-vector<uint8_t> secretKeyTweakAdd(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *tweak, size_t tweakSize) {
+// Invoke command
+SecureBytes invokeCommand(SecureBytes (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const uint8_t *second, size_t secondSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if performing secret key tweak add failed
-	vector<uint8_t> result(Secp256k1Zkp::secretKeySize());
-	if(!Secp256k1Zkp::secretKeyTweakAdd(result.data(), secretKey, secretKeySize, tweak, tweakSize)) {
+	// Check if the number of arguments is invalid
+	if(arguments.size() != 2) {
 	
 		// Throw error
-		throw runtime_error("Performing secret key tweak add failed");
+		throw runtime_error("Number of command arguments is invalid");
 	}
 	
-	// Return result
-	return result;
+	// Return running function
+	return function(contextSeed, contextSeedSize, arguments[0].data(), arguments[0].size(), arguments[1].data(), arguments[1].size());
 }
 
-// Public key tweak add
-vector<uint8_t> publicKeyTweakAdd(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *tweak, size_t tweakSize) {
+// Invoke command
+SecureBytes invokeCommand(SecureBytes (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const char *value), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if performing public key tweak add failed
-	vector<uint8_t> result(Secp256k1Zkp::publicKeySize());
-	if(!Secp256k1Zkp::publicKeyTweakAdd(result.data(), publicKey, publicKeySize, tweak, tweakSize)) {
+	// Check if the number of arguments is invalid
+	if(arguments.size() != 2) {
 	
 		// Throw error
-		throw runtime_error("Performing public key tweak add failed");
+		throw runtime_error("Number of command arguments is invalid");
 	}
 	
-	// Return result
-	return result;
+	// Return running function with the value as a string
+	const string value(arguments[1].cbegin(), arguments[1].cend());
+	return function(contextSeed, contextSeedSize, arguments[0].data(), arguments[0].size(), value.c_str());
 }
 
-// Secret key tweak multiply
-vector<uint8_t> secretKeyTweakMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *tweak, size_t tweakSize) {
+// Invoke command
+SecureBytes invokeCommand(bool (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if performing secret key tweak multiply failed
-	vector<uint8_t> result(Secp256k1Zkp::secretKeySize());
-	if(!Secp256k1Zkp::secretKeyTweakMultiply(result.data(), secretKey, secretKeySize, tweak, tweakSize)) {
+	// Check if the number of arguments is invalid
+	if(arguments.size() != 1) {
 	
 		// Throw error
-		throw runtime_error("Performing secret key tweak multiply failed");
+		throw runtime_error("Number of command arguments is invalid");
 	}
 	
-	// Return result
-	return result;
+	// Return running function as a byte
+	return SecureBytes(1, function(contextSeed, contextSeedSize, arguments[0].data(), arguments[0].size()));
 }
 
-// Public key tweak multiply
-vector<uint8_t> publicKeyTweakMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *tweak, size_t tweakSize) {
+// Invoke command
+SecureBytes invokeCommand(bool (*function)(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *first, size_t firstSize, const uint8_t *second, size_t secondSize, const uint8_t *third, size_t thirdSize), const uint8_t *contextSeed, size_t contextSeedSize, const vector<SecureBytes> &arguments) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if performing public key tweak multiply failed
-	vector<uint8_t> result(Secp256k1Zkp::publicKeySize());
-	if(!Secp256k1Zkp::publicKeyTweakMultiply(result.data(), publicKey, publicKeySize, tweak, tweakSize)) {
+	// Check if the number of arguments is invalid
+	if(arguments.size() != 3) {
 	
 		// Throw error
-		throw runtime_error("Performing public key tweak multiply failed");
+		throw runtime_error("Number of command arguments is invalid");
 	}
 	
-	// Return result
-	return result;
+	// Return running function as a byte
+	return SecureBytes(1, function(contextSeed, contextSeedSize, arguments[0].data(), arguments[0].size(), arguments[1].data(), arguments[1].size(), arguments[2].data(), arguments[2].size()));
 }
 
-// Shared secret key from secret key and public key
-vector<uint8_t> sharedSecretKeyFromSecretKeyAndPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *publicKey, size_t publicKeySize) {
+// Write all
+void writeAll(int file, const uint8_t *data, size_t size) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Go through all bytes in the data
+	for(size_t i = 0; i < size;) {
 	
-	// Check if getting shared secret key from secret key and public key failed
-	vector<uint8_t> sharedSecretKey(Secp256k1Zkp::secretKeySize());
-	if(!Secp256k1Zkp::sharedSecretKeyFromSecretKeyAndPublicKey(sharedSecretKey.data(), secretKey, secretKeySize, publicKey, publicKeySize)) {
-	
-		// Throw error
-		throw runtime_error("Getting shared secret key from secret key and public key failed");
+		// Check if writing to file failed
+		const ssize_t bytesWritten = write(file, &data[i], size - i);
+		if(bytesWritten <= 0) {
+		
+			// Check if write was interrupted
+			if(bytesWritten == -1 && errno == EINTR) {
+			
+				// Continue
+				continue;
+			}
+			
+			// Throw error
+			throw runtime_error("Writing to file failed");
+		}
+		
+		// Update index
+		i += bytesWritten;
 	}
-	
-	// Return shared secret key
-	return sharedSecretKey;
 }
 
-// Pedersen commit
-vector<uint8_t> pedersenCommit(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value) {
+// ChaCha20
+void chaCha20(uint8_t *result, const uint8_t *data, size_t dataSize, const uint8_t *key, const uint8_t *nonce) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Initialize read little-endian word
+	auto readWord = [](const uint8_t *bytes) -> uint32_t {
 	
-	// Check if performing Pedersen commit failed
-	vector<uint8_t> result(Secp256k1Zkp::commitSize());
-	if(!Secp256k1Zkp::pedersenCommit(result.data(), blind, blindSize, value)) {
+		// Return word
+		return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) | (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+	};
 	
-		// Throw error
-		throw runtime_error("Performing Pedersen commit failed");
+	// Initialize quarter round
+	auto quarterRound = [](uint32_t &a, uint32_t &b, uint32_t &c, uint32_t &d) {
+	
+		// Mix words
+		a += b; d ^= a; d = (d << 16) | (d >> 16);
+		c += d; b ^= c; b = (b << 12) | (b >> 20);
+		a += b; d ^= a; d = (d << 8) | (d >> 24);
+		c += d; b ^= c; b = (b << 7) | (b >> 25);
+	};
+	
+	// Initialize state with the constants, key, counter, and nonce
+	uint32_t state[CHACHA20_BLOCK_SIZE / sizeof(uint32_t)] = {0x61707865, 0x3320646E, 0x79622D32, 0x6B206574};
+	for(size_t i = 0; i < CHACHA20_KEY_SIZE / sizeof(uint32_t); ++i) {
+	
+		// Set key word in the state
+		state[4 + i] = readWord(&key[i * sizeof(uint32_t)]);
 	}
+	for(size_t i = 0; i < CHACHA20_NONCE_SIZE / sizeof(uint32_t); ++i) {
 	
-	// Return result
-	return result;
-}
-
-// Pedersen commit sum
-vector<uint8_t> pedersenCommitSum(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *positiveCommits, size_t positiveCommitsSizes[], size_t numberOfPositiveCommits, const uint8_t *negativeCommits, size_t negativeCommitsSizes[], size_t numberOfNegativeCommits) {
-
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+		// Set nonce word in the state
+		state[13 + i] = readWord(&nonce[i * sizeof(uint32_t)]);
+	}
 	
-	// Check if performing Pedersen commit sum failed
-	vector<uint8_t> result(Secp256k1Zkp::commitSize());
-	if(!Secp256k1Zkp::pedersenCommitSum(result.data(), positiveCommits, positiveCommitsSizes, numberOfPositiveCommits, negativeCommits, negativeCommitsSizes, numberOfNegativeCommits)) {
+	// Go through all blocks
+	uint32_t working[CHACHA20_BLOCK_SIZE / sizeof(uint32_t)];
+	uint8_t keyStream[CHACHA20_BLOCK_SIZE];
+	for(size_t offset = 0; offset < dataSize; offset += CHACHA20_BLOCK_SIZE, ++state[12]) {
 	
-		// Throw error
-		throw runtime_error("Performing Pedersen commit sum failed");
+		// Perform twenty rounds on a copy of the state
+		memcpy(working, state, sizeof(working));
+		for(int i = 0; i < 10; ++i) {
+		
+			// Perform column rounds
+			quarterRound(working[0], working[4], working[8], working[12]);
+			quarterRound(working[1], working[5], working[9], working[13]);
+			quarterRound(working[2], working[6], working[10], working[14]);
+			quarterRound(working[3], working[7], working[11], working[15]);
+			
+			// Perform diagonal rounds
+			quarterRound(working[0], working[5], working[10], working[15]);
+			quarterRound(working[1], working[6], working[11], working[12]);
+			quarterRound(working[2], working[7], working[8], working[13]);
+			quarterRound(working[3], working[4], working[9], working[14]);
+		}
+		
+		// Go through all words in the block
+		for(size_t i = 0; i < CHACHA20_BLOCK_SIZE / sizeof(uint32_t); ++i) {
+		
+			// Set key stream bytes to the word added to the state
+			const uint32_t word = working[i] + state[i];
+			keyStream[i * sizeof(uint32_t)] = word;
+			keyStream[i * sizeof(uint32_t) + 1] = word >> 8;
+			keyStream[i * sizeof(uint32_t) + 2] = word >> 16;
+			keyStream[i * sizeof(uint32_t) + 3] = word >> 24;
+		}
+		
+		// Go through all bytes in the block
+		for(size_t i = 0; i < CHACHA20_BLOCK_SIZE && offset + i < dataSize; ++i) {
+		
+			// Set result byte to the data byte encrypted with the key stream
+			result[offset + i] = data[offset + i] ^ keyStream[i];
+		}
 	}
 	
-	// Return result
-	return result;
+	// Clear state, working state, and key stream
+	clearMemory(state, sizeof(state));
+	clearMemory(working, sizeof(working));
+	clearMemory(keyStream, sizeof(keyStream));
+}
+
+// Rotate right
+uint32_t rotateRight(uint32_t value, unsigned int amount) {
+
+	// Return value rotated right by amount
+	return (value >> amount) | (value << (32 - amount));
 }
 
-// Pedersen commit to public key
-vector<uint8_t> pedersenCommitToPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *commit, size_t commitSize) {
+// SHA-256 transform portable
+void sha256TransformPortable(uint32_t *state, const uint8_t *blocks, size_t numberOfBlocks) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if getting public key from Pedersen commit failed
-	vector<uint8_t> publicKey(Secp256k1Zkp::publicKeySize());
-	if(!Secp256k1Zkp::pedersenCommitToPublicKey(publicKey.data(), commit, commitSize)) {
+	// Go through all blocks
+	for(; numberOfBlocks; --numberOfBlocks, blocks += SHA256_BLOCK_SIZE) {
 	
-		// Throw error
-		throw runtime_error("Getting public key from Pedersen commit failed");
+		// Go through all words in the block
+		uint32_t words[64];
+		for(size_t i = 0; i < 16; ++i) {
+		
+			// Set word to the block's big endian word
+			words[i] = (static_cast<uint32_t>(blocks[i * sizeof(words[0])]) << 24) | (static_cast<uint32_t>(blocks[i * sizeof(words[0]) + 1]) << 16) | (static_cast<uint32_t>(blocks[i * sizeof(words[0]) + 2]) << 8) | blocks[i * sizeof(words[0]) + 3];
+		}
+		
+		// Go through all remaining words
+		for(size_t i = 16; i < 64; ++i) {
+		
+			// Set word from previous words
+			words[i] = words[i - 16] + (rotateRight(words[i - 15], 7) ^ rotateRight(words[i - 15], 18) ^ (words[i - 15] >> 3)) + words[i - 7] + (rotateRight(words[i - 2], 17) ^ rotateRight(words[i - 2], 19) ^ (words[i - 2] >> 10));
+		}
+		
+		// Initialize working variables to the state
+		uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7];
+		
+		// Go through all rounds
+		for(size_t i = 0; i < 64; ++i) {
+		
+			// Perform round
+			const uint32_t temporaryOne = h + (rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25)) + ((e & f) ^ (~e & g)) + SHA256_ROUND_CONSTANTS[i] + words[i];
+			const uint32_t temporaryTwo = (rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+			h = g;
+			g = f;
+			f = e;
+			e = d + temporaryOne;
+			d = c;
+			c = b;
+			b = a;
+			a = temporaryOne + temporaryTwo;
+		}
+		
+		// Add working variables to the state
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
 	}
-	
-	// Return public key
-	return publicKey;
 }
 
-// Public key to Pedersen commit
-vector<uint8_t> publicKeyToPedersenCommit(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize) {
+// Check if x86-64
+#ifdef __x86_64__
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// SHA-256 transform SHA-NI
+	__attribute__((target("sha,sse4.1,ssse3"))) void sha256TransformShaNi(uint32_t *state, const uint8_t *blocks, size_t numberOfBlocks) {
 	
-	// Check if getting Pedersen commit from public key failed
-	vector<uint8_t> commit(Secp256k1Zkp::commitSize());
-	if(!Secp256k1Zkp::publicKeyToPedersenCommit(commit.data(), publicKey, publicKeySize)) {
+		// Get byte swap mask that changes each message word to little endian
+		const __m128i byteSwapMask = _mm_set_epi64x(0x0C0D0E0F08090A0B, 0x0405060700010203);
+		
+		// Get state as ABEF and CDGH which is the order that the SHA-NI instructions use
+		const __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[0])), 0xB1);
+		__m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[4])), 0x1B);
+		__m128i abef = _mm_alignr_epi8(abcd, cdgh, 8);
+		cdgh = _mm_blend_epi16(cdgh, abcd, 0xF0);
+		
+		// Go through all blocks
+		for(; numberOfBlocks; --numberOfBlocks, blocks += SHA256_BLOCK_SIZE) {
+		
+			// Save state
+			const __m128i savedAbef = abef;
+			const __m128i savedCdgh = cdgh;
+			
+			// Go through all groups of four rounds
+			__m128i messages[4];
+			for(size_t i = 0; i < 16; ++i) {
+			
+				// Check if group's message words are in the block
+				if(i < 4) {
+				
+					// Set group's message words to the block's big endian words
+					messages[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&blocks[i * sizeof(__m128i)])), byteSwapMask);
+				}
+				
+				// Perform group's first two rounds
+				__m128i words = _mm_add_epi32(messages[i % 4], _mm_load_si128(reinterpret_cast<const __m128i *>(&SHA256_ROUND_CONSTANTS[i * 4])));
+				cdgh = _mm_sha256rnds2_epu32(cdgh, abef, words);
+				
+				// Check if finishing the next group's message words
+				if(i >= 3 && i < 15) {
+				
+					// Finish the next group's message words
+					messages[(i + 1) % 4] = _mm_sha256msg2_epu32(_mm_add_epi32(messages[(i + 1) % 4], _mm_alignr_epi8(messages[i % 4], messages[(i + 3) % 4], 4)), messages[i % 4]);
+				}
+				
+				// Perform group's last two rounds
+				words = _mm_shuffle_epi32(words, 0x0E);
+				abef = _mm_sha256rnds2_epu32(abef, cdgh, words);
+				
+				// Check if starting the message words three groups ahead
+				if(i >= 1 && i < 13) {
+				
+					// Start the message words three groups ahead
+					messages[(i + 3) % 4] = _mm_sha256msg1_epu32(messages[(i + 3) % 4], messages[i % 4]);
+				}
+			}
+			
+			// Add saved state to the state
+			abef = _mm_add_epi32(abef, savedAbef);
+			cdgh = _mm_add_epi32(cdgh, savedCdgh);
+		}
+		
+		// Set state from ABEF and CDGH
+		const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+		const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&state[0]), _mm_blend_epi16(feba, dchg, 0xF0));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+	}
 	
-		// Throw error
-		throw runtime_error("Getting Pedersen commit from public key failed");
+	// Rotate right lanes
+	__attribute__((target("avx2"))) __m256i rotateRightLanes(__m256i value, int amount) {
+	
+		// Return each lane of value rotated right by amount
+		return _mm256_or_si256(_mm256_srli_epi32(value, amount), _mm256_slli_epi32(value, 32 - amount));
 	}
 	
-	// Return commit
-	return commit;
-}
+	// SHA-256 transform lanes AVX2
+	__attribute__((target("avx2"))) void sha256TransformLanesAvx2(uint32_t states[][SHA256_NUMBER_OF_LANES], const uint8_t *const blocks[]) {
+	
+		// Get byte swap mask that changes each word to little endian
+		const __m256i byteSwapMask = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+		
+		// Go through both halves of the blocks
+		__m256i words[16];
+		for(size_t i = 0; i < 2; ++i) {
+		
+			// Get each lane's eight words in the half
+			__m256i rows[SHA256_NUMBER_OF_LANES];
+			for(size_t j = 0; j < SHA256_NUMBER_OF_LANES; ++j) {
+			
+				// Set row to the lane's block's big endian words
+				rows[j] = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(&blocks[j][i * sizeof(__m256i)])), byteSwapMask);
+			}
+			
+			// Transpose rows so that each word contains that word from every lane
+			const __m256i lowOne = _mm256_unpacklo_epi32(rows[0], rows[1]), highOne = _mm256_unpackhi_epi32(rows[0], rows[1]);
+			const __m256i lowTwo = _mm256_unpacklo_epi32(rows[2], rows[3]), highTwo = _mm256_unpackhi_epi32(rows[2], rows[3]);
+			const __m256i lowThree = _mm256_unpacklo_epi32(rows[4], rows[5]), highThree = _mm256_unpackhi_epi32(rows[4], rows[5]);
+			const __m256i lowFour = _mm256_unpacklo_epi32(rows[6], rows[7]), highFour = _mm256_unpackhi_epi32(rows[6], rows[7]);
+			const __m256i firstLanes[] = {_mm256_unpacklo_epi64(lowOne, lowTwo), _mm256_unpackhi_epi64(lowOne, lowTwo), _mm256_unpacklo_epi64(highOne, highTwo), _mm256_unpackhi_epi64(highOne, highTwo)};
+			const __m256i lastLanes[] = {_mm256_unpacklo_epi64(lowThree, lowFour), _mm256_unpackhi_epi64(lowThree, lowFour), _mm256_unpacklo_epi64(highThree, highFour), _mm256_unpackhi_epi64(highThree, highFour)};
+			for(size_t j = 0; j < 4; ++j) {
+			
+				// Set words from the first and last lanes
+				words[i * 8 + j] = _mm256_permute2x128_si256(firstLanes[j], lastLanes[j], 0x20);
+				words[i * 8 + j + 4] = _mm256_permute2x128_si256(firstLanes[j], lastLanes[j], 0x31);
+			}
+		}
+		
+		// Initialize working variables to the states
+		__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[0])), b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[1])), c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[2])), d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[3]));
+		__m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[4])), f = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[5])), g = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[6])), h = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[7]));
+		
+		// Go through all rounds
+		for(size_t i = 0; i < 64; ++i) {
+		
+			// Check if round's word isn't in the blocks
+			if(i >= 16) {
+			
+				// Set word from previous words
+				const __m256i &previousFifteen = words[(i - 15) % 16], &previousTwo = words[(i - 2) % 16];
+				words[i % 16] = _mm256_add_epi32(_mm256_add_epi32(words[i % 16], _mm256_xor_si256(_mm256_xor_si256(rotateRightLanes(previousFifteen, 7), rotateRightLanes(previousFifteen, 18)), _mm256_srli_epi32(previousFifteen, 3))), _mm256_add_epi32(words[(i - 7) % 16], _mm256_xor_si256(_mm256_xor_si256(rotateRightLanes(previousTwo, 17), rotateRightLanes(previousTwo, 19)), _mm256_srli_epi32(previousTwo, 10))));
+			}
+			
+			// Perform round
+			const __m256i temporaryOne = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, _mm256_xor_si256(_mm256_xor_si256(rotateRightLanes(e, 6), rotateRightLanes(e, 11)), rotateRightLanes(e, 25))), _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g))), _mm256_add_epi32(_mm256_set1_epi32(SHA256_ROUND_CONSTANTS[i]), words[i % 16]));
+			const __m256i temporaryTwo = _mm256_add_epi32(_mm256_xor_si256(_mm256_xor_si256(rotateRightLanes(a, 2), rotateRightLanes(a, 13)), rotateRightLanes(a, 22)), _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b))));
+			h = g;
+			g = f;
+			f = e;
+			e = _mm256_add_epi32(d, temporaryOne);
+			d = c;
+			c = b;
+			b = a;
+			a = _mm256_add_epi32(temporaryOne, temporaryTwo);
+		}
+		
+		// Add working variables to the states
+		const __m256i workingVariables[] = {a, b, c, d, e, f, g, h};
+		for(size_t i = 0; i < sizeof(workingVariables) / sizeof(workingVariables[0]); ++i) {
+		
+			// Add working variable to the state word in each lane
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(states[i]), _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(states[i])), workingVariables[i]));
+		}
+	}
+#endif
 
-// Create single-signer signature
-vector<uint8_t> createSingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *message, size_t messageSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *secretNonce, size_t secretNonceSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *publicNonce, size_t publicNonceSize, const uint8_t *publicNonceTotal, size_t publicNonceTotalSize, const uint8_t *seed, size_t seedSize) {
+// Check if using ARM64 SHA-256
+#ifdef USE_ARM64_SHA256
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if creating single-signer signature failed
-	vector<uint8_t> signature(Secp256k1Zkp::singleSignerSignatureSize());
-	if(!Secp256k1Zkp::createSingleSignerSignature(signature.data(), message, messageSize, secretKey, secretKeySize, secretNonce, secretNonceSize, publicKey, publicKeySize, publicNonce, publicNonceSize, publicNonceTotal, publicNonceTotalSize, seed, seedSize)) {
+	// SHA-256 transform ARM64
+	ARM64_SHA256_TARGET void sha256TransformArm64(uint32_t *state, const uint8_t *blocks, size_t numberOfBlocks) {
 	
-		// Throw error
-		throw runtime_error("Creating single-signer signature failed");
+		// Get state as ABCD and EFGH
+		uint32x4_t abcd = vld1q_u32(&state[0]);
+		uint32x4_t efgh = vld1q_u32(&state[4]);
+		
+		// Go through all blocks
+		for(; numberOfBlocks; --numberOfBlocks, blocks += SHA256_BLOCK_SIZE) {
+		
+			// Save state
+			const uint32x4_t savedAbcd = abcd;
+			const uint32x4_t savedEfgh = efgh;
+			
+			// Go through all message words in the block
+			uint32x4_t messages[4];
+			for(size_t i = 0; i < 4; ++i) {
+			
+				// Set message words to the block's big endian words
+				messages[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&blocks[i * sizeof(uint32x4_t)])));
+			}
+			
+			// Go through all groups of four rounds
+			for(size_t i = 0; i < 16; ++i) {
+			
+				// Get group's message words with round constants
+				const uint32x4_t words = vaddq_u32(messages[i % 4], vld1q_u32(&SHA256_ROUND_CONSTANTS[i * 4]));
+				
+				// Check if group's message words are needed four groups ahead
+				if(i < 12) {
+				
+					// Set message words four groups ahead
+					messages[i % 4] = vsha256su1q_u32(vsha256su0q_u32(messages[i % 4], messages[(i + 1) % 4]), messages[(i + 2) % 4], messages[(i + 3) % 4]);
+				}
+				
+				// Perform group's rounds
+				const uint32x4_t previousAbcd = abcd;
+				abcd = vsha256hq_u32(abcd, efgh, words);
+				efgh = vsha256h2q_u32(efgh, previousAbcd, words);
+			}
+			
+			// Add saved state to the state
+			abcd = vaddq_u32(abcd, savedAbcd);
+			efgh = vaddq_u32(efgh, savedEfgh);
+		}
+		
+		// Set state from ABCD and EFGH
+		vst1q_u32(&state[0], abcd);
+		vst1q_u32(&state[4], efgh);
 	}
-	
-	// Return signature
-	return signature;
-}
+#endif
 
-// Add single-signer signatures
-vector<uint8_t> addSingleSignerSignatures(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signatures, size_t signaturesSizes[], size_t numberOfSignatures, const uint8_t *publicNonceTotal, size_t publicNonceTotalSize) {
+// Get SHA-256 transform
+Sha256TransformFunction getSha256Transform() {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Check if x86-64
+	#ifdef __x86_64__
 	
-	// Check if adding single-signer signatures failed
-	vector<uint8_t> result(Secp256k1Zkp::singleSignerSignatureSize());
-	if(!Secp256k1Zkp::addSingleSignerSignatures(result.data(), signatures, signaturesSizes, numberOfSignatures, publicNonceTotal, publicNonceTotalSize)) {
+		// Check if CPU supports SHA, SSE4.1, and SSSE3 instructions
+		unsigned int eax, ebx, ecx, edx;
+		if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1) && (ecx & bit_SSSE3) && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_SHA)) {
+		
+			// Return SHA-256 transform SHA-NI
+			return sha256TransformShaNi;
+		}
 	
-		// Throw error
-		throw runtime_error("Adding single-signer signatures failed");
-	}
+	// Otherwise check if using ARM64 SHA-256
+	#elif defined(USE_ARM64_SHA256)
 	
-	// Return result
-	return result;
+		// Check if Linux
+		#ifdef __linux__
+		
+			// Check if CPU supports SHA-2 instructions
+			if(getauxval(AT_HWCAP) & ARM64_HWCAP_SHA2) {
+			
+				// Return SHA-256 transform ARM64
+				return sha256TransformArm64;
+			}
+		
+		// Otherwise
+		#else
+		
+			// Return SHA-256 transform ARM64 since all other supported ARM64 platforms have SHA-2 instructions
+			return sha256TransformArm64;
+		#endif
+	#endif
+	
+	// Return SHA-256 transform portable
+	return sha256TransformPortable;
 }
 
-// Verify single-signer signature
-bool verifySingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize, const uint8_t *message, size_t messageSize, const uint8_t *publicNonce, size_t publicNonceSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *publicKeyTotal, size_t publicKeyTotalSize, bool isPartial) {
+// Get SHA-256 lanes transform
+Sha256LanesTransformFunction getSha256LanesTransform() {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Check if x86-64
+	#ifdef __x86_64__
 	
-	// Check if single-signer signature isn't verified
-	if(!Secp256k1Zkp::verifySingleSignerSignature(signature, signatureSize, message, messageSize, publicNonce, publicNonceSize, publicKey, publicKeySize, publicKeyTotal, publicKeyTotalSize, isPartial)) {
-	
-		// Return false
-		return false;
-	}
+		// Check if SHA-256 transform isn't accelerated since it's faster than hashing in lanes
+		if(getSha256Transform() == sha256TransformPortable) {
+		
+			// Check if CPU supports AVX and the OS saves AVX registers
+			unsigned int eax, ebx, ecx, edx;
+			if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AVX) && (ecx & bit_OSXSAVE)) {
+			
+				// Check if the OS saves AVX registers and the CPU supports AVX2 instructions
+				unsigned int extendedControlRegister, extendedControlRegisterHigh;
+				__asm__("xgetbv" : "=a"(extendedControlRegister), "=d"(extendedControlRegisterHigh) : "c"(0));
+				if((extendedControlRegister & 0x06) == 0x06 && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & bit_AVX2)) {
+				
+					// Return SHA-256 transform lanes AVX2
+					return sha256TransformLanesAvx2;
+				}
+			}
+		}
+	#endif
 	
-	// Return true
-	return true;
+	// Return nothing
+	return nullptr;
 }
 
-// Single-signer signature from data
-vector<uint8_t> singleSignerSignatureFromData(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *data, size_t dataSize) {
+// SHA-256 pad
+size_t sha256Pad(uint8_t *result, const uint8_t *message, size_t messageSize) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Get number of blocks that the message's remaining bytes, padding, and length use
+	const size_t remainingSize = messageSize % SHA256_BLOCK_SIZE;
+	const size_t numberOfBlocks = (remainingSize < SHA256_BLOCK_SIZE - sizeof(uint64_t)) ? 1 : 2;
 	
-	// Check if getting single-signer signature from data failed
-	vector<uint8_t> signature(Secp256k1Zkp::singleSignerSignatureSize());
-	if(!Secp256k1Zkp::singleSignerSignatureFromData(signature.data(), data, dataSize)) {
+	// Set result to the message's remaining bytes followed by padding
+	memcpy(result, &message[messageSize - remainingSize], remainingSize);
+	result[remainingSize] = 0x80;
+	memset(&result[remainingSize + 1], 0, numberOfBlocks * SHA256_BLOCK_SIZE - sizeof(uint64_t) - remainingSize - 1);
 	
-		// Throw error
-		throw runtime_error("Getting single-signer signature from data failed");
+	// Append length in bits to the result as a 64-bit big endian value
+	const uint64_t lengthInBits = static_cast<uint64_t>(messageSize) * 8;
+	for(size_t i = 0; i < sizeof(lengthInBits); ++i) {
+	
+		// Set length byte
+		result[numberOfBlocks * SHA256_BLOCK_SIZE - 1 - i] = lengthInBits >> (i * 8);
 	}
 	
-	// Return signature
-	return signature;
+	// Return number of blocks
+	return numberOfBlocks;
 }
 
-// Compact single-signer signature
-vector<uint8_t> compactSingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize) {
+// Secure arena lease constructor
+SecureArenaLease::SecureArenaLease() {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Lock secure arenas
+	lock_guard<mutex> guard(*secureArenasLock);
 	
-	// Check if compacting single-signer signature failed
-	vector<uint8_t> result(Secp256k1Zkp::singleSignerSignatureSize());
-	if(!Secp256k1Zkp::compactSingleSignerSignature(result.data(), signature, signatureSize)) {
+	// Check if an unused secure arena exists
+	if(!unusedSecureArenas->empty()) {
 	
-		// Throw error
-		throw runtime_error("Compacting single-signer signature failed");
+		// Set arena to the unused secure arena
+		arena = unusedSecureArenas->back();
+		unusedSecureArenas->pop_back();
 	}
 	
-	// Return result
-	return result;
+	// Otherwise
+	else {
+	
+		// Set arena to a new secure arena that uses the next part of the secure arenas memory if available
+		const size_t index = secureArenas->size();
+		uint8_t *secureArenasMemory = getSecureArenasMemory();
+		secureArenas->emplace_back((secureArenasMemory && index < MAXIMUM_NUMBER_OF_SECURE_ARENAS) ? &secureArenasMemory[index * SECURE_ARENA_SIZE] : nullptr);
+		arena = &secureArenas->back();
+		
+		// Check if arena uses part of the secure arenas memory
+		if(index < MAXIMUM_NUMBER_OF_SECURE_ARENAS) {
+		
+			// Set arena as the owner of that part
+			secureArenaOwners[index].store(arena, memory_order_release);
+		}
+	}
 }
 
-// Uncompact single-signer signature
-vector<uint8_t> uncompactSingleSignerSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize) {
+// Secure arena lease destructor
+SecureArenaLease::~SecureArenaLease() {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if uncompacting single-signer signature failed
-	vector<uint8_t> result(Secp256k1Zkp::uncompactSingleSignerSignatureSize());
-	if(!Secp256k1Zkp::uncompactSingleSignerSignature(result.data(), signature, signatureSize)) {
+	// Lock secure arenas
+	lock_guard<mutex> guard(*secureArenasLock);
 	
-		// Throw error
-		throw runtime_error("Uncompacting single-signer signature failed");
-	}
+	// Return arena to the unused secure arenas so that its allocations that are still in use remain valid
+	unusedSecureArenas->push_back(arena);
 	
-	// Return result
-	return result;
+	// Release current secure arena so that secure memory that's allocated or deallocated later, like static objects' during exit, doesn't use the destroyed lease
+	currentSecureArena = nullptr;
+	secureArenaLeaseReleased = true;
 }
 
-// Combine public keys
-vector<uint8_t> combinePublicKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKeys, size_t publicKeysSizes[], size_t numberOfPublicKeys) {
+// Secure arena lease get current arena
+SecureArena *SecureArenaLease::getCurrentArena() {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+	// Check if the current thread's secure arena lease hasn't been created or released
+	if(!currentSecureArena && !secureArenaLeaseReleased) {
 	
-	// Check if combining public keys failed
-	vector<uint8_t> result(Secp256k1Zkp::publicKeySize());
-	if(!Secp256k1Zkp::combinePublicKeys(result.data(), publicKeys, publicKeysSizes, numberOfPublicKeys)) {
-	
-		// Throw error
-		throw runtime_error("Combining public keys failed");
+		// Set current secure arena to the arena of the current thread's secure arena lease which creates it
+		currentSecureArena = secureArenaLease.arena;
 	}
 	
-	// Return result
-	return result;
+	// Return current secure arena
+	return currentSecureArena;
 }
 
-// Create secret nonce
-vector<uint8_t> createSecretNonce(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *seed, size_t seedSize) {
+// Secure arena lease get owning arena
+SecureArena *SecureArenaLease::getOwningArena(const void *allocation) {
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if creating secure nonce failed
-	vector<uint8_t> nonce(Secp256k1Zkp::nonceSize());
-	if(!Secp256k1Zkp::createSecretNonce(nonce.data(), seed, seedSize)) {
+	// Check if allocation isn't in the secure arenas memory
+	const uint8_t *bytes = static_cast<const uint8_t *>(allocation);
+	const uint8_t *secureArenasMemory = getSecureArenasMemory();
+	if(!secureArenasMemory || bytes < secureArenasMemory || bytes >= &secureArenasMemory[MAXIMUM_NUMBER_OF_SECURE_ARENAS * SECURE_ARENA_SIZE]) {
 	
-		// Throw error
-		throw runtime_error("Creating secure nonce failed");
+		// Return nothing
+		return nullptr;
 	}
 	
-	// Return nonce
-	return nonce;
+	// Return the secure arena that owns the allocation's part of the secure arenas memory
+	return secureArenaOwners[(bytes - secureArenasMemory) / SECURE_ARENA_SIZE].load(memory_order_acquire);
 }
 
-// Create message hash signature
-vector<uint8_t> createMessageHashSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *messageHash, size_t messageHashSize, const uint8_t *secretKey, size_t secretKeySize) {
+// Check if tracing is enabled
+#ifdef ENABLE_TRACING
 
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
-	
-	// Check if creating message hash signature failed
-	vector<uint8_t> signature(Secp256k1Zkp::maximumMessageHashSignatureSize());
-	char signatureSize[MAX_64_BIT_INTEGER_STRING_LENGTH];
-	if(!Secp256k1Zkp::createMessageHashSignature(signature.data(), signatureSize, messageHash, messageHashSize, secretKey, secretKeySize)) {
+	// Get thread ID
+	uint64_t getThreadId() {
 	
-		// Throw error
-		throw runtime_error("Creating message hash signature failed");
+		// Check if Linux
+		#ifdef __linux__
+		
+			// Return kernel thread ID which matches what platform trace tools display
+			return syscall(SYS_gettid);
+		
+		// Otherwise check if Apple
+		#elif defined(__APPLE__)
+		
+			// Return thread ID
+			uint64_t threadId;
+			pthread_threadid_np(nullptr, &threadId);
+			return threadId;
+		
+		// Otherwise
+		#else
+		
+			// Return hash of the thread's ID
+			return hash<thread::id>()(this_thread::get_id());
+		#endif
 	}
 	
-	// Set signature's size to signature size
-	signature.resize(strtoull(signatureSize, nullptr, 10));
+	// Get trace timestamp
+	uint64_t getTraceTimestamp() {
 	
-	// Return signature
-	return signature;
-}
-
-// Verify message hash signature
-bool verifyMessageHashSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize, const uint8_t *messageHash, size_t messageHashSize, const uint8_t *publicKey, size_t publicKeySize) {
-
-	// Initialize
-	initialize(contextSeed, contextSeedSize);
+		// Return steady clock's time in nanoseconds
+		return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+	}
 	
-	// Check if message hash signature isn't verified
-	if(!Secp256k1Zkp::verifyMessageHashSignature(signature, signatureSize, messageHash, messageHashSize, publicKey, publicKeySize)) {
+	// Trace span constructor
+	TraceSpan::TraceSpan(const char *name) :
 	
-		// Return false
-		return false;
+		// Set name to name
+		name(name),
+		
+		// Set start to now if tracing
+		start(isTracing ? getTraceTimestamp() : 0)
+	{
+	
+		// Check if Android
+		#ifdef __ANDROID__
+		
+			// Check if Android trace exists
+			if(androidTraceBeginSection) {
+			
+				// Begin Android trace section
+				androidTraceBeginSection(name);
+			}
+		#endif
 	}
 	
-	// Return true
-	return true;
-}
-
-// Seed size
-size_t seedSize() {
-
-	// Return seed size
-	return Secp256k1Zkp::seedSize();
-}
-
-// Initialize
-void initialize(const uint8_t *seed, size_t seedSize) {
-
-	// Check if secp256k1-zkp context isn't initialized
-	if(!Secp256k1Zkp::context) {
+	// Trace span destructor
+	TraceSpan::~TraceSpan() {
 	
-		// Initialize secp256k1-zkp
-		Secp256k1Zkp::initialize(seed, seedSize);
+		// Check if Android
+		#ifdef __ANDROID__
 		
-		// Check if secp256k1-zkp context was initialized
-		if(Secp256k1Zkp::context) {
+			// Check if Android trace exists
+			if(androidTraceEndSection) {
+			
+				// End Android trace section
+				androidTraceEndSection();
+			}
+		#endif
 		
-			// Check if registering uninitializing secp256k1-zkp on exit failed
-			if(atexit([]() {
+		// Check if span started while tracing and tracing is still on
+		if(start && isTracing) {
+		
+			// Get duration
+			const uint64_t duration = getTraceTimestamp() - start;
 			
-				// Uninitialize secp256k1-zkp
-				Secp256k1Zkp::uninitialize();
-			})) {
+			// Cache thread ID since it doesn't change
+			static thread_local const uint64_t threadId = getThreadId();
 			
-				// Uninitialize secp256k1-zkp
-				Secp256k1Zkp::uninitialize();
+			// Create complete event with timestamps in microseconds as Chrome trace events expect, names are identifiers so they don't need escaping
+			char event[256];
+			const int eventLength = snprintf(event, sizeof(event), "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%llu,\"ts\":%llu.%03llu,\"dur\":%llu.%03llu}", name, static_cast<int>(getpid()), static_cast<unsigned long long>(threadId), static_cast<unsigned long long>(start / 1000), static_cast<unsigned long long>(start % 1000), static_cast<unsigned long long>(duration / 1000), static_cast<unsigned long long>(duration % 1000));
 			
-				// Throw error
-				throw runtime_error("Registering uninitializing secp256k1-zkp on exit failed");
+			// Check if creating event succeeded
+			if(eventLength > 0 && static_cast<size_t>(eventLength) < sizeof(event)) {
+			
+				// Lock trace
+				lock_guard<mutex> guard(traceLock);
+				
+				// Check if trace is still started
+				if(traceFile != -1) {
+				
+					// Append event to trace events
+					traceEvents += traceHasEvents ? ",\n" : "";
+					traceEvents.append(event, eventLength);
+					traceHasEvents = true;
+					
+					// Check if trace events are full
+					if(traceEvents.size() >= TRACE_BUFFER_SIZE) {
+					
+						// Try
+						try {
+						
+							// Write trace events to the trace file
+							writeAll(traceFile, reinterpret_cast<const uint8_t *>(traceEvents.data()), traceEvents.size());
+						}
+						
+						// Catch errors
+						catch(...) {
+						
+							// Ignore error since trace events are best effort
+						}
+						
+						// Clear trace events
+						traceEvents.clear();
+					}
+				}
 			}
 		}
 	}
-	
-	// Check if initializing secp256k1-zkp failed
-	if(!Secp256k1Zkp::context || !Secp256k1Zkp::scratchSpace || !Secp256k1Zkp::generators) {
-	
-		// Throw error
-		throw runtime_error("Initializing secp256k1-zkp failed");
-	}
-}
+#endif
@@ -4,18 +4,119 @@
 
 
 // Header files
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 using namespace std;
 
 
+// Secure memory function prototypes
+
+// Secure allocate
+void *secureAllocate(size_t size);
+
+// Secure deallocate
+void secureDeallocate(void *memory, size_t size);
+
+
+// Classes
+
+// Secure allocator class
+template<typename Type> class SecureAllocator {
+
+	// Public
+	public:
+	
+		// Value type
+		typedef Type value_type;
+		
+		// Constructor
+		SecureAllocator() noexcept {
+		}
+		
+		// Copy constructor
+		template<typename OtherType> SecureAllocator(const SecureAllocator<OtherType> &other) noexcept {
+		}
+		
+		// Allocate
+		Type *allocate(size_t numberOfValues) {
+		
+			// Return allocating values from the secure arena
+			return static_cast<Type *>(secureAllocate(numberOfValues * sizeof(Type)));
+		}
+		
+		// Deallocate
+		void deallocate(Type *values, size_t numberOfValues) noexcept {
+		
+			// Clear and release values
+			secureDeallocate(values, numberOfValues * sizeof(Type));
+		}
+		
+		// Equals operator
+		template<typename OtherType> bool operator==(const SecureAllocator<OtherType> &other) const noexcept {
+		
+			// Return true
+			return true;
+		}
+		
+		// Not equals operator
+		template<typename OtherType> bool operator!=(const SecureAllocator<OtherType> &other) const noexcept {
+		
+			// Return false
+			return false;
+		}
+};
+
+// Check if tracing is enabled
+#ifdef ENABLE_TRACING
+
+	// Trace span class
+	class TraceSpan {
+	
+		// Public
+		public:
+		
+			// Constructor
+			explicit TraceSpan(const char *name);
+			
+			// Destructor
+			~TraceSpan();
+		
+		// Private
+		private:
+		
+			// Name
+			const char *name;
+			
+			// Start
+			uint64_t start;
+	};
+	
+	// Trace span
+	#define TRACE_SPAN(name) const TraceSpan traceSpan(name)
+
+// Otherwise
+#else
+
+	// Trace span
+	#define TRACE_SPAN(name)
+#endif
+
+
+// Types
+
+// Secure bytes
+typedef vector<uint8_t, SecureAllocator<uint8_t>> SecureBytes;
+
+
 // Function prototypes
 
 // Blind switch
-vector<uint8_t> blindSwitch(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value);
+SecureBytes blindSwitch(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value);
 
 // Blind sum
-vector<uint8_t> blindSum(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *positiveBlinds, size_t positiveBlindsSizes[], size_t numberOfPositiveBlinds, const uint8_t *negativeBlinds, size_t negativeBlindsSizes[], size_t numberOfNegativeBlinds);
+SecureBytes blindSum(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *positiveBlinds, size_t positiveBlindsSizes[], size_t numberOfPositiveBlinds, const uint8_t *negativeBlinds, size_t negativeBlindsSizes[], size_t numberOfNegativeBlinds);
 
 // Is valid secret key
 bool isValidSecretKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize);
@@ -36,7 +137,7 @@ vector<uint8_t> createBulletproof(const uint8_t *contextSeed, size_t contextSeed
 vector<uint8_t> createBulletproofBlindless(const uint8_t *contextSeed, size_t contextSeedSize, uint8_t *tauX, size_t tauXSize, const uint8_t *tOne, size_t tOneSize, const uint8_t *tTwo, size_t tTwoSize, const uint8_t *commit, size_t commitSize, const char *value, const uint8_t *nonce, size_t nonceSize, const uint8_t *extraCommit, size_t extraCommitSize, const uint8_t *message, size_t messageSize);
 
 // Rewind bulletproof
-tuple<string, vector<uint8_t>, vector<uint8_t>> rewindBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize);
+tuple<string, SecureBytes, vector<uint8_t>> rewindBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize);
 
 // Verify bulletproof
 bool verifyBulletproof(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *extraCommit, size_t extraCommitSize);
@@ -51,19 +152,19 @@ vector<uint8_t> publicKeyFromData(const uint8_t *contextSeed, size_t contextSeed
 vector<uint8_t> uncompressPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize);
 
 // Secret key tweak add
-vector<uint8_t> secretKeyTweakAdd(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *tweak, size_t tweakSize);
+SecureBytes secretKeyTweakAdd(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *tweak, size_t tweakSize);
 
 // Public key tweak add
 vector<uint8_t> publicKeyTweakAdd(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *tweak, size_t tweakSize);
 
 // Secret key tweak multiply
-vector<uint8_t> secretKeyTweakMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *tweak, size_t tweakSize);
+SecureBytes secretKeyTweakMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *tweak, size_t tweakSize);
 
 // Public key tweak multiply
 vector<uint8_t> publicKeyTweakMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *tweak, size_t tweakSize);
 
 // Shared secret key from secret key and public key
-vector<uint8_t> sharedSecretKeyFromSecretKeyAndPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *publicKey, size_t publicKeySize);
+SecureBytes sharedSecretKeyFromSecretKeyAndPublicKey(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *publicKey, size_t publicKeySize);
 
 // Pedersen commit
 vector<uint8_t> pedersenCommit(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value);
@@ -99,7 +200,7 @@ vector<uint8_t> uncompactSingleSignerSignature(const uint8_t *contextSeed, size_
 vector<uint8_t> combinePublicKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKeys, size_t publicKeysSizes[], size_t numberOfPublicKeys);
 
 // Create secret nonce
-vector<uint8_t> createSecretNonce(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *seed, size_t seedSize);
+SecureBytes createSecretNonce(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *seed, size_t seedSize);
 
 // Create message hash signature
 vector<uint8_t> createMessageHashSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *messageHash, size_t messageHashSize, const uint8_t *secretKey, size_t secretKeySize);
@@ -107,6 +208,135 @@ vector<uint8_t> createMessageHashSignature(const uint8_t *contextSeed, size_t co
 // Verify message hash signature
 bool verifyMessageHashSignature(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *signature, size_t signatureSize, const uint8_t *messageHash, size_t messageHashSize, const uint8_t *publicKey, size_t publicKeySize);
 
+// Create bulletproof session
+uint64_t createBulletproofSession(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blind, size_t blindSize, const char *value, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize, const uint8_t *privateNonce, size_t privateNonceSize, const uint8_t *extraCommit, size_t extraCommitSize, const uint8_t *message, size_t messageSize);
+
+// Bulletproof session round one
+tuple<vector<uint8_t>, vector<uint8_t>> bulletproofSessionRoundOne(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session);
+
+// Bulletproof session round two
+vector<uint8_t> bulletproofSessionRoundTwo(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *tOne, size_t tOneSize, const uint8_t *tTwo, size_t tTwoSize);
+
+// Bulletproof session finalize
+vector<uint8_t> bulletproofSessionFinalize(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *tauX, size_t tauXSize);
+
+// Destroy bulletproof session
+void destroyBulletproofSession(uint64_t session);
+
+// Create aggsig session
+uint64_t createAggsigSession(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *message, size_t messageSize, const uint8_t *publicKeyTotal, size_t publicKeyTotalSize, const uint8_t *publicNonceTotal, size_t publicNonceTotalSize);
+
+// Aggsig session partial sign
+vector<uint8_t> aggsigSessionPartialSign(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *secretNonce, size_t secretNonceSize);
+
+// Aggsig session partial verify
+bool aggsigSessionPartialVerify(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *signature, size_t signatureSize, const uint8_t *publicKey, size_t publicKeySize);
+
+// Aggsig session aggregate
+vector<uint8_t> aggsigSessionAggregate(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *signatures, size_t signaturesSizes[], size_t numberOfSignatures);
+
+// Aggsig session verify
+bool aggsigSessionVerify(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t session, const uint8_t *signature, size_t signatureSize);
+
+// Destroy aggsig session
+void destroyAggsigSession(uint64_t session);
+
+// Create nonce pair
+tuple<SecureBytes, vector<uint8_t>> createNoncePair(const uint8_t *contextSeed, size_t contextSeedSize);
+
+// Public keys from secret keys
+vector<uint8_t> publicKeysFromSecretKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKeys, size_t secretKeysSizes[], size_t numberOfSecretKeys);
+
+// Pedersen commits
+vector<uint8_t> pedersenCommits(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blinds, size_t blindsSizes[], const char *values[], size_t numberOfCommits);
+
+// Blind switches
+SecureBytes blindSwitches(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *blinds, size_t blindsSizes[], const char *values[], size_t numberOfBlinds);
+
+// Shared secret keys from secret key and public keys
+SecureBytes sharedSecretKeysFromSecretKeyAndPublicKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *publicKeys, size_t publicKeysSizes[], size_t numberOfPublicKeys);
+
+// Derive child secret keys
+SecureBytes deriveChildSecretKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *secretKey, size_t secretKeySize, const uint8_t *chainCode, size_t chainCodeSize, uint32_t startIndex, uint32_t numberOfIndices, bool isHardened);
+
+// Derive child public keys
+vector<uint8_t> deriveChildPublicKeys(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *publicKey, size_t publicKeySize, const uint8_t *chainCode, size_t chainCodeSize, uint32_t startIndex, uint32_t numberOfIndices);
+
+// Create commit accumulator
+uint64_t createCommitAccumulator(const uint8_t *contextSeed, size_t contextSeedSize);
+
+// Commit accumulator add
+void commitAccumulatorAdd(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator, const uint8_t *commits, size_t commitsSizes[], size_t numberOfCommits);
+
+// Commit accumulator subtract
+void commitAccumulatorSubtract(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator, const uint8_t *commits, size_t commitsSizes[], size_t numberOfCommits);
+
+// Commit accumulator checkpoint
+uint64_t commitAccumulatorCheckpoint(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator);
+
+// Commit accumulator restore
+void commitAccumulatorRestore(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator, uint64_t checkpoint);
+
+// Commit accumulator total
+vector<uint8_t> commitAccumulatorTotal(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t accumulator);
+
+// Destroy commit accumulator
+void destroyCommitAccumulator(uint64_t accumulator);
+
+// Multi scalar multiply
+vector<uint8_t> multiScalarMultiply(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *points, size_t pointsSizes[], const uint8_t *scalars, size_t scalarsSizes[], size_t numberOfPoints);
+
+// Scalar batch inverse
+SecureBytes scalarBatchInverse(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *scalars, size_t scalarsSizes[], size_t numberOfScalars);
+
+// Evaluate scalar program
+SecureBytes evaluateScalarProgram(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *scalars, size_t scalarsSizes[], size_t numberOfScalars, const uint8_t *program, size_t programSize);
+
+// Execute commands
+SecureBytes executeCommands(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *commands, size_t commandsSize);
+
+// Set verification cache capacity
+void setVerificationCacheCapacity(size_t capacity);
+
+// Get verification cache statistics
+tuple<uint64_t, uint64_t, uint64_t> getVerificationCacheStatistics();
+
+// Set thread count
+void setThreadCount(size_t count);
+
+// Open rewind cache
+uint64_t openRewindCache(const uint8_t *contextSeed, size_t contextSeedSize, const char *path, const uint8_t *key, size_t keySize);
+
+// Rewind bulletproof with cache
+tuple<string, SecureBytes, vector<uint8_t>> rewindBulletproofWithCache(const uint8_t *contextSeed, size_t contextSeedSize, uint64_t cache, const uint8_t *proof, size_t proofSize, const uint8_t *commit, size_t commitSize, const uint8_t *nonce, size_t nonceSize);
+
+// Close rewind cache
+void closeRewindCache(uint64_t cache);
+
+// Scan outputs
+tuple<uint64_t, uint64_t> scanOutputs(const uint8_t *contextSeed, size_t contextSeedSize, const char *inputPath, uint64_t startOffset, const char *outputPath, const uint8_t *nonce, size_t nonceSize);
+
+// Aggregate transactions
+tuple<vector<uint8_t>, vector<uint8_t>, vector<uint8_t>> aggregateTransactions(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *inputs, size_t inputsSizes[], size_t numberOfInputs, const uint8_t *outputs, size_t outputsSizes[], size_t numberOfOutputs, const uint8_t *kernelExcesses, size_t kernelExcessesSizes[], size_t numberOfKernelExcesses, const uint8_t *offsets, size_t offsetsSizes[], size_t numberOfOffsets, const char *fees[], size_t numberOfFees);
+
+// Validate block
+tuple<uint8_t, uint64_t> validateBlock(const uint8_t *contextSeed, size_t contextSeedSize, const uint8_t *inputs, size_t inputsSizes[], size_t numberOfInputs, const uint8_t *outputs, size_t outputsSizes[], size_t numberOfOutputs, const uint8_t *proofs, size_t proofsSizes[], size_t numberOfProofs, const uint8_t *kernelExcesses, size_t kernelExcessesSizes[], size_t numberOfKernelExcesses, const uint8_t *signatures, size_t signaturesSizes[], size_t numberOfSignatures, const uint8_t *messages, size_t messagesSizes[], size_t numberOfMessages, const uint8_t *offset, size_t offsetSize, const char *reward);
+
+// Get stats
+string getStats();
+
+// Reset stats
+void resetStats();
+
+// Start trace
+void startTrace(const char *path);
+
+// Stop trace
+void stopTrace();
+
+// SHA-256 hashes
+vector<uint8_t> sha256Hashes(const uint8_t *messages, size_t messagesSizes[], size_t numberOfMessages);
+
 // Seed size
 size_t seedSize();
 
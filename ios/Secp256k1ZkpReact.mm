@@ -1,8 +1,7 @@
 // Header files
+#import <algorithm>
 #import <Foundation/Foundation.h>
-#import <iomanip>
 #import <Security/Security.h>
-#import <sstream>
 #import "secp256k1-zkp-react.h"
 #import "./Secp256k1ZkpReact.h"
 
@@ -17,6 +16,9 @@ static const size_t HEX_CHARACTER_LENGTH = (sizeof("FF") - sizeof('\0'));
 // Bits in a byte
 static const int BITS_IN_A_BYTE = 8;
 
+// Hex characters
+static const char HEX_CHARACTERS[] = "0123456789abcdef";
+
 
 // Global variables
 
@@ -27,10 +29,10 @@ static vector<uint8_t> contextSeed;
 // Function prototypes
 
 // From hex string
-static vector<uint8_t> fromHexString(const NSString *hexString);
+static SecureBytes fromHexString(const NSString *hexString);
 
 // To hex string
-static const NSString *toHexString(const vector<uint8_t> &input);
+template<typename Allocator> static const NSString *toHexString(const vector<uint8_t, Allocator> &input);
 
 // Character to number
 static uint8_t characterToNumber(char character);
@@ -67,7 +69,7 @@ RCT_EXPORT_METHOD(blindSwitch:(nonnull NSString *)blind
 		initializeContextSeed();
 		
 		// Get data from blind
-		const vector<uint8_t> blindData = fromHexString(blind);
+		const SecureBytes blindData = fromHexString(blind);
 		
 		// Check if getting data from value failed
 		const char *valueData = [value UTF8String];
@@ -123,52 +125,60 @@ RCT_EXPORT_METHOD(blindSum:(nonnull NSArray *)positiveBlinds
 		const NSUInteger numberOfPositiveBlinds = [positiveBlinds count];
 	
 		// Initialize positive blinds data and positive blinds sizes
-		vector<uint8_t> positiveBlindsData;
-		size_t positiveBlindsSizes[numberOfPositiveBlinds];
+		SecureBytes positiveBlindsData;
+		vector<size_t> positiveBlindsSizes(numberOfPositiveBlinds);
 		
 		// Go through all positive blinds
 		size_t i = 0;
 		for(const NSString *blind in positiveBlinds) {
 		
-			// Get data from blind
-			const vector<uint8_t> blindData = fromHexString(blind);
-			
-			// Append blind data to positive blinds data
-			positiveBlindsData.insert(positiveBlindsData.cend(), blindData.cbegin(), blindData.cend());
+			// Create autorelease pool for the blind's temporary objects
+			@autoreleasepool {
 			
-			// Append blind data's size to positive blinds sizes
-			positiveBlindsSizes[i] = blindData.size();
-			
-			// Increment index
-			++i;
+				// Get data from blind
+				const SecureBytes blindData = fromHexString(blind);
+				
+				// Append blind data to positive blinds data
+				positiveBlindsData.insert(positiveBlindsData.cend(), blindData.cbegin(), blindData.cend());
+				
+				// Append blind data's size to positive blinds sizes
+				positiveBlindsSizes[i] = blindData.size();
+				
+				// Increment index
+				++i;
+			}
 		}
 		
 		// Get number of negative blinds
 		const NSUInteger numberOfNegativeBlinds = [negativeBlinds count];
 		
 		// Initialize negative blinds data and negative blinds sizes
-		vector<uint8_t> negativeBlindsData;
-		size_t negativeBlindsSizes[numberOfNegativeBlinds];
+		SecureBytes negativeBlindsData;
+		vector<size_t> negativeBlindsSizes(numberOfNegativeBlinds);
 		
 		// Go through all negative blinds
 		i = 0;
 		for(const NSString *blind in negativeBlinds) {
 		
-			// Get data from blind
-			const vector<uint8_t> blindData = fromHexString(blind);
-			
-			// Append blind data to negative blinds data
-			negativeBlindsData.insert(negativeBlindsData.cend(), blindData.cbegin(), blindData.cend());
+			// Create autorelease pool for the blind's temporary objects
+			@autoreleasepool {
 			
-			// Append blind data's size to negative blinds sizes
-			negativeBlindsSizes[i] = blindData.size();
-			
-			// Increment index
-			++i;
+				// Get data from blind
+				const SecureBytes blindData = fromHexString(blind);
+				
+				// Append blind data to negative blinds data
+				negativeBlindsData.insert(negativeBlindsData.cend(), blindData.cbegin(), blindData.cend());
+				
+				// Append blind data's size to negative blinds sizes
+				negativeBlindsSizes[i] = blindData.size();
+				
+				// Increment index
+				++i;
+			}
 		}
 		
 		//Resolve performing blind sum
-		resolve(toHexString(blindSum(contextSeed.data(), contextSeed.size(), positiveBlindsData.data(), positiveBlindsSizes, numberOfPositiveBlinds, negativeBlindsData.data(), negativeBlindsSizes, numberOfNegativeBlinds)));
+		resolve(toHexString(blindSum(contextSeed.data(), contextSeed.size(), positiveBlindsData.data(), positiveBlindsSizes.data(), numberOfPositiveBlinds, negativeBlindsData.data(), negativeBlindsSizes.data(), numberOfNegativeBlinds)));
 	}
 
 	// Catch errors
@@ -209,7 +219,7 @@ RCT_EXPORT_METHOD(isValidSecretKey:(nonnull NSString *)secretKey
 		initializeContextSeed();
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(secretKey);
+		const SecureBytes secretKeyData = fromHexString(secretKey);
 
 		// Resolve if secret key is a valid secret key
 		resolve(toBool(isValidSecretKey(contextSeed.data(), contextSeed.size(), secretKeyData.data(), secretKeyData.size())));
@@ -253,7 +263,7 @@ RCT_EXPORT_METHOD(isValidPublicKey:(nonnull NSString *)publicKey
 		initializeContextSeed();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 
 		// Resolve if public key is a valid public key
 		resolve(toBool(isValidPublicKey(contextSeed.data(), contextSeed.size(), publicKeyData.data(), publicKeyData.size())));
@@ -297,7 +307,7 @@ RCT_EXPORT_METHOD(isValidCommit:(nonnull NSString *)commit
 		initializeContextSeed();
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(commit);
+		const SecureBytes commitData = fromHexString(commit);
 
 		// Resolve if commit is a valid commit
 		resolve(toBool(isValidCommit(contextSeed.data(), contextSeed.size(), commitData.data(), commitData.size())));
@@ -341,7 +351,7 @@ RCT_EXPORT_METHOD(isValidSingleSignerSignature:(nonnull NSString *)signature
 		initializeContextSeed();
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(signature);
+		const SecureBytes signatureData = fromHexString(signature);
 
 		// Resolve if signature is a valid single-signer signature
 		resolve(toBool(isValidSingleSignerSignature(contextSeed.data(), contextSeed.size(), signatureData.data(), signatureData.size())));
@@ -390,7 +400,7 @@ RCT_EXPORT_METHOD(createBulletproof:(nonnull NSString *)blind
 		initializeContextSeed();
 		
 		// Get data from blind
-		const vector<uint8_t> blindData = fromHexString(blind);
+		const SecureBytes blindData = fromHexString(blind);
 		
 		// Check if getting data from value failed
 		const char *valueData = [value UTF8String];
@@ -401,16 +411,16 @@ RCT_EXPORT_METHOD(createBulletproof:(nonnull NSString *)blind
 		}
 		
 		// Get data from nonce
-		const vector<uint8_t> nonceData = fromHexString(nonce);
+		const SecureBytes nonceData = fromHexString(nonce);
 		
 		// Get data from private nonce
-		const vector<uint8_t> privateNonceData = fromHexString(privateNonce);
+		const SecureBytes privateNonceData = fromHexString(privateNonce);
 		
 		// Get data from extra commit
-		const vector<uint8_t> extraCommitData = fromHexString(extraCommit);
+		const SecureBytes extraCommitData = fromHexString(extraCommit);
 		
 		// Get data from message
-		const vector<uint8_t> messageData = fromHexString(message);
+		const SecureBytes messageData = fromHexString(message);
 
 		// Resolve creating bulletproof
 		resolve(toHexString(createBulletproof(contextSeed.data(), contextSeed.size(), blindData.data(), blindData.size(), valueData, nonceData.data(), nonceData.size(), privateNonceData.data(), privateNonceData.size(), extraCommitData.data(), extraCommitData.size(), messageData.data(), messageData.size())));
@@ -461,16 +471,16 @@ RCT_EXPORT_METHOD(createBulletproofBlindless:(nonnull NSString *)tauX
 		initializeContextSeed();
 		
 		// Get data from tau X
-		vector<uint8_t> tauXData = fromHexString(tauX);
+		SecureBytes tauXData = fromHexString(tauX);
 		
 		// Get data from t one
-		const vector<uint8_t> tOneData = fromHexString(tOne);
+		const SecureBytes tOneData = fromHexString(tOne);
 		
 		// Get data from t two
-		const vector<uint8_t> tTwoData = fromHexString(tTwo);
+		const SecureBytes tTwoData = fromHexString(tTwo);
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(commit);
+		const SecureBytes commitData = fromHexString(commit);
 		
 		// Check if getting data from value failed
 		const char *valueData = [value UTF8String];
@@ -481,13 +491,13 @@ RCT_EXPORT_METHOD(createBulletproofBlindless:(nonnull NSString *)tauX
 		}
 		
 		// Get data from nonce
-		const vector<uint8_t> nonceData = fromHexString(nonce);
+		const SecureBytes nonceData = fromHexString(nonce);
 		
 		// Get data from extra commit
-		const vector<uint8_t> extraCommitData = fromHexString(extraCommit);
+		const SecureBytes extraCommitData = fromHexString(extraCommit);
 		
 		// Get data from message
-		const vector<uint8_t> messageData = fromHexString(message);
+		const SecureBytes messageData = fromHexString(message);
 
 		// Resolve creating bulletproof blindless
 		resolve(toHexString(createBulletproofBlindless(contextSeed.data(), contextSeed.size(), tauXData.data(), tauXData.size(), tOneData.data(), tOneData.size(), tTwoData.data(), tTwoData.size(), commitData.data(), commitData.size(), valueData, nonceData.data(), nonceData.size(), extraCommitData.data(), extraCommitData.size(), messageData.data(), messageData.size())));
@@ -533,16 +543,16 @@ RCT_EXPORT_METHOD(rewindBulletproof:(nonnull NSString *)proof
 		initializeContextSeed();
 		
 		// Get data from proof
-		const vector<uint8_t> proofData = fromHexString(proof);
+		const SecureBytes proofData = fromHexString(proof);
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(commit);
+		const SecureBytes commitData = fromHexString(commit);
 		
 		// Get data from nonce
-		const vector<uint8_t> nonceData = fromHexString(nonce);
+		const SecureBytes nonceData = fromHexString(nonce);
 
 		// Performing rewind bulletproof
-		const tuple<string, vector<uint8_t>, vector<uint8_t>> bulletproofData = rewindBulletproof(contextSeed.data(), contextSeed.size(), proofData.data(), proofData.size(), commitData.data(), commitData.size(), nonceData.data(), nonceData.size());
+		const tuple<string, SecureBytes, vector<uint8_t>> bulletproofData = rewindBulletproof(contextSeed.data(), contextSeed.size(), proofData.data(), proofData.size(), commitData.data(), commitData.size(), nonceData.data(), nonceData.size());
 		
 		// Check if getting value as a string failed
 		const NSString *valueString = [NSString stringWithUTF8String:get<0>(bulletproofData).c_str()];
@@ -604,13 +614,13 @@ RCT_EXPORT_METHOD(verifyBulletproof:(nonnull NSString *)proof
 		initializeContextSeed();
 		
 		// Get data from proof
-		const vector<uint8_t> proofData = fromHexString(proof);
+		const SecureBytes proofData = fromHexString(proof);
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(commit);
+		const SecureBytes commitData = fromHexString(commit);
 		
 		// Get data from extra commit
-		const vector<uint8_t> extraCommitData = fromHexString(extraCommit);
+		const SecureBytes extraCommitData = fromHexString(extraCommit);
 
 		// Return if bulletproof is verified
 		resolve(toBool(verifyBulletproof(contextSeed.data(), contextSeed.size(), proofData.data(), proofData.size(), commitData.data(), commitData.size(), extraCommitData.data(), extraCommitData.size())));
@@ -654,7 +664,7 @@ RCT_EXPORT_METHOD(publicKeyFromSecretKey:(nonnull NSString *)secretKey
 		initializeContextSeed();
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(secretKey);
+		const SecureBytes secretKeyData = fromHexString(secretKey);
 
 		// Resolve getting public key from secret key
 		resolve(toHexString(publicKeyFromSecretKey(contextSeed.data(), contextSeed.size(), secretKeyData.data(), secretKeyData.size())));
@@ -698,7 +708,7 @@ RCT_EXPORT_METHOD(publicKeyFromData:(nonnull NSString *)data
 		initializeContextSeed();
 		
 		// Get data from data
-		const vector<uint8_t> dataData = fromHexString(data);
+		const SecureBytes dataData = fromHexString(data);
 
 		// Resolve getting public key from data
 		resolve(toHexString(publicKeyFromData(contextSeed.data(), contextSeed.size(), dataData.data(), dataData.size())));
@@ -742,7 +752,7 @@ RCT_EXPORT_METHOD(uncompressPublicKey:(nonnull NSString *)publicKey
 		initializeContextSeed();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 
 		// Resolve uncompressing the public key
 		resolve(toHexString(uncompressPublicKey(contextSeed.data(), contextSeed.size(), publicKeyData.data(), publicKeyData.size())));
@@ -787,10 +797,10 @@ RCT_EXPORT_METHOD(secretKeyTweakAdd:(nonnull NSString *)secretKey
 		initializeContextSeed();
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(secretKey);
+		const SecureBytes secretKeyData = fromHexString(secretKey);
 		
 		// Get data from tweak
-		const vector<uint8_t> tweakData = fromHexString(tweak);
+		const SecureBytes tweakData = fromHexString(tweak);
 
 		// Resolve performing secret key tweak add
 		resolve(toHexString(secretKeyTweakAdd(contextSeed.data(), contextSeed.size(), secretKeyData.data(), secretKeyData.size(), tweakData.data(), tweakData.size())));
@@ -835,10 +845,10 @@ RCT_EXPORT_METHOD(publicKeyTweakAdd:(nonnull NSString *)publicKey
 		initializeContextSeed();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 		
 		// Get data from tweak
-		const vector<uint8_t> tweakData = fromHexString(tweak);
+		const SecureBytes tweakData = fromHexString(tweak);
 
 		// Resolve performing public key tweak add
 		resolve(toHexString(publicKeyTweakAdd(contextSeed.data(), contextSeed.size(), publicKeyData.data(), publicKeyData.size(), tweakData.data(), tweakData.size())));
@@ -883,10 +893,10 @@ RCT_EXPORT_METHOD(secretKeyTweakMultiply:(nonnull NSString *)secretKey
 		initializeContextSeed();
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(secretKey);
+		const SecureBytes secretKeyData = fromHexString(secretKey);
 		
 		// Get data from tweak
-		const vector<uint8_t> tweakData = fromHexString(tweak);
+		const SecureBytes tweakData = fromHexString(tweak);
 
 		// Resolve performing secret key tweak multiply
 		resolve(toHexString(secretKeyTweakMultiply(contextSeed.data(), contextSeed.size(), secretKeyData.data(), secretKeyData.size(), tweakData.data(), tweakData.size())));
@@ -931,10 +941,10 @@ RCT_EXPORT_METHOD(publicKeyTweakMultiply:(nonnull NSString *)publicKey
 		initializeContextSeed();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 		
 		// Get data from tweak
-		const vector<uint8_t> tweakData = fromHexString(tweak);
+		const SecureBytes tweakData = fromHexString(tweak);
 
 		// Resolve performing public key tweak multiply
 		resolve(toHexString(publicKeyTweakMultiply(contextSeed.data(), contextSeed.size(), publicKeyData.data(), publicKeyData.size(), tweakData.data(), tweakData.size())));
@@ -979,10 +989,10 @@ RCT_EXPORT_METHOD(sharedSecretKeyFromSecretKeyAndPublicKey:(nonnull NSString *)s
 		initializeContextSeed();
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(secretKey);
+		const SecureBytes secretKeyData = fromHexString(secretKey);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 		
 		// Resolve getting shared secret key from secret key and public key
 		resolve(toHexString(sharedSecretKeyFromSecretKeyAndPublicKey(contextSeed.data(), contextSeed.size(), secretKeyData.data(), secretKeyData.size(), publicKeyData.data(), publicKeyData.size())));
@@ -1027,7 +1037,7 @@ RCT_EXPORT_METHOD(pedersenCommit:(nonnull NSString *)blind
 		initializeContextSeed();
 		
 		// Get data from blind
-		const vector<uint8_t> blindData = fromHexString(blind);
+		const SecureBytes blindData = fromHexString(blind);
 		
 		// Check if getting data from value failed
 		const char *valueData = [value UTF8String];
@@ -1083,52 +1093,60 @@ RCT_EXPORT_METHOD(pedersenCommitSum:(nonnull NSArray *)positiveCommits
 		const NSUInteger numberOfPositiveCommits = [positiveCommits count];
 	
 		// Initialize positive commits data and positive commits sizes
-		vector<uint8_t> positiveCommitsData;
-		size_t positiveCommitsSizes[numberOfPositiveCommits];
+		SecureBytes positiveCommitsData;
+		vector<size_t> positiveCommitsSizes(numberOfPositiveCommits);
 		
 		// Go through all positive commits
 		size_t i = 0;
 		for(const NSString *commit in positiveCommits) {
 		
-			// Get data from commit
-			const vector<uint8_t> commitData = fromHexString(commit);
-			
-			// Append commit data to positive commits data
-			positiveCommitsData.insert(positiveCommitsData.cend(), commitData.cbegin(), commitData.cend());
+			// Create autorelease pool for the commit's temporary objects
+			@autoreleasepool {
 			
-			// Append commit data's size to positive commits sizes
-			positiveCommitsSizes[i] = commitData.size();
-			
-			// Increment index
-			++i;
+				// Get data from commit
+				const SecureBytes commitData = fromHexString(commit);
+				
+				// Append commit data to positive commits data
+				positiveCommitsData.insert(positiveCommitsData.cend(), commitData.cbegin(), commitData.cend());
+				
+				// Append commit data's size to positive commits sizes
+				positiveCommitsSizes[i] = commitData.size();
+				
+				// Increment index
+				++i;
+			}
 		}
 		
 		// Get number of negative commits
 		const NSUInteger numberOfNegativeCommits = [negativeCommits count];
 	
 		// Initialize negative commits data and negative commits sizes
-		vector<uint8_t> negativeCommitsData;
-		size_t negativeCommitsSizes[numberOfNegativeCommits];
+		SecureBytes negativeCommitsData;
+		vector<size_t> negativeCommitsSizes(numberOfNegativeCommits);
 		
 		// Go through all negative commits
 		i = 0;
 		for(const NSString *commit in negativeCommits) {
 		
-			// Get data from commit
-			const vector<uint8_t> commitData = fromHexString(commit);
-			
-			// Append commit data to negative commits data
-			negativeCommitsData.insert(negativeCommitsData.cend(), commitData.cbegin(), commitData.cend());
+			// Create autorelease pool for the commit's temporary objects
+			@autoreleasepool {
 			
-			// Append commit data's size to negative commits sizes
-			negativeCommitsSizes[i] = commitData.size();
-			
-			// Increment index
-			++i;
+				// Get data from commit
+				const SecureBytes commitData = fromHexString(commit);
+				
+				// Append commit data to negative commits data
+				negativeCommitsData.insert(negativeCommitsData.cend(), commitData.cbegin(), commitData.cend());
+				
+				// Append commit data's size to negative commits sizes
+				negativeCommitsSizes[i] = commitData.size();
+				
+				// Increment index
+				++i;
+			}
 		}
 		
 		// Resolve performing Pedersen commit sum
-		resolve(toHexString(pedersenCommitSum(contextSeed.data(), contextSeed.size(), positiveCommitsData.data(), positiveCommitsSizes, numberOfPositiveCommits, negativeCommitsData.data(), negativeCommitsSizes, numberOfNegativeCommits)));
+		resolve(toHexString(pedersenCommitSum(contextSeed.data(), contextSeed.size(), positiveCommitsData.data(), positiveCommitsSizes.data(), numberOfPositiveCommits, negativeCommitsData.data(), negativeCommitsSizes.data(), numberOfNegativeCommits)));
 	}
 
 	// Catch errors
@@ -1169,7 +1187,7 @@ RCT_EXPORT_METHOD(pedersenCommitToPublicKey:(nonnull NSString *)commit
 		initializeContextSeed();
 		
 		// Get data from commit
-		const vector<uint8_t> commitData = fromHexString(commit);
+		const SecureBytes commitData = fromHexString(commit);
 
 		// Resolve getting public key from Pedersen commit
 		resolve(toHexString(pedersenCommitToPublicKey(contextSeed.data(), contextSeed.size(), commitData.data(), commitData.size())));
@@ -1213,7 +1231,7 @@ RCT_EXPORT_METHOD(publicKeyToPedersenCommit:(nonnull NSString *)publicKey
 		initializeContextSeed();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 
 		// Resolve getting Pedersen commit from public key
 		resolve(toHexString(publicKeyToPedersenCommit(contextSeed.data(), contextSeed.size(), publicKeyData.data(), publicKeyData.size())));
@@ -1262,25 +1280,25 @@ RCT_EXPORT_METHOD(createSingleSignerSignature:(nonnull NSString *)message
 		initializeContextSeed();
 		
 		// Get data from message
-		const vector<uint8_t> messageData = fromHexString(message);
+		const SecureBytes messageData = fromHexString(message);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(secretKey);
+		const SecureBytes secretKeyData = fromHexString(secretKey);
 		
 		// Get data from secret nonce
-		const vector<uint8_t> secretNonceData = secretNonce ? fromHexString(secretNonce) : vector<uint8_t>();
+		const SecureBytes secretNonceData = secretNonce ? fromHexString(secretNonce) : SecureBytes();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 		
 		// Get data from public nonce
-		const vector<uint8_t> publicNonceData = publicNonce ? fromHexString(publicNonce) : vector<uint8_t>();
+		const SecureBytes publicNonceData = publicNonce ? fromHexString(publicNonce) : SecureBytes();
 		
 		// Get data from public nonce total
-		const vector<uint8_t> publicNonceTotalData = publicNonceTotal ? fromHexString(publicNonceTotal) : vector<uint8_t>();
+		const SecureBytes publicNonceTotalData = publicNonceTotal ? fromHexString(publicNonceTotal) : SecureBytes();
 		
 		// Check if creating random seed failed
-		vector<uint8_t> seed(seedSize());
+		SecureBytes seed(seedSize());
 		if(SecRandomCopyBytes(kSecRandomDefault, seed.size(), seed.data()) != errSecSuccess) {
 		
 			// Throw error
@@ -1333,31 +1351,35 @@ RCT_EXPORT_METHOD(addSingleSignerSignatures:(nonnull NSArray *)signatures
 		const NSUInteger numberOfSignatures = [signatures count];
 	
 		// Initialize signatures data and signatures sizes
-		vector<uint8_t> signaturesData;
-		size_t signaturesSizes[numberOfSignatures];
+		SecureBytes signaturesData;
+		vector<size_t> signaturesSizes(numberOfSignatures);
 		
 		// Go through all signatures
 		size_t i = 0;
 		for(const NSString *signature in signatures) {
 		
-			// Get data from signature
-			const vector<uint8_t> signatureData = fromHexString(signature);
-			
-			// Append signature data to signatures data
-			signaturesData.insert(signaturesData.cend(), signatureData.cbegin(), signatureData.cend());
+			// Create autorelease pool for the signature's temporary objects
+			@autoreleasepool {
 			
-			// Append signature data's size to signatures sizes
-			signaturesSizes[i] = signatureData.size();
-			
-			// Increment index
-			++i;
+				// Get data from signature
+				const SecureBytes signatureData = fromHexString(signature);
+				
+				// Append signature data to signatures data
+				signaturesData.insert(signaturesData.cend(), signatureData.cbegin(), signatureData.cend());
+				
+				// Append signature data's size to signatures sizes
+				signaturesSizes[i] = signatureData.size();
+				
+				// Increment index
+				++i;
+			}
 		}
 		
 		// Get data from public nonce total
-		const vector<uint8_t> publicNonceTotalData = fromHexString(publicNonceTotal);
+		const SecureBytes publicNonceTotalData = fromHexString(publicNonceTotal);
 		
 		// Resolve adding single-signer signatures
-		resolve(toHexString(addSingleSignerSignatures(contextSeed.data(), contextSeed.size(), signaturesData.data(), signaturesSizes, numberOfSignatures, publicNonceTotalData.data(), publicNonceTotalData.size())));
+		resolve(toHexString(addSingleSignerSignatures(contextSeed.data(), contextSeed.size(), signaturesData.data(), signaturesSizes.data(), numberOfSignatures, publicNonceTotalData.data(), publicNonceTotalData.size())));
 	}
 
 	// Catch errors
@@ -1403,19 +1425,19 @@ RCT_EXPORT_METHOD(verifySingleSignerSignature:(nonnull NSString *)signature
 		initializeContextSeed();
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(signature);
+		const SecureBytes signatureData = fromHexString(signature);
 		
 		// Get data from message
-		const vector<uint8_t> messageData = fromHexString(message);
+		const SecureBytes messageData = fromHexString(message);
 		
 		// Get data from public nonce
-		const vector<uint8_t> publicNonceData = publicNonce ? fromHexString(publicNonce) : vector<uint8_t>();
+		const SecureBytes publicNonceData = publicNonce ? fromHexString(publicNonce) : SecureBytes();
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 		
 		// Get data from public key total
-		const vector<uint8_t> publicKeyTotalData = fromHexString(publicKeyTotal);
+		const SecureBytes publicKeyTotalData = fromHexString(publicKeyTotal);
 
 		// Return if single-signer signature is verified
 		resolve(toBool(verifySingleSignerSignature(contextSeed.data(), contextSeed.size(), signatureData.data(), signatureData.size(), messageData.data(), messageData.size(), publicNonce ? publicNonceData.data() : nullptr, publicNonceData.size(), publicKeyData.data(), publicKeyData.size(), publicKeyTotalData.data(), publicKeyTotalData.size(), fromBool(isPartial))));
@@ -1459,7 +1481,7 @@ RCT_EXPORT_METHOD(singleSignerSignatureFromData:(nonnull NSString *)data
 		initializeContextSeed();
 		
 		// Get data from data
-		const vector<uint8_t> dataData = fromHexString(data);
+		const SecureBytes dataData = fromHexString(data);
 
 		// Resolve getting single-signer signature from data
 		resolve(toHexString(singleSignerSignatureFromData(contextSeed.data(), contextSeed.size(), dataData.data(), dataData.size())));
@@ -1503,7 +1525,7 @@ RCT_EXPORT_METHOD(compactSingleSignerSignature:(nonnull NSString *)signature
 		initializeContextSeed();
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(signature);
+		const SecureBytes signatureData = fromHexString(signature);
 
 		// Resolve compacting single-signer signature
 		resolve(toHexString(compactSingleSignerSignature(contextSeed.data(), contextSeed.size(), signatureData.data(), signatureData.size())));
@@ -1547,7 +1569,7 @@ RCT_EXPORT_METHOD(uncompactSingleSignerSignature:(nonnull NSString *)signature
 		initializeContextSeed();
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(signature);
+		const SecureBytes signatureData = fromHexString(signature);
 
 		// Resolve uncompacting single-signer signature
 		resolve(toHexString(uncompactSingleSignerSignature(contextSeed.data(), contextSeed.size(), signatureData.data(), signatureData.size())));
@@ -1594,28 +1616,32 @@ RCT_EXPORT_METHOD(combinePublicKeys:(nonnull NSArray *)publicKeys
 		const NSUInteger numberOfPublicKeys = [publicKeys count];
 	
 		// Initialize public keys data and public keys sizes
-		vector<uint8_t> publicKeysData;
-		size_t publicKeysSizes[numberOfPublicKeys];
+		SecureBytes publicKeysData;
+		vector<size_t> publicKeysSizes(numberOfPublicKeys);
 		
 		// Go through all public keys
 		size_t i = 0;
 		for(const NSString *publicKey in publicKeys) {
 		
-			// Get data from public key
-			const vector<uint8_t> publicKeyData = fromHexString(publicKey);
-			
-			// Append public key data to public keys data
-			publicKeysData.insert(publicKeysData.cend(), publicKeyData.cbegin(), publicKeyData.cend());
+			// Create autorelease pool for the public key's temporary objects
+			@autoreleasepool {
 			
-			// Append public key data's size to public keys sizes
-			publicKeysSizes[i] = publicKeyData.size();
-			
-			// Increment index
-			++i;
+				// Get data from public key
+				const SecureBytes publicKeyData = fromHexString(publicKey);
+				
+				// Append public key data to public keys data
+				publicKeysData.insert(publicKeysData.cend(), publicKeyData.cbegin(), publicKeyData.cend());
+				
+				// Append public key data's size to public keys sizes
+				publicKeysSizes[i] = publicKeyData.size();
+				
+				// Increment index
+				++i;
+			}
 		}
 		
 		// Resolve combining public keys
-		resolve(toHexString(combinePublicKeys(contextSeed.data(), contextSeed.size(), publicKeysData.data(), publicKeysSizes, numberOfPublicKeys)));
+		resolve(toHexString(combinePublicKeys(contextSeed.data(), contextSeed.size(), publicKeysData.data(), publicKeysSizes.data(), numberOfPublicKeys)));
 	}
 
 	// Catch errors
@@ -1655,7 +1681,7 @@ RCT_EXPORT_METHOD(createSecretNonce:(RCTPromiseResolveBlock)resolve
 		initializeContextSeed();
 		
 		// Check if creating random seed failed
-		vector<uint8_t> seed(seedSize());
+		SecureBytes seed(seedSize());
 		if(SecRandomCopyBytes(kSecRandomDefault, seed.size(), seed.data()) != errSecSuccess) {
 		
 			// Throw error
@@ -1705,10 +1731,10 @@ RCT_EXPORT_METHOD(createMessageHashSignature:(nonnull NSString *)messageHash
 		initializeContextSeed();
 		
 		// Get data from message hash
-		const vector<uint8_t> messageHashData = fromHexString(messageHash);
+		const SecureBytes messageHashData = fromHexString(messageHash);
 		
 		// Get data from secret key
-		const vector<uint8_t> secretKeyData = fromHexString(secretKey);
+		const SecureBytes secretKeyData = fromHexString(secretKey);
 
 		// Resolve creating message hash signature
 		resolve(toHexString(createMessageHashSignature(contextSeed.data(), contextSeed.size(), messageHashData.data(), messageHashData.size(), secretKeyData.data(), secretKeyData.size())));
@@ -1754,13 +1780,13 @@ RCT_EXPORT_METHOD(verifyMessageHashSignature:(nonnull NSString *)signature
 		initializeContextSeed();
 		
 		// Get data from signature
-		const vector<uint8_t> signatureData = fromHexString(signature);
+		const SecureBytes signatureData = fromHexString(signature);
 		
 		// Get data from message hash
-		const vector<uint8_t> messageHashData = fromHexString(messageHash);
+		const SecureBytes messageHashData = fromHexString(messageHash);
 		
 		// Get data from public key
-		const vector<uint8_t> publicKeyData = fromHexString(publicKey);
+		const SecureBytes publicKeyData = fromHexString(publicKey);
 
 		// Resolve if message hash signature is verified
 		resolve(toBool(verifyMessageHashSignature(contextSeed.data(), contextSeed.size(), signatureData.data(), signatureData.size(), messageHashData.data(), messageHashData.size(), publicKeyData.data(), publicKeyData.size())));
@@ -1791,64 +1817,2759 @@ RCT_EXPORT_METHOD(verifyMessageHashSignature:(nonnull NSString *)signature
 	}
 }
 
-@end
+// Create bulletproof session
+RCT_EXPORT_METHOD(createBulletproofSession:(NSString *)blind
+	withValue:(nonnull NSString *)value
+	withCommit:(nonnull NSString *)commit
+	withNonce:(nonnull NSString *)nonce
+	withPrivateNonce:(NSString *)privateNonce
+	withExtraCommit:(nonnull NSString *)extraCommit
+	withMessage:(nonnull NSString *)message
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from blind
+		const SecureBytes blindData = blind ? fromHexString(blind) : SecureBytes();
+		
+		// Check if getting data from value failed
+		const char *valueData = [value UTF8String];
+		if(!valueData) {
 
+			// Throw error
+			throw runtime_error("Getting data from value failed");
+		}
+		
+		// Get data from commit
+		const SecureBytes commitData = fromHexString(commit);
+		
+		// Get data from nonce
+		const SecureBytes nonceData = fromHexString(nonce);
+		
+		// Get data from private nonce
+		const SecureBytes privateNonceData = privateNonce ? fromHexString(privateNonce) : SecureBytes();
+		
+		// Get data from extra commit
+		const SecureBytes extraCommitData = fromHexString(extraCommit);
+		
+		// Get data from message
+		const SecureBytes messageData = fromHexString(message);
+		
+		// Resolve creating bulletproof session
+		resolve([NSNumber numberWithUnsignedLongLong:createBulletproofSession(contextSeed.data(), contextSeed.size(), blind ? blindData.data() : nullptr, blindData.size(), valueData, commitData.data(), commitData.size(), nonceData.data(), nonceData.size(), privateNonceData.data(), privateNonceData.size(), extraCommitData.data(), extraCommitData.size(), messageData.data(), messageData.size())]);
+	}
 
-// Supporting function implementation
+	// Catch errors
+	catch(const exception &error) {
 
-// From hex string
-vector<uint8_t> fromHexString(const NSString *hexString) {
+		// Initialize message
+		NSString *message;
 
-	// Check if getting input from hex string failed
-	const char *input = [hexString UTF8String];
-	if(!input) {
+		// Try
+		try {
 
-		// Throw error
-		throw runtime_error("Getting input from hex string failed");
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
 	}
+}
 
-	// Get input length
-	const size_t inputLength = strlen(input);
+// Bulletproof session round one
+RCT_EXPORT_METHOD(bulletproofSessionRoundOne:(nonnull NSNumber *)session
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
 
-	// Check if input length is invalid
-	if(inputLength % HEX_CHARACTER_LENGTH) {
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Perform round one with the bulletproof session
+		const tuple<vector<uint8_t>, vector<uint8_t>> roundOneData = bulletproofSessionRoundOne(contextSeed.data(), contextSeed.size(), [session unsignedLongLongValue]);
+		
+		// Check if creating result failed
+		const NSDictionary *result = [NSDictionary dictionaryWithObjectsAndKeys:toHexString(get<0>(roundOneData)), @"TOne", toHexString(get<1>(roundOneData)), @"TTwo", nil];
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Resolve result
+		resolve(result);
+	}
 
-		// Throw error
-		throw runtime_error("Input length is invalid");
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
 	}
+}
 
-	// Initialize result
-	vector<uint8_t> result(inputLength / HEX_CHARACTER_LENGTH);
+// Bulletproof session round two
+RCT_EXPORT_METHOD(bulletproofSessionRoundTwo:(nonnull NSNumber *)session
+	withTOne:(nonnull NSString *)tOne
+	withTTwo:(nonnull NSString *)tTwo
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
 
-	// Go through all character pairs in the input
-	for(size_t i = 0; i < inputLength; i += HEX_CHARACTER_LENGTH) {
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from t one
+		const SecureBytes tOneData = fromHexString(tOne);
+		
+		// Get data from t two
+		const SecureBytes tTwoData = fromHexString(tTwo);
+		
+		// Resolve performing round two with the bulletproof session
+		resolve(toHexString(bulletproofSessionRoundTwo(contextSeed.data(), contextSeed.size(), [session unsignedLongLongValue], tOneData.data(), tOneData.size(), tTwoData.data(), tTwoData.size())));
+	}
 
-		// Set value in result
-		result[i / HEX_CHARACTER_LENGTH] = (characterToNumber(input[i]) << BITS_IN_A_BYTE / 2) | characterToNumber(input[i + 1]);
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
 	}
+}
 
-	// Return result
-	return result;
+// Bulletproof session finalize
+RCT_EXPORT_METHOD(bulletproofSessionFinalize:(nonnull NSNumber *)session
+	withTauX:(nonnull NSString *)tauX
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from tau X
+		const SecureBytes tauXData = fromHexString(tauX);
+		
+		// Resolve finalizing the bulletproof session
+		resolve(toHexString(bulletproofSessionFinalize(contextSeed.data(), contextSeed.size(), [session unsignedLongLongValue], tauXData.data(), tauXData.size())));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
 }
 
-// To hex string
-const NSString *toHexString(const vector<uint8_t> &input) {
+// Destroy bulletproof session
+RCT_EXPORT_METHOD(destroyBulletproofSession:(nonnull NSNumber *)session
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
 
-	// Initialize result
-	ostringstream result;
+	// Try
+	try {
+	
+		// Destroy bulletproof session
+		destroyBulletproofSession([session unsignedLongLongValue]);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Create aggsig session
+RCT_EXPORT_METHOD(createAggsigSession:(nonnull NSString *)message
+	withPublicKeyTotal:(nonnull NSString *)publicKeyTotal
+	withPublicNonceTotal:(nonnull NSString *)publicNonceTotal
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from message
+		const SecureBytes messageData = fromHexString(message);
+		
+		// Get data from public key total
+		const SecureBytes publicKeyTotalData = fromHexString(publicKeyTotal);
+		
+		// Get data from public nonce total
+		const SecureBytes publicNonceTotalData = fromHexString(publicNonceTotal);
+		
+		// Resolve creating aggsig session
+		resolve([NSNumber numberWithUnsignedLongLong:createAggsigSession(contextSeed.data(), contextSeed.size(), messageData.data(), messageData.size(), publicKeyTotalData.data(), publicKeyTotalData.size(), publicNonceTotalData.data(), publicNonceTotalData.size())]);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Aggsig session partial sign
+RCT_EXPORT_METHOD(aggsigSessionPartialSign:(nonnull NSNumber *)session
+	withSecretKey:(nonnull NSString *)secretKey
+	withSecretNonce:(nonnull NSString *)secretNonce
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from secret key
+		const SecureBytes secretKeyData = fromHexString(secretKey);
+		
+		// Get data from secret nonce
+		const SecureBytes secretNonceData = fromHexString(secretNonce);
+		
+		// Resolve creating partial signature with the aggsig session
+		resolve(toHexString(aggsigSessionPartialSign(contextSeed.data(), contextSeed.size(), [session unsignedLongLongValue], secretKeyData.data(), secretKeyData.size(), secretNonceData.data(), secretNonceData.size())));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Aggsig session partial verify
+RCT_EXPORT_METHOD(aggsigSessionPartialVerify:(nonnull NSNumber *)session
+	withSignature:(nonnull NSString *)signature
+	withPublicKey:(nonnull NSString *)publicKey
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from signature
+		const SecureBytes signatureData = fromHexString(signature);
+		
+		// Get data from public key
+		const SecureBytes publicKeyData = fromHexString(publicKey);
+		
+		// Resolve if partial signature is verified with the aggsig session
+		resolve(toBool(aggsigSessionPartialVerify(contextSeed.data(), contextSeed.size(), [session unsignedLongLongValue], signatureData.data(), signatureData.size(), publicKeyData.data(), publicKeyData.size())));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Aggsig session aggregate
+RCT_EXPORT_METHOD(aggsigSessionAggregate:(nonnull NSNumber *)session
+	withSignatures:(nonnull NSArray *)signatures
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of signatures
+		const NSUInteger numberOfSignatures = [signatures count];
+	
+		// Initialize signatures data and signatures sizes
+		SecureBytes signaturesData;
+		vector<size_t> signaturesSizes(numberOfSignatures);
+		
+		// Go through all signatures
+		size_t i = 0;
+		for(const NSString *signature in signatures) {
+		
+			// Create autorelease pool for the signature's temporary objects
+			@autoreleasepool {
+			
+				// Get data from signature
+				const SecureBytes signatureData = fromHexString(signature);
+				
+				// Append signature data to signatures data
+				signaturesData.insert(signaturesData.cend(), signatureData.cbegin(), signatureData.cend());
+				
+				// Append signature data's size to signatures sizes
+				signaturesSizes[i] = signatureData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Resolve aggregating signatures with the aggsig session
+		resolve(toHexString(aggsigSessionAggregate(contextSeed.data(), contextSeed.size(), [session unsignedLongLongValue], signaturesData.data(), signaturesSizes.data(), numberOfSignatures)));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Aggsig session verify
+RCT_EXPORT_METHOD(aggsigSessionVerify:(nonnull NSNumber *)session
+	withSignature:(nonnull NSString *)signature
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from signature
+		const SecureBytes signatureData = fromHexString(signature);
+		
+		// Resolve if signature is verified with the aggsig session
+		resolve(toBool(aggsigSessionVerify(contextSeed.data(), contextSeed.size(), [session unsignedLongLongValue], signatureData.data(), signatureData.size())));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Destroy aggsig session
+RCT_EXPORT_METHOD(destroyAggsigSession:(nonnull NSNumber *)session
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Destroy aggsig session
+		destroyAggsigSession([session unsignedLongLongValue]);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Create nonce pair
+RCT_EXPORT_METHOD(createNoncePair:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get nonce pair
+		tuple<SecureBytes, vector<uint8_t>> noncePair = createNoncePair(contextSeed.data(), contextSeed.size());
+		
+		// Get nonce pair as hex strings
+		const NSString *secretNonce = toHexString(get<0>(noncePair));
+		const NSString *publicNonce = toHexString(get<1>(noncePair));
+		
+		// Clear secret nonce
+		fill(get<0>(noncePair).begin(), get<0>(noncePair).end(), 0);
+		
+		// Check if creating result failed
+		const NSDictionary *result = [NSDictionary dictionaryWithObjectsAndKeys:secretNonce, @"SecretNonce", publicNonce, @"PublicNonce", nil];
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Resolve result
+		resolve(result);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Derive child secret keys
+RCT_EXPORT_METHOD(deriveChildSecretKeys:(nonnull NSString *)secretKey
+	withChainCode:(nonnull NSString *)chainCode
+	withStartIndex:(nonnull NSNumber *)startIndex
+	withNumberOfIndices:(nonnull NSNumber *)numberOfIndices
+	withIsHardened:(nonnull NSNumber *)isHardened
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from secret key
+		const SecureBytes secretKeyData = fromHexString(secretKey);
+		
+		// Get data from chain code
+		const SecureBytes chainCodeData = fromHexString(chainCode);
+		
+		// Check if indices are invalid
+		if([startIndex unsignedLongLongValue] > UINT32_MAX || [numberOfIndices unsignedLongLongValue] > UINT32_MAX) {
+		
+			// Throw error
+			throw runtime_error("Indices are invalid");
+		}
+		
+		// Resolve deriving child secret keys
+		resolve(toHexString(deriveChildSecretKeys(contextSeed.data(), contextSeed.size(), secretKeyData.data(), secretKeyData.size(), chainCodeData.data(), chainCodeData.size(), [startIndex unsignedLongLongValue], [numberOfIndices unsignedLongLongValue], fromBool(isHardened))));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Derive child public keys
+RCT_EXPORT_METHOD(deriveChildPublicKeys:(nonnull NSString *)publicKey
+	withChainCode:(nonnull NSString *)chainCode
+	withStartIndex:(nonnull NSNumber *)startIndex
+	withNumberOfIndices:(nonnull NSNumber *)numberOfIndices
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from public key
+		const SecureBytes publicKeyData = fromHexString(publicKey);
+		
+		// Get data from chain code
+		const SecureBytes chainCodeData = fromHexString(chainCode);
+		
+		// Check if indices are invalid
+		if([startIndex unsignedLongLongValue] > UINT32_MAX || [numberOfIndices unsignedLongLongValue] > UINT32_MAX) {
+		
+			// Throw error
+			throw runtime_error("Indices are invalid");
+		}
+		
+		// Resolve deriving child public keys
+		resolve(toHexString(deriveChildPublicKeys(contextSeed.data(), contextSeed.size(), publicKeyData.data(), publicKeyData.size(), chainCodeData.data(), chainCodeData.size(), [startIndex unsignedLongLongValue], [numberOfIndices unsignedLongLongValue])));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Public keys from secret keys
+RCT_EXPORT_METHOD(publicKeysFromSecretKeys:(nonnull NSArray *)secretKeys
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of secret keys
+		const NSUInteger numberOfSecretKeys = [secretKeys count];
+	
+		// Initialize secret keys data and secret keys sizes
+		SecureBytes secretKeysData;
+		vector<size_t> secretKeysSizes(numberOfSecretKeys);
+		
+		// Go through all secret keys
+		size_t i = 0;
+		for(const NSString *secretKey in secretKeys) {
+		
+			// Create autorelease pool for the secret key's temporary objects
+			@autoreleasepool {
+			
+				// Get data from secret key
+				const SecureBytes secretKeyData = fromHexString(secretKey);
+				
+				// Append secret key data to secret keys data
+				secretKeysData.insert(secretKeysData.cend(), secretKeyData.cbegin(), secretKeyData.cend());
+				
+				// Append secret key data's size to secret keys sizes
+				secretKeysSizes[i] = secretKeyData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Resolve getting public keys from secret keys
+		resolve(toHexString(publicKeysFromSecretKeys(contextSeed.data(), contextSeed.size(), secretKeysData.data(), secretKeysSizes.data(), numberOfSecretKeys)));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Pedersen commits
+RCT_EXPORT_METHOD(pedersenCommits:(nonnull NSArray *)blinds
+	withValues:(nonnull NSArray *)values
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of blinds
+		const NSUInteger numberOfBlinds = [blinds count];
+	
+		// Initialize blinds data and blinds sizes
+		SecureBytes blindsData;
+		vector<size_t> blindsSizes(numberOfBlinds);
+		
+		// Go through all blinds
+		size_t i = 0;
+		for(const NSString *blind in blinds) {
+		
+			// Create autorelease pool for the blind's temporary objects
+			@autoreleasepool {
+			
+				// Get data from blind
+				const SecureBytes blindData = fromHexString(blind);
+				
+				// Append blind data to blinds data
+				blindsData.insert(blindsData.cend(), blindData.cbegin(), blindData.cend());
+				
+				// Append blind data's size to blinds sizes
+				blindsSizes[i] = blindData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of values
+		const NSUInteger numberOfValues = [values count];
+		
+		// Initialize values data
+		vector<string> valuesData;
+		vector<const char *> valuesPointers;
+		valuesData.reserve(numberOfValues);
+		
+		// Go through all values
+		for(const NSString *value in values) {
+		
+			// Create autorelease pool for the value's temporary objects
+			@autoreleasepool {
+			
+				// Check if getting data from value failed
+				const char *valueData = [value UTF8String];
+				if(!valueData) {
+				
+					// Throw error
+					throw runtime_error("Getting data from value failed");
+				}
+				
+				// Append value data to values data
+				valuesData.emplace_back(valueData);
+				valuesPointers.push_back(valuesData.back().c_str());
+			}
+		}
+		
+		// Check if the number of blinds and values differ
+		if(numberOfBlinds != numberOfValues) {
+		
+			// Throw error
+			throw runtime_error("Number of blinds and values differ");
+		}
+		
+		// Resolve performing Pedersen commits
+		resolve(toHexString(pedersenCommits(contextSeed.data(), contextSeed.size(), blindsData.data(), blindsSizes.data(), valuesPointers.data(), numberOfBlinds)));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Blind switches
+RCT_EXPORT_METHOD(blindSwitches:(nonnull NSArray *)blinds
+	withValues:(nonnull NSArray *)values
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of blinds
+		const NSUInteger numberOfBlinds = [blinds count];
+	
+		// Initialize blinds data and blinds sizes
+		SecureBytes blindsData;
+		vector<size_t> blindsSizes(numberOfBlinds);
+		
+		// Go through all blinds
+		size_t i = 0;
+		for(const NSString *blind in blinds) {
+		
+			// Create autorelease pool for the blind's temporary objects
+			@autoreleasepool {
+			
+				// Get data from blind
+				const SecureBytes blindData = fromHexString(blind);
+				
+				// Append blind data to blinds data
+				blindsData.insert(blindsData.cend(), blindData.cbegin(), blindData.cend());
+				
+				// Append blind data's size to blinds sizes
+				blindsSizes[i] = blindData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of values
+		const NSUInteger numberOfValues = [values count];
+		
+		// Initialize values data
+		vector<string> valuesData;
+		vector<const char *> valuesPointers;
+		valuesData.reserve(numberOfValues);
+		
+		// Go through all values
+		for(const NSString *value in values) {
+		
+			// Create autorelease pool for the value's temporary objects
+			@autoreleasepool {
+			
+				// Check if getting data from value failed
+				const char *valueData = [value UTF8String];
+				if(!valueData) {
+				
+					// Throw error
+					throw runtime_error("Getting data from value failed");
+				}
+				
+				// Append value data to values data
+				valuesData.emplace_back(valueData);
+				valuesPointers.push_back(valuesData.back().c_str());
+			}
+		}
+		
+		// Check if the number of blinds and values differ
+		if(numberOfBlinds != numberOfValues) {
+		
+			// Throw error
+			throw runtime_error("Number of blinds and values differ");
+		}
+		
+		// Resolve performing blind switches
+		resolve(toHexString(blindSwitches(contextSeed.data(), contextSeed.size(), blindsData.data(), blindsSizes.data(), valuesPointers.data(), numberOfBlinds)));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Shared secret keys from secret key and public keys
+RCT_EXPORT_METHOD(sharedSecretKeysFromSecretKeyAndPublicKeys:(nonnull NSString *)secretKey
+	withPublicKeys:(nonnull NSArray *)publicKeys
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from secret key
+		const SecureBytes secretKeyData = fromHexString(secretKey);
+		
+		// Get number of public keys
+		const NSUInteger numberOfPublicKeys = [publicKeys count];
+	
+		// Initialize public keys data and public keys sizes
+		SecureBytes publicKeysData;
+		vector<size_t> publicKeysSizes(numberOfPublicKeys);
+		
+		// Go through all public keys
+		size_t i = 0;
+		for(const NSString *publicKey in publicKeys) {
+		
+			// Create autorelease pool for the public key's temporary objects
+			@autoreleasepool {
+			
+				// Get data from public key
+				const SecureBytes publicKeyData = fromHexString(publicKey);
+				
+				// Append public key data to public keys data
+				publicKeysData.insert(publicKeysData.cend(), publicKeyData.cbegin(), publicKeyData.cend());
+				
+				// Append public key data's size to public keys sizes
+				publicKeysSizes[i] = publicKeyData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Resolve getting shared secret keys from secret key and public keys
+		resolve(toHexString(sharedSecretKeysFromSecretKeyAndPublicKeys(contextSeed.data(), contextSeed.size(), secretKeyData.data(), secretKeyData.size(), publicKeysData.data(), publicKeysSizes.data(), numberOfPublicKeys)));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Create commit accumulator
+RCT_EXPORT_METHOD(createCommitAccumulator:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Resolve creating commit accumulator
+		resolve([NSNumber numberWithUnsignedLongLong:createCommitAccumulator(contextSeed.data(), contextSeed.size())]);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Commit accumulator add
+RCT_EXPORT_METHOD(commitAccumulatorAdd:(nonnull NSNumber *)accumulator
+	withCommits:(nonnull NSArray *)commits
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of commits
+		const NSUInteger numberOfCommits = [commits count];
+	
+		// Initialize commits data and commits sizes
+		SecureBytes commitsData;
+		vector<size_t> commitsSizes(numberOfCommits);
+		
+		// Go through all commits
+		size_t i = 0;
+		for(const NSString *commit in commits) {
+		
+			// Create autorelease pool for the commit's temporary objects
+			@autoreleasepool {
+			
+				// Get data from commit
+				const SecureBytes commitData = fromHexString(commit);
+				
+				// Append commit data to commits data
+				commitsData.insert(commitsData.cend(), commitData.cbegin(), commitData.cend());
+				
+				// Append commit data's size to commits sizes
+				commitsSizes[i] = commitData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Add commits to the commit accumulator
+		commitAccumulatorAdd(contextSeed.data(), contextSeed.size(), [accumulator unsignedLongLongValue], commitsData.data(), commitsSizes.data(), numberOfCommits);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Commit accumulator subtract
+RCT_EXPORT_METHOD(commitAccumulatorSubtract:(nonnull NSNumber *)accumulator
+	withCommits:(nonnull NSArray *)commits
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of commits
+		const NSUInteger numberOfCommits = [commits count];
+	
+		// Initialize commits data and commits sizes
+		SecureBytes commitsData;
+		vector<size_t> commitsSizes(numberOfCommits);
+		
+		// Go through all commits
+		size_t i = 0;
+		for(const NSString *commit in commits) {
+		
+			// Create autorelease pool for the commit's temporary objects
+			@autoreleasepool {
+			
+				// Get data from commit
+				const SecureBytes commitData = fromHexString(commit);
+				
+				// Append commit data to commits data
+				commitsData.insert(commitsData.cend(), commitData.cbegin(), commitData.cend());
+				
+				// Append commit data's size to commits sizes
+				commitsSizes[i] = commitData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Subtract commits from the commit accumulator
+		commitAccumulatorSubtract(contextSeed.data(), contextSeed.size(), [accumulator unsignedLongLongValue], commitsData.data(), commitsSizes.data(), numberOfCommits);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Commit accumulator checkpoint
+RCT_EXPORT_METHOD(commitAccumulatorCheckpoint:(nonnull NSNumber *)accumulator
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Resolve creating commit accumulator checkpoint
+		resolve([NSNumber numberWithUnsignedLongLong:commitAccumulatorCheckpoint(contextSeed.data(), contextSeed.size(), [accumulator unsignedLongLongValue])]);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Commit accumulator restore
+RCT_EXPORT_METHOD(commitAccumulatorRestore:(nonnull NSNumber *)accumulator
+	withCheckpoint:(nonnull NSNumber *)checkpoint
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Restore commit accumulator
+		commitAccumulatorRestore(contextSeed.data(), contextSeed.size(), [accumulator unsignedLongLongValue], [checkpoint unsignedLongLongValue]);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Commit accumulator total
+RCT_EXPORT_METHOD(commitAccumulatorTotal:(nonnull NSNumber *)accumulator
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Resolve getting commit accumulator total
+		resolve(toHexString(commitAccumulatorTotal(contextSeed.data(), contextSeed.size(), [accumulator unsignedLongLongValue])));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Destroy commit accumulator
+RCT_EXPORT_METHOD(destroyCommitAccumulator:(nonnull NSNumber *)accumulator
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Destroy commit accumulator
+		destroyCommitAccumulator([accumulator unsignedLongLongValue]);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Multi scalar multiply
+RCT_EXPORT_METHOD(multiScalarMultiply:(nonnull NSArray *)points
+	withScalars:(nonnull NSArray *)scalars
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of points
+		const NSUInteger numberOfPoints = [points count];
+	
+		// Initialize points data and points sizes
+		SecureBytes pointsData;
+		vector<size_t> pointsSizes(numberOfPoints);
+		
+		// Go through all points
+		size_t i = 0;
+		for(const NSString *point in points) {
+		
+			// Create autorelease pool for the point's temporary objects
+			@autoreleasepool {
+			
+				// Get data from point
+				const SecureBytes pointData = fromHexString(point);
+				
+				// Append point data to points data
+				pointsData.insert(pointsData.cend(), pointData.cbegin(), pointData.cend());
+				
+				// Append point data's size to points sizes
+				pointsSizes[i] = pointData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of scalars
+		const NSUInteger numberOfScalars = [scalars count];
+	
+		// Initialize scalars data and scalars sizes
+		SecureBytes scalarsData;
+		vector<size_t> scalarsSizes(numberOfScalars);
+		
+		// Go through all scalars
+		i = 0;
+		for(const NSString *scalar in scalars) {
+		
+			// Create autorelease pool for the scalar's temporary objects
+			@autoreleasepool {
+			
+				// Get data from scalar
+				const SecureBytes scalarData = fromHexString(scalar);
+				
+				// Append scalar data to scalars data
+				scalarsData.insert(scalarsData.cend(), scalarData.cbegin(), scalarData.cend());
+				
+				// Append scalar data's size to scalars sizes
+				scalarsSizes[i] = scalarData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Check if the number of points and scalars differ
+		if(numberOfPoints != numberOfScalars) {
+		
+			// Throw error
+			throw runtime_error("Number of points and scalars differ");
+		}
+		
+		// Resolve performing multi scalar multiply
+		resolve(toHexString(multiScalarMultiply(contextSeed.data(), contextSeed.size(), pointsData.data(), pointsSizes.data(), scalarsData.data(), scalarsSizes.data(), numberOfPoints)));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Scalar batch inverse
+RCT_EXPORT_METHOD(scalarBatchInverse:(nonnull NSArray *)scalars
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of scalars
+		const NSUInteger numberOfScalars = [scalars count];
+	
+		// Initialize scalars data and scalars sizes
+		SecureBytes scalarsData;
+		vector<size_t> scalarsSizes(numberOfScalars);
+		
+		// Go through all scalars
+		size_t i = 0;
+		for(const NSString *scalar in scalars) {
+		
+			// Create autorelease pool for the scalar's temporary objects
+			@autoreleasepool {
+			
+				// Get data from scalar
+				const SecureBytes scalarData = fromHexString(scalar);
+				
+				// Append scalar data to scalars data
+				scalarsData.insert(scalarsData.cend(), scalarData.cbegin(), scalarData.cend());
+				
+				// Append scalar data's size to scalars sizes
+				scalarsSizes[i] = scalarData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Resolve performing scalar batch inverse
+		resolve(toHexString(scalarBatchInverse(contextSeed.data(), contextSeed.size(), scalarsData.data(), scalarsSizes.data(), numberOfScalars)));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Evaluate scalar program
+RCT_EXPORT_METHOD(evaluateScalarProgram:(nonnull NSArray *)scalars
+	withProgram:(nonnull NSString *)program
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of scalars
+		const NSUInteger numberOfScalars = [scalars count];
+	
+		// Initialize scalars data and scalars sizes
+		SecureBytes scalarsData;
+		vector<size_t> scalarsSizes(numberOfScalars);
+		
+		// Go through all scalars
+		size_t i = 0;
+		for(const NSString *scalar in scalars) {
+		
+			// Create autorelease pool for the scalar's temporary objects
+			@autoreleasepool {
+			
+				// Get data from scalar
+				const SecureBytes scalarData = fromHexString(scalar);
+				
+				// Append scalar data to scalars data
+				scalarsData.insert(scalarsData.cend(), scalarData.cbegin(), scalarData.cend());
+				
+				// Append scalar data's size to scalars sizes
+				scalarsSizes[i] = scalarData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get data from program
+		const SecureBytes programData = fromHexString(program);
+		
+		// Resolve evaluating scalar program
+		resolve(toHexString(evaluateScalarProgram(contextSeed.data(), contextSeed.size(), scalarsData.data(), scalarsSizes.data(), numberOfScalars, programData.data(), programData.size())));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Execute commands
+RCT_EXPORT_METHOD(executeCommands:(nonnull NSString *)commands
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from commands
+		const SecureBytes commandsData = fromHexString(commands);
+		
+		// Resolve executing commands
+		resolve(toHexString(executeCommands(contextSeed.data(), contextSeed.size(), commandsData.data(), commandsData.size())));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Set verification cache capacity
+RCT_EXPORT_METHOD(setVerificationCacheCapacity:(nonnull NSNumber *)capacity
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Set verification cache capacity
+		setVerificationCacheCapacity([capacity unsignedLongValue]);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Get verification cache statistics
+RCT_EXPORT_METHOD(getVerificationCacheStatistics:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Get verification cache statistics
+		const tuple<uint64_t, uint64_t, uint64_t> statistics = getVerificationCacheStatistics();
+		
+		// Check if creating result failed
+		const NSDictionary *result = [NSDictionary dictionaryWithObjectsAndKeys:[NSNumber numberWithUnsignedLongLong:get<0>(statistics)], @"Hits", [NSNumber numberWithUnsignedLongLong:get<1>(statistics)], @"Misses", [NSNumber numberWithUnsignedLongLong:get<2>(statistics)], @"Entries", nil];
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Resolve result
+		resolve(result);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Set thread count
+RCT_EXPORT_METHOD(setThreadCount:(nonnull NSNumber *)count
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Set thread count
+		setThreadCount([count unsignedLongValue]);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Open rewind cache
+RCT_EXPORT_METHOD(openRewindCache:(nonnull NSString *)path
+	withKey:(nonnull NSString *)key
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Check if getting data from path failed
+		const char *pathData = [path UTF8String];
+		if(!pathData) {
+
+			// Throw error
+			throw runtime_error("Getting data from path failed");
+		}
+		
+		// Get data from key
+		const SecureBytes keyData = fromHexString(key);
+		
+		// Resolve opening rewind cache
+		resolve([NSNumber numberWithUnsignedLongLong:openRewindCache(contextSeed.data(), contextSeed.size(), pathData, keyData.data(), keyData.size())]);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Rewind bulletproof with cache
+RCT_EXPORT_METHOD(rewindBulletproofWithCache:(nonnull NSNumber *)cache
+	withProof:(nonnull NSString *)proof
+	withCommit:(nonnull NSString *)commit
+	withNonce:(nonnull NSString *)nonce
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get data from proof
+		const SecureBytes proofData = fromHexString(proof);
+		
+		// Get data from commit
+		const SecureBytes commitData = fromHexString(commit);
+		
+		// Get data from nonce
+		const SecureBytes nonceData = fromHexString(nonce);
+		
+		// Performing rewind bulletproof with cache
+		const tuple<string, SecureBytes, vector<uint8_t>> bulletproofData = rewindBulletproofWithCache(contextSeed.data(), contextSeed.size(), [cache unsignedLongLongValue], proofData.data(), proofData.size(), commitData.data(), commitData.size(), nonceData.data(), nonceData.size());
+		
+		// Check if getting value as a string failed
+		const NSString *valueString = [NSString stringWithUTF8String:get<0>(bulletproofData).c_str()];
+		if(!valueString) {
+
+			// Throw error
+			throw runtime_error("Getting value as a string failed");
+		}
+		
+		// Check if creating result failed
+		const NSDictionary *result = [NSDictionary dictionaryWithObjectsAndKeys:valueString, @"Value", toHexString(get<1>(bulletproofData)), @"Blind", toHexString(get<2>(bulletproofData)), @"Message", nil];
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Resolve result
+		resolve(result);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Close rewind cache
+RCT_EXPORT_METHOD(closeRewindCache:(nonnull NSNumber *)cache
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Close rewind cache
+		closeRewindCache([cache unsignedLongLongValue]);
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Scan outputs
+RCT_EXPORT_METHOD(scanOutputs:(nonnull NSString *)inputPath
+	withStartOffset:(nonnull NSNumber *)startOffset
+	withOutputPath:(nonnull NSString *)outputPath
+	withNonce:(nonnull NSString *)nonce
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Check if getting data from input path failed
+		const char *inputPathData = [inputPath UTF8String];
+		if(!inputPathData) {
+
+			// Throw error
+			throw runtime_error("Getting data from input path failed");
+		}
+		
+		// Check if getting data from output path failed
+		const char *outputPathData = [outputPath UTF8String];
+		if(!outputPathData) {
+
+			// Throw error
+			throw runtime_error("Getting data from output path failed");
+		}
+		
+		// Get data from nonce
+		const SecureBytes nonceData = fromHexString(nonce);
+		
+		// Scan outputs
+		const tuple<uint64_t, uint64_t> scanResult = scanOutputs(contextSeed.data(), contextSeed.size(), inputPathData, [startOffset unsignedLongLongValue], outputPathData, nonceData.data(), nonceData.size());
+		
+		// Check if creating result failed
+		const NSDictionary *result = [NSDictionary dictionaryWithObjectsAndKeys:[NSNumber numberWithUnsignedLongLong:get<0>(scanResult)], @"Offset", [NSNumber numberWithUnsignedLongLong:get<1>(scanResult)], @"Matches", nil];
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Resolve result
+		resolve(result);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Aggregate transactions
+RCT_EXPORT_METHOD(aggregateTransactions:(nonnull NSArray *)inputs
+	withOutputs:(nonnull NSArray *)outputs
+	withKernelExcesses:(nonnull NSArray *)kernelExcesses
+	withOffsets:(nonnull NSArray *)offsets
+	withFees:(nonnull NSArray *)fees
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of inputs
+		const NSUInteger numberOfInputs = [inputs count];
+	
+		// Initialize inputs data and inputs sizes
+		SecureBytes inputsData;
+		vector<size_t> inputsSizes(numberOfInputs);
+		
+		// Go through all inputs
+		size_t i = 0;
+		for(const NSString *input in inputs) {
+		
+			// Create autorelease pool for the input's temporary objects
+			@autoreleasepool {
+			
+				// Get data from input
+				const SecureBytes inputData = fromHexString(input);
+				
+				// Append input data to inputs data
+				inputsData.insert(inputsData.cend(), inputData.cbegin(), inputData.cend());
+				
+				// Append input data's size to inputs sizes
+				inputsSizes[i] = inputData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of outputs
+		const NSUInteger numberOfOutputs = [outputs count];
+	
+		// Initialize outputs data and outputs sizes
+		SecureBytes outputsData;
+		vector<size_t> outputsSizes(numberOfOutputs);
+		
+		// Go through all outputs
+		i = 0;
+		for(const NSString *output in outputs) {
+		
+			// Create autorelease pool for the output's temporary objects
+			@autoreleasepool {
+			
+				// Get data from output
+				const SecureBytes outputData = fromHexString(output);
+				
+				// Append output data to outputs data
+				outputsData.insert(outputsData.cend(), outputData.cbegin(), outputData.cend());
+				
+				// Append output data's size to outputs sizes
+				outputsSizes[i] = outputData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of kernel excesses
+		const NSUInteger numberOfKernelExcesses = [kernelExcesses count];
+	
+		// Initialize kernel excesses data and kernel excesses sizes
+		SecureBytes kernelExcessesData;
+		vector<size_t> kernelExcessesSizes(numberOfKernelExcesses);
+		
+		// Go through all kernel excesses
+		i = 0;
+		for(const NSString *kernelExcess in kernelExcesses) {
+		
+			// Create autorelease pool for the kernel excess's temporary objects
+			@autoreleasepool {
+			
+				// Get data from kernel excess
+				const SecureBytes kernelExcessData = fromHexString(kernelExcess);
+				
+				// Append kernel excess data to kernel excesses data
+				kernelExcessesData.insert(kernelExcessesData.cend(), kernelExcessData.cbegin(), kernelExcessData.cend());
+				
+				// Append kernel excess data's size to kernel excesses sizes
+				kernelExcessesSizes[i] = kernelExcessData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of offsets
+		const NSUInteger numberOfOffsets = [offsets count];
+	
+		// Initialize offsets data and offsets sizes
+		SecureBytes offsetsData;
+		vector<size_t> offsetsSizes(numberOfOffsets);
+		
+		// Go through all offsets
+		i = 0;
+		for(const NSString *offset in offsets) {
+		
+			// Create autorelease pool for the offset's temporary objects
+			@autoreleasepool {
+			
+				// Get data from offset
+				const SecureBytes offsetData = fromHexString(offset);
+				
+				// Append offset data to offsets data
+				offsetsData.insert(offsetsData.cend(), offsetData.cbegin(), offsetData.cend());
+				
+				// Append offset data's size to offsets sizes
+				offsetsSizes[i] = offsetData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of fees
+		const NSUInteger numberOfFees = [fees count];
+		
+		// Initialize fees data
+		vector<string> feesData;
+		vector<const char *> feesPointers;
+		feesData.reserve(numberOfFees);
+		
+		// Go through all fees
+		for(const NSString *fee in fees) {
+		
+			// Create autorelease pool for the fee's temporary objects
+			@autoreleasepool {
+			
+				// Check if getting data from fee failed
+				const char *feeData = [fee UTF8String];
+				if(!feeData) {
+				
+					// Throw error
+					throw runtime_error("Getting data from fee failed");
+				}
+				
+				// Append fee data to fees data
+				feesData.emplace_back(feeData);
+				feesPointers.push_back(feesData.back().c_str());
+			}
+		}
+		
+		// Aggregate transactions
+		const tuple<vector<uint8_t>, vector<uint8_t>, vector<uint8_t>> aggregateData = aggregateTransactions(contextSeed.data(), contextSeed.size(), inputsData.data(), inputsSizes.data(), numberOfInputs, outputsData.data(), outputsSizes.data(), numberOfOutputs, kernelExcessesData.data(), kernelExcessesSizes.data(), numberOfKernelExcesses, offsetsData.data(), offsetsSizes.data(), numberOfOffsets, feesPointers.data(), numberOfFees);
+		
+		// Check if creating result failed
+		const NSDictionary *result = [NSDictionary dictionaryWithObjectsAndKeys:toHexString(get<0>(aggregateData)), @"Inputs", toHexString(get<1>(aggregateData)), @"Outputs", toHexString(get<2>(aggregateData)), @"Offset", nil];
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Resolve result
+		resolve(result);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Validate block
+RCT_EXPORT_METHOD(validateBlock:(nonnull NSArray *)inputs
+	withOutputs:(nonnull NSArray *)outputs
+	withProofs:(nonnull NSArray *)proofs
+	withKernelExcesses:(nonnull NSArray *)kernelExcesses
+	withSignatures:(nonnull NSArray *)signatures
+	withMessages:(nonnull NSArray *)messages
+	withOffset:(nonnull NSString *)offset
+	withReward:(nonnull NSString *)reward
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Initialize context seed
+		initializeContextSeed();
+		
+		// Get number of inputs
+		const NSUInteger numberOfInputs = [inputs count];
+	
+		// Initialize inputs data and inputs sizes
+		SecureBytes inputsData;
+		vector<size_t> inputsSizes(numberOfInputs);
+		
+		// Go through all inputs
+		size_t i = 0;
+		for(const NSString *input in inputs) {
+		
+			// Create autorelease pool for the input's temporary objects
+			@autoreleasepool {
+			
+				// Get data from input
+				const SecureBytes inputData = fromHexString(input);
+				
+				// Append input data to inputs data
+				inputsData.insert(inputsData.cend(), inputData.cbegin(), inputData.cend());
+				
+				// Append input data's size to inputs sizes
+				inputsSizes[i] = inputData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of outputs
+		const NSUInteger numberOfOutputs = [outputs count];
+	
+		// Initialize outputs data and outputs sizes
+		SecureBytes outputsData;
+		vector<size_t> outputsSizes(numberOfOutputs);
+		
+		// Go through all outputs
+		i = 0;
+		for(const NSString *output in outputs) {
+		
+			// Create autorelease pool for the output's temporary objects
+			@autoreleasepool {
+			
+				// Get data from output
+				const SecureBytes outputData = fromHexString(output);
+				
+				// Append output data to outputs data
+				outputsData.insert(outputsData.cend(), outputData.cbegin(), outputData.cend());
+				
+				// Append output data's size to outputs sizes
+				outputsSizes[i] = outputData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of proofs
+		const NSUInteger numberOfProofs = [proofs count];
+	
+		// Initialize proofs data and proofs sizes
+		SecureBytes proofsData;
+		vector<size_t> proofsSizes(numberOfProofs);
+		
+		// Go through all proofs
+		i = 0;
+		for(const NSString *proof in proofs) {
+		
+			// Create autorelease pool for the proof's temporary objects
+			@autoreleasepool {
+			
+				// Get data from proof
+				const SecureBytes proofData = fromHexString(proof);
+				
+				// Append proof data to proofs data
+				proofsData.insert(proofsData.cend(), proofData.cbegin(), proofData.cend());
+				
+				// Append proof data's size to proofs sizes
+				proofsSizes[i] = proofData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of kernel excesses
+		const NSUInteger numberOfKernelExcesses = [kernelExcesses count];
+	
+		// Initialize kernel excesses data and kernel excesses sizes
+		SecureBytes kernelExcessesData;
+		vector<size_t> kernelExcessesSizes(numberOfKernelExcesses);
+		
+		// Go through all kernel excesses
+		i = 0;
+		for(const NSString *kernelExcess in kernelExcesses) {
+		
+			// Create autorelease pool for the kernel excess's temporary objects
+			@autoreleasepool {
+			
+				// Get data from kernel excess
+				const SecureBytes kernelExcessData = fromHexString(kernelExcess);
+				
+				// Append kernel excess data to kernel excesses data
+				kernelExcessesData.insert(kernelExcessesData.cend(), kernelExcessData.cbegin(), kernelExcessData.cend());
+				
+				// Append kernel excess data's size to kernel excesses sizes
+				kernelExcessesSizes[i] = kernelExcessData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of signatures
+		const NSUInteger numberOfSignatures = [signatures count];
+	
+		// Initialize signatures data and signatures sizes
+		SecureBytes signaturesData;
+		vector<size_t> signaturesSizes(numberOfSignatures);
+		
+		// Go through all signatures
+		i = 0;
+		for(const NSString *signature in signatures) {
+		
+			// Create autorelease pool for the signature's temporary objects
+			@autoreleasepool {
+			
+				// Get data from signature
+				const SecureBytes signatureData = fromHexString(signature);
+				
+				// Append signature data to signatures data
+				signaturesData.insert(signaturesData.cend(), signatureData.cbegin(), signatureData.cend());
+				
+				// Append signature data's size to signatures sizes
+				signaturesSizes[i] = signatureData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get number of messages
+		const NSUInteger numberOfMessages = [messages count];
+	
+		// Initialize messages data and messages sizes
+		SecureBytes messagesData;
+		vector<size_t> messagesSizes(numberOfMessages);
+		
+		// Go through all messages
+		i = 0;
+		for(const NSString *message in messages) {
+		
+			// Create autorelease pool for the message's temporary objects
+			@autoreleasepool {
+			
+				// Get data from message
+				const SecureBytes messageData = fromHexString(message);
+				
+				// Append message data to messages data
+				messagesData.insert(messagesData.cend(), messageData.cbegin(), messageData.cend());
+				
+				// Append message data's size to messages sizes
+				messagesSizes[i] = messageData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Get data from offset
+		const SecureBytes offsetData = fromHexString(offset);
+		
+		// Check if getting data from reward failed
+		const char *rewardData = [reward UTF8String];
+		if(!rewardData) {
+
+			// Throw error
+			throw runtime_error("Getting data from reward failed");
+		}
+		
+		// Validate block
+		const tuple<uint8_t, uint64_t> validation = validateBlock(contextSeed.data(), contextSeed.size(), inputsData.data(), inputsSizes.data(), numberOfInputs, outputsData.data(), outputsSizes.data(), numberOfOutputs, proofsData.data(), proofsSizes.data(), numberOfProofs, kernelExcessesData.data(), kernelExcessesSizes.data(), numberOfKernelExcesses, signaturesData.data(), signaturesSizes.data(), numberOfSignatures, messagesData.data(), messagesSizes.data(), numberOfMessages, offsetData.data(), offsetData.size(), rewardData);
+		
+		// Check if creating result failed
+		const NSDictionary *result = [NSDictionary dictionaryWithObjectsAndKeys:[NSNumber numberWithUnsignedChar:get<0>(validation)], @"Result", [NSNumber numberWithUnsignedLongLong:get<1>(validation)], @"Index", nil];
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Creating result failed");
+		}
+		
+		// Resolve result
+		resolve(result);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Get stats
+RCT_EXPORT_METHOD(getStats:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Check if getting stats as a string failed
+		const NSString *result = [NSString stringWithUTF8String:getStats().c_str()];
+		if(!result) {
+		
+			// Throw error
+			throw runtime_error("Getting stats as a string failed");
+		}
+		
+		// Resolve result
+		resolve(result);
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// Reset stats
+RCT_EXPORT_METHOD(resetStats:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Reset stats
+		resetStats();
+		
+		// Resolve true
+		resolve(toBool(true));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+// SHA-256 hashes
+RCT_EXPORT_METHOD(sha256Hashes:(nonnull NSArray *)messages
+	withResolver:(RCTPromiseResolveBlock)resolve
+	withReject:(RCTPromiseRejectBlock)reject)
+{
+
+	// Try
+	try {
+	
+		// Get number of messages
+		const NSUInteger numberOfMessages = [messages count];
+	
+		// Initialize messages data and messages sizes
+		SecureBytes messagesData;
+		vector<size_t> messagesSizes(numberOfMessages);
+		
+		// Go through all messages
+		size_t i = 0;
+		for(const NSString *message in messages) {
+		
+			// Create autorelease pool for the message's temporary objects
+			@autoreleasepool {
+			
+				// Get data from message
+				const SecureBytes messageData = fromHexString(message);
+				
+				// Append message data to messages data
+				messagesData.insert(messagesData.cend(), messageData.cbegin(), messageData.cend());
+				
+				// Append message data's size to messages sizes
+				messagesSizes[i] = messageData.size();
+				
+				// Increment index
+				++i;
+			}
+		}
+		
+		// Resolve getting SHA-256 hashes of the messages
+		resolve(toHexString(sha256Hashes(messagesData.data(), messagesSizes.data(), numberOfMessages)));
+	}
+
+	// Catch errors
+	catch(const exception &error) {
+
+		// Initialize message
+		NSString *message;
+
+		// Try
+		try {
+
+			// Set message to error's message
+			message = [NSString stringWithUTF8String:error.what()];
+		}
+
+		// Catch errors
+		catch(...) {
+
+			// Set error to nothing
+			message = nullptr;
+		}
+
+		// Reject error
+		reject(@"Error", message ? message : @"", nil);
+	}
+}
+
+@end
+
+
+// Supporting function implementation
+
+// From hex string
+SecureBytes fromHexString(const NSString *hexString) {
+
+	// Trace converting from hex
+	TRACE_SPAN("fromHexString");
+
+	// Check if getting input from hex string failed
+	const char *input = [hexString UTF8String];
+	if(!input) {
+
+		// Throw error
+		throw runtime_error("Getting input from hex string failed");
+	}
+
+	// Get input length
+	const size_t inputLength = strlen(input);
+
+	// Check if input length is invalid
+	if(inputLength % HEX_CHARACTER_LENGTH) {
+
+		// Throw error
+		throw runtime_error("Input length is invalid");
+	}
+
+	// Initialize result
+	SecureBytes result(inputLength / HEX_CHARACTER_LENGTH);
+
+	// Go through all character pairs in the input
+	for(size_t i = 0; i < inputLength; i += HEX_CHARACTER_LENGTH) {
+
+		// Set value in result
+		result[i / HEX_CHARACTER_LENGTH] = (characterToNumber(input[i]) << BITS_IN_A_BYTE / 2) | characterToNumber(input[i + 1]);
+	}
+
+	// Return result
+	return result;
+}
+
+// To hex string
+template<typename Allocator> const NSString *toHexString(const vector<uint8_t, Allocator> &input) {
+
+	// Trace converting to hex
+	TRACE_SPAN("toHexString");
 
-	// Configure result
-	result << hex << setfill('0');
+	// Initialize result in secure memory so that it's cleared after use
+	vector<char, SecureAllocator<char>> result(input.size() * HEX_CHARACTER_LENGTH + sizeof('\0'));
 
 	// Go through all bytes in the input
-	for(const uint8_t byte : input) {
+	for(size_t i = 0; i < input.size(); ++i) {
 
-		// Append byte to result
-		result << setw(HEX_CHARACTER_LENGTH) << static_cast<unsigned>(byte);
+		// Set byte's characters in result
+		result[i * HEX_CHARACTER_LENGTH] = HEX_CHARACTERS[input[i] >> BITS_IN_A_BYTE / 2];
+		result[i * HEX_CHARACTER_LENGTH + 1] = HEX_CHARACTERS[input[i] & ((1 << BITS_IN_A_BYTE / 2) - 1)];
 	}
 
 	// Check if getting result as a string failed
-	const NSString *resultString = [NSString stringWithUTF8String:result.str().c_str()];
+	const NSString *resultString = [NSString stringWithUTF8String:result.data()];
 	if(!resultString) {
 
 		// Throw error
@@ -0,0 +1,1034 @@
+// Header files
+#include <cerrno>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <fcntl.h>
+#include <node_api.h>
+#include <unistd.h>
+#include "secp256k1-zkp-react.h"
+
+using namespace std;
+
+
+// Classes
+
+// Bytes class
+class Bytes {
+
+	// Public
+	public:
+	
+		// Data
+		const uint8_t *data;
+		
+		// Size
+		size_t size;
+};
+
+// Byte arrays class
+class ByteArrays {
+
+	// Public
+	public:
+	
+		// Data
+		const uint8_t *data;
+		
+		// Sizes
+		vector<size_t> sizes;
+};
+
+// Async operation class
+class AsyncOperation {
+
+	// Public
+	public:
+	
+		// Constructor
+		explicit AsyncOperation(napi_env environment) :
+		
+			// Set environment to environment
+			environment(environment),
+			
+			// Set deferred to nothing
+			deferred(nullptr),
+			
+			// Set work to nothing
+			work(nullptr),
+			
+			// Set failed to false
+			failed(false)
+		{
+		}
+		
+		// Destructor
+		~AsyncOperation() {
+		
+			// Go through all references
+			for(napi_ref reference : references) {
+			
+				// Delete reference
+				napi_delete_reference(environment, reference);
+			}
+			
+			// Check if work exists
+			if(work) {
+			
+				// Delete work
+				napi_delete_async_work(environment, work);
+			}
+		}
+		
+		// Get buffer
+		Bytes getBuffer(napi_value value, bool isNullable = false) {
+		
+			// Check if value is nothing and it can be
+			if(isNullable && isNothing(value)) {
+			
+				// Return nothing
+				return Bytes{nullptr, 0};
+			}
+			
+			// Check if value isn't a buffer
+			bool isBuffer;
+			if(napi_is_buffer(environment, value, &isBuffer) != napi_ok || !isBuffer) {
+			
+				// Throw error
+				throw runtime_error("Argument isn't a buffer");
+			}
+			
+			// Check if getting buffer's data failed
+			void *data;
+			size_t size;
+			if(napi_get_buffer_info(environment, value, &data, &size) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Getting buffer's data failed");
+			}
+			
+			// Check if referencing buffer so that it isn't collected while the work runs failed
+			napi_ref reference;
+			if(napi_create_reference(environment, value, 1, &reference) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Referencing buffer failed");
+			}
+			references.push_back(reference);
+			
+			// Return buffer's data
+			return Bytes{static_cast<const uint8_t *>(data), size};
+		}
+		
+		// Get buffers
+		ByteArrays getBuffers(napi_value value) {
+		
+			// Check if getting array's length failed
+			const uint32_t length = getArrayLength(value);
+			
+			// Go through all buffers in the array
+			vector<Bytes> buffers(length);
+			ByteArrays result{nullptr, vector<size_t>(length)};
+			bool isContiguous = true;
+			for(uint32_t i = 0; i < length; ++i) {
+			
+				// Get buffer
+				buffers[i] = getBuffer(getArrayElement(value, i));
+				result.sizes[i] = buffers[i].size;
+				
+				// Check if buffer doesn't follow the previous buffer in memory
+				if(i && buffers[i].data != buffers[i - 1].data + buffers[i - 1].size) {
+				
+					// Set is contiguous to false
+					isContiguous = false;
+				}
+			}
+			
+			// Check if buffers are contiguous like slices of the same buffer
+			if(isContiguous) {
+			
+				// Set result's data to the first buffer's data
+				result.data = length ? buffers[0].data : nullptr;
+			}
+			
+			// Otherwise
+			else {
+			
+				// Go through all buffers
+				copies.emplace_back();
+				vector<uint8_t> &copy = copies.back();
+				for(const Bytes &buffer : buffers) {
+				
+					// Append buffer to the copy
+					copy.insert(copy.cend(), buffer.data, buffer.data + buffer.size);
+				}
+				
+				// Set result's data to the copy
+				result.data = copy.data();
+			}
+			
+			// Return result
+			return result;
+		}
+		
+		// Get string
+		const char *getString(napi_value value) {
+		
+			// Check if getting string's length failed
+			size_t length;
+			if(napi_get_value_string_utf8(environment, value, nullptr, 0, &length) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Argument isn't a string");
+			}
+			
+			// Check if getting string failed
+			strings.emplace_back(length + sizeof('\0'), '\0');
+			if(napi_get_value_string_utf8(environment, value, &strings.back()[0], length + sizeof('\0'), nullptr) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Getting string failed");
+			}
+			
+			// Remove terminator from the string
+			strings.back().resize(length);
+			
+			// Return string
+			return strings.back().c_str();
+		}
+		
+		// Get strings
+		vector<const char *> getStrings(napi_value value) {
+		
+			// Check if getting array's length failed
+			const uint32_t length = getArrayLength(value);
+			
+			// Go through all strings in the array
+			vector<const char *> result(length);
+			for(uint32_t i = 0; i < length; ++i) {
+			
+				// Get string
+				result[i] = getString(getArrayElement(value, i));
+			}
+			
+			// Return result
+			return result;
+		}
+		
+		// Get bool
+		bool getBool(napi_value value) {
+		
+			// Check if argument isn't a bool
+			bool result;
+			if(napi_get_value_bool(environment, value, &result) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Argument isn't a bool");
+			}
+			
+			// Return result
+			return result;
+		}
+		
+		// Set work
+		template<typename Result> void setWork(const function<Result()> &body) {
+		
+			// Set execute to run the body and save its result
+			const shared_ptr<Result> result = make_shared<Result>();
+			execute = [body, result]() {
+			
+				// Save running body's result
+				*result = body();
+			};
+			
+			// Set complete to convert the result to a value
+			complete = [result](napi_env environment) -> napi_value {
+			
+				// Return result as a value
+				return toValue(environment, *result);
+			};
+		}
+		
+		// Start
+		static napi_value start(unique_ptr<AsyncOperation> operation) {
+		
+			// Check if creating promise failed
+			napi_value promise;
+			if(napi_create_promise(operation->environment, &operation->deferred, &promise) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Creating promise failed");
+			}
+			
+			// Check if creating work failed
+			napi_value name;
+			if(napi_create_string_utf8(operation->environment, "secp256k1-zkp-react", NAPI_AUTO_LENGTH, &name) != napi_ok || napi_create_async_work(operation->environment, nullptr, name, executeWork, completeWork, operation.get(), &operation->work) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Creating work failed");
+			}
+			
+			// Check if queueing work on the thread pool failed
+			if(napi_queue_async_work(operation->environment, operation->work) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Queueing work failed");
+			}
+			
+			// Release operation since the work owns it
+			operation.release();
+			
+			// Return promise
+			return promise;
+		}
+	
+	// Private
+	private:
+	
+		// Is nothing
+		bool isNothing(napi_value value) const {
+		
+			// Return if value is null or undefined
+			napi_valuetype type;
+			return napi_typeof(environment, value, &type) == napi_ok && (type == napi_null || type == napi_undefined);
+		}
+		
+		// Get array length
+		uint32_t getArrayLength(napi_value value) const {
+		
+			// Check if value isn't an array
+			bool isArray;
+			uint32_t length;
+			if(napi_is_array(environment, value, &isArray) != napi_ok || !isArray || napi_get_array_length(environment, value, &length) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Argument isn't an array");
+			}
+			
+			// Return length
+			return length;
+		}
+		
+		// Get array element
+		napi_value getArrayElement(napi_value value, uint32_t index) const {
+		
+			// Check if getting element failed
+			napi_value element;
+			if(napi_get_element(environment, value, index, &element) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Getting array element failed");
+			}
+			
+			// Return element
+			return element;
+		}
+		
+		// To value
+		static napi_value toValue(napi_env environment, bool result) {
+		
+			// Check if creating bool failed
+			napi_value value;
+			if(napi_get_boolean(environment, result, &value) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Creating bool failed");
+			}
+			
+			// Return value
+			return value;
+		}
+		
+		// To value
+		template<typename Allocator> static napi_value toValue(napi_env environment, const vector<uint8_t, Allocator> &result) {
+		
+			// Check if creating buffer failed
+			napi_value value;
+			if(napi_create_buffer_copy(environment, result.size(), result.data(), nullptr, &value) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Creating buffer failed");
+			}
+			
+			// Return value
+			return value;
+		}
+		
+		// To value
+		static napi_value toValue(napi_env environment, const tuple<uint8_t, uint64_t> &result) {
+		
+			// Check if creating object with the result and index failed
+			napi_value value, validationResult, index;
+			if(napi_create_object(environment, &value) != napi_ok || napi_create_uint32(environment, get<0>(result), &validationResult) != napi_ok || napi_create_double(environment, static_cast<double>(get<1>(result)), &index) != napi_ok || napi_set_named_property(environment, value, "Result", validationResult) != napi_ok || napi_set_named_property(environment, value, "Index", index) != napi_ok) {
+			
+				// Throw error
+				throw runtime_error("Creating object failed");
+			}
+			
+			// Return value
+			return value;
+		}
+		
+		// Execute work
+		static void executeWork(napi_env environment, void *data) {
+		
+			// Get operation
+			AsyncOperation *operation = static_cast<AsyncOperation *>(data);
+			
+			// Try
+			try {
+			
+				// Execute
+				operation->execute();
+			}
+			
+			// Catch errors
+			catch(const exception &error) {
+			
+				// Set operation's error
+				operation->error = error.what() ? error.what() : "";
+				operation->failed = true;
+			}
+		}
+		
+		// Complete work
+		static void completeWork(napi_env environment, napi_status status, void *data) {
+		
+			// Get operation
+			const unique_ptr<AsyncOperation> operation(static_cast<AsyncOperation *>(data));
+			
+			// Try
+			try {
+			
+				// Check if work was cancelled
+				if(status != napi_ok) {
+				
+					// Throw error
+					throw runtime_error("Work was cancelled");
+				}
+				
+				// Check if operation failed
+				if(operation->failed) {
+				
+					// Throw error
+					throw runtime_error(operation->error);
+				}
+				
+				// Resolve promise to the result
+				napi_resolve_deferred(environment, operation->deferred, operation->complete(environment));
+			}
+			
+			// Catch errors
+			catch(const exception &error) {
+			
+				// Check if creating error succeeded
+				napi_value message, value;
+				if(napi_create_string_utf8(environment, error.what() ? error.what() : "", NAPI_AUTO_LENGTH, &message) == napi_ok && napi_create_error(environment, nullptr, message, &value) == napi_ok) {
+				
+					// Reject promise with the error
+					napi_reject_deferred(environment, operation->deferred, value);
+				}
+			}
+		}
+		
+		// Environment
+		napi_env environment;
+		
+		// Deferred
+		napi_deferred deferred;
+		
+		// Work
+		napi_async_work work;
+		
+		// References
+		vector<napi_ref> references;
+		
+		// Copies
+		list<vector<uint8_t>> copies;
+		
+		// Strings
+		list<string> strings;
+		
+		// Execute
+		function<void()> execute;
+		
+		// Complete
+		function<napi_value(napi_env environment)> complete;
+		
+		// Failed
+		bool failed;
+		
+		// Error
+		string error;
+};
+
+
+// Global variables
+
+// Context seed
+static vector<uint8_t> contextSeed;
+
+// Context seed initialized
+static once_flag contextSeedInitialized;
+
+
+// Function prototypes
+
+// Is valid public key
+static napi_value isValidPublicKeyBinding(napi_env environment, napi_callback_info information);
+
+// Is valid commit
+static napi_value isValidCommitBinding(napi_env environment, napi_callback_info information);
+
+// Is valid single-signer signature
+static napi_value isValidSingleSignerSignatureBinding(napi_env environment, napi_callback_info information);
+
+// Verify bulletproof
+static napi_value verifyBulletproofBinding(napi_env environment, napi_callback_info information);
+
+// Pedersen commit
+static napi_value pedersenCommitBinding(napi_env environment, napi_callback_info information);
+
+// Pedersen commit sum
+static napi_value pedersenCommitSumBinding(napi_env environment, napi_callback_info information);
+
+// Pedersen commit to public key
+static napi_value pedersenCommitToPublicKeyBinding(napi_env environment, napi_callback_info information);
+
+// Add single-signer signatures
+static napi_value addSingleSignerSignaturesBinding(napi_env environment, napi_callback_info information);
+
+// Verify single-signer signature
+static napi_value verifySingleSignerSignatureBinding(napi_env environment, napi_callback_info information);
+
+// Combine public keys
+static napi_value combinePublicKeysBinding(napi_env environment, napi_callback_info information);
+
+// Verify message hash signature
+static napi_value verifyMessageHashSignatureBinding(napi_env environment, napi_callback_info information);
+
+// Public keys from secret keys
+static napi_value publicKeysFromSecretKeysBinding(napi_env environment, napi_callback_info information);
+
+// Pedersen commits
+static napi_value pedersenCommitsBinding(napi_env environment, napi_callback_info information);
+
+// Execute commands
+static napi_value executeCommandsBinding(napi_env environment, napi_callback_info information);
+
+// Validate block
+static napi_value validateBlockBinding(napi_env environment, napi_callback_info information);
+
+// SHA-256 hashes
+static napi_value sha256HashesBinding(napi_env environment, napi_callback_info information);
+
+// Get stats
+static napi_value getStatsBinding(napi_env environment, napi_callback_info information);
+
+// Reset stats
+static napi_value resetStatsBinding(napi_env environment, napi_callback_info information);
+
+// Run operation
+static napi_value runOperation(napi_env environment, napi_callback_info information, size_t numberOfArguments, const function<void(AsyncOperation &operation, const napi_value arguments[])> &setup);
+
+// Initialize context seed
+static void initializeContextSeed();
+
+// Initialize module
+static napi_value initializeModule(napi_env environment, napi_value exports);
+
+
+// Supporting function implementation
+
+// Is valid public key
+napi_value isValidPublicKeyBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 1, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get public key
+		const Bytes publicKey = operation.getBuffer(arguments[0]);
+		
+		// Set work to checking if public key is valid
+		operation.setWork<bool>([publicKey]() {
+		
+			// Return if public key is valid
+			return isValidPublicKey(contextSeed.data(), contextSeed.size(), publicKey.data, publicKey.size);
+		});
+	});
+}
+
+// Is valid commit
+napi_value isValidCommitBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 1, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get commit
+		const Bytes commit = operation.getBuffer(arguments[0]);
+		
+		// Set work to checking if commit is valid
+		operation.setWork<bool>([commit]() {
+		
+			// Return if commit is valid
+			return isValidCommit(contextSeed.data(), contextSeed.size(), commit.data, commit.size);
+		});
+	});
+}
+
+// Is valid single-signer signature
+napi_value isValidSingleSignerSignatureBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 1, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get signature
+		const Bytes signature = operation.getBuffer(arguments[0]);
+		
+		// Set work to checking if single-signer signature is valid
+		operation.setWork<bool>([signature]() {
+		
+			// Return if single-signer signature is valid
+			return isValidSingleSignerSignature(contextSeed.data(), contextSeed.size(), signature.data, signature.size);
+		});
+	});
+}
+
+// Verify bulletproof
+napi_value verifyBulletproofBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 3, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get proof, commit, and extra commit
+		const Bytes proof = operation.getBuffer(arguments[0]);
+		const Bytes commit = operation.getBuffer(arguments[1]);
+		const Bytes extraCommit = operation.getBuffer(arguments[2], true);
+		
+		// Set work to verifying bulletproof
+		operation.setWork<bool>([proof, commit, extraCommit]() {
+		
+			// Return if bulletproof is verified
+			return verifyBulletproof(contextSeed.data(), contextSeed.size(), proof.data, proof.size, commit.data, commit.size, extraCommit.data, extraCommit.size);
+		});
+	});
+}
+
+// Pedersen commit
+napi_value pedersenCommitBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 2, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get blind and value
+		const Bytes blind = operation.getBuffer(arguments[0]);
+		const char *value = operation.getString(arguments[1]);
+		
+		// Set work to performing Pedersen commit
+		operation.setWork<vector<uint8_t>>([blind, value]() {
+		
+			// Return performing Pedersen commit
+			return pedersenCommit(contextSeed.data(), contextSeed.size(), blind.data, blind.size, value);
+		});
+	});
+}
+
+// Pedersen commit sum
+napi_value pedersenCommitSumBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 2, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get positive commits and negative commits
+		ByteArrays positiveCommits = operation.getBuffers(arguments[0]);
+		ByteArrays negativeCommits = operation.getBuffers(arguments[1]);
+		
+		// Set work to performing Pedersen commit sum
+		operation.setWork<vector<uint8_t>>([positiveCommits, negativeCommits]() mutable {
+		
+			// Return performing Pedersen commit sum
+			return pedersenCommitSum(contextSeed.data(), contextSeed.size(), positiveCommits.data, positiveCommits.sizes.data(), positiveCommits.sizes.size(), negativeCommits.data, negativeCommits.sizes.data(), negativeCommits.sizes.size());
+		});
+	});
+}
+
+// Pedersen commit to public key
+napi_value pedersenCommitToPublicKeyBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 1, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get commit
+		const Bytes commit = operation.getBuffer(arguments[0]);
+		
+		// Set work to getting public key from the commit
+		operation.setWork<vector<uint8_t>>([commit]() {
+		
+			// Return getting public key from the commit
+			return pedersenCommitToPublicKey(contextSeed.data(), contextSeed.size(), commit.data, commit.size);
+		});
+	});
+}
+
+// Add single-signer signatures
+napi_value addSingleSignerSignaturesBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 2, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get signatures and public nonce total
+		ByteArrays signatures = operation.getBuffers(arguments[0]);
+		const Bytes publicNonceTotal = operation.getBuffer(arguments[1]);
+		
+		// Set work to adding single-signer signatures
+		operation.setWork<vector<uint8_t>>([signatures, publicNonceTotal]() mutable {
+		
+			// Return adding single-signer signatures
+			return addSingleSignerSignatures(contextSeed.data(), contextSeed.size(), signatures.data, signatures.sizes.data(), signatures.sizes.size(), publicNonceTotal.data, publicNonceTotal.size);
+		});
+	});
+}
+
+// Verify single-signer signature
+napi_value verifySingleSignerSignatureBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 6, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get signature, message, public nonce, public key, public key total, and is partial
+		const Bytes signature = operation.getBuffer(arguments[0]);
+		const Bytes message = operation.getBuffer(arguments[1]);
+		const Bytes publicNonce = operation.getBuffer(arguments[2], true);
+		const Bytes publicKey = operation.getBuffer(arguments[3]);
+		const Bytes publicKeyTotal = operation.getBuffer(arguments[4]);
+		const bool isPartial = operation.getBool(arguments[5]);
+		
+		// Set work to verifying single-signer signature
+		operation.setWork<bool>([signature, message, publicNonce, publicKey, publicKeyTotal, isPartial]() {
+		
+			// Return if single-signer signature is verified
+			return verifySingleSignerSignature(contextSeed.data(), contextSeed.size(), signature.data, signature.size, message.data, message.size, publicNonce.data, publicNonce.size, publicKey.data, publicKey.size, publicKeyTotal.data, publicKeyTotal.size, isPartial);
+		});
+	});
+}
+
+// Combine public keys
+napi_value combinePublicKeysBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 1, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get public keys
+		ByteArrays publicKeys = operation.getBuffers(arguments[0]);
+		
+		// Set work to combining public keys
+		operation.setWork<vector<uint8_t>>([publicKeys]() mutable {
+		
+			// Return combining public keys
+			return combinePublicKeys(contextSeed.data(), contextSeed.size(), publicKeys.data, publicKeys.sizes.data(), publicKeys.sizes.size());
+		});
+	});
+}
+
+// Verify message hash signature
+napi_value verifyMessageHashSignatureBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 3, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get signature, message hash, and public key
+		const Bytes signature = operation.getBuffer(arguments[0]);
+		const Bytes messageHash = operation.getBuffer(arguments[1]);
+		const Bytes publicKey = operation.getBuffer(arguments[2]);
+		
+		// Set work to verifying message hash signature
+		operation.setWork<bool>([signature, messageHash, publicKey]() {
+		
+			// Return if message hash signature is verified
+			return verifyMessageHashSignature(contextSeed.data(), contextSeed.size(), signature.data, signature.size, messageHash.data, messageHash.size, publicKey.data, publicKey.size);
+		});
+	});
+}
+
+// Public keys from secret keys
+napi_value publicKeysFromSecretKeysBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 1, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get secret keys
+		ByteArrays secretKeys = operation.getBuffers(arguments[0]);
+		
+		// Set work to getting public keys from secret keys
+		operation.setWork<vector<uint8_t>>([secretKeys]() mutable {
+		
+			// Return getting public keys from secret keys
+			return publicKeysFromSecretKeys(contextSeed.data(), contextSeed.size(), secretKeys.data, secretKeys.sizes.data(), secretKeys.sizes.size());
+		});
+	});
+}
+
+// Pedersen commits
+napi_value pedersenCommitsBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 2, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Check if getting blinds and values failed
+		ByteArrays blinds = operation.getBuffers(arguments[0]);
+		vector<const char *> values = operation.getStrings(arguments[1]);
+		if(blinds.sizes.size() != values.size()) {
+		
+			// Throw error
+			throw runtime_error("Blinds and values have different lengths");
+		}
+		
+		// Set work to performing Pedersen commits
+		operation.setWork<vector<uint8_t>>([blinds, values]() mutable {
+		
+			// Return performing Pedersen commits
+			return pedersenCommits(contextSeed.data(), contextSeed.size(), blinds.data, blinds.sizes.data(), values.data(), values.size());
+		});
+	});
+}
+
+// Execute commands
+napi_value executeCommandsBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 1, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get commands
+		const Bytes commands = operation.getBuffer(arguments[0]);
+		
+		// Set work to executing commands
+		operation.setWork<SecureBytes>([commands]() {
+		
+			// Return executing commands
+			return executeCommands(contextSeed.data(), contextSeed.size(), commands.data, commands.size);
+		});
+	});
+}
+
+// Validate block
+napi_value validateBlockBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 8, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get inputs, outputs, proofs, kernel excesses, signatures, messages, offset, and reward
+		ByteArrays inputs = operation.getBuffers(arguments[0]);
+		ByteArrays outputs = operation.getBuffers(arguments[1]);
+		ByteArrays proofs = operation.getBuffers(arguments[2]);
+		ByteArrays kernelExcesses = operation.getBuffers(arguments[3]);
+		ByteArrays signatures = operation.getBuffers(arguments[4]);
+		ByteArrays messages = operation.getBuffers(arguments[5]);
+		const Bytes offset = operation.getBuffer(arguments[6]);
+		const char *reward = operation.getString(arguments[7]);
+		
+		// Set work to validating block
+		operation.setWork<tuple<uint8_t, uint64_t>>([inputs, outputs, proofs, kernelExcesses, signatures, messages, offset, reward]() mutable {
+		
+			// Return validating block
+			return validateBlock(contextSeed.data(), contextSeed.size(), inputs.data, inputs.sizes.data(), inputs.sizes.size(), outputs.data, outputs.sizes.data(), outputs.sizes.size(), proofs.data, proofs.sizes.data(), proofs.sizes.size(), kernelExcesses.data, kernelExcesses.sizes.data(), kernelExcesses.sizes.size(), signatures.data, signatures.sizes.data(), signatures.sizes.size(), messages.data, messages.sizes.data(), messages.sizes.size(), offset.data, offset.size, reward);
+		});
+	});
+}
+
+// SHA-256 hashes
+napi_value sha256HashesBinding(napi_env environment, napi_callback_info information) {
+
+	// Return running operation
+	return runOperation(environment, information, 1, [](AsyncOperation &operation, const napi_value arguments[]) {
+	
+		// Get messages
+		ByteArrays messages = operation.getBuffers(arguments[0]);
+		
+		// Set work to getting SHA-256 hashes of the messages
+		operation.setWork<vector<uint8_t>>([messages]() mutable {
+		
+			// Return getting SHA-256 hashes of the messages
+			return sha256Hashes(messages.data, messages.sizes.data(), messages.sizes.size());
+		});
+	});
+}
+
+// Get stats
+napi_value getStatsBinding(napi_env environment, napi_callback_info information) {
+
+	// Try
+	try {
+	
+		// Check if creating string from the stats failed
+		const string stats = getStats();
+		napi_value result;
+		if(napi_create_string_utf8(environment, stats.c_str(), stats.size(), &result) != napi_ok) {
+		
+			// Throw error
+			throw runtime_error("Creating string failed");
+		}
+		
+		// Return result
+		return result;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Throw error
+		napi_throw_error(environment, nullptr, error.what() ? error.what() : "");
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Reset stats
+napi_value resetStatsBinding(napi_env environment, napi_callback_info information) {
+
+	// Reset stats
+	resetStats();
+	
+	// Return nothing
+	return nullptr;
+}
+
+// Run operation
+napi_value runOperation(napi_env environment, napi_callback_info information, size_t numberOfArguments, const function<void(AsyncOperation &operation, const napi_value arguments[])> &setup) {
+
+	// Try
+	try {
+	
+		// Check if getting arguments failed
+		vector<napi_value> arguments(numberOfArguments);
+		size_t numberOfProvidedArguments = numberOfArguments;
+		if(napi_get_cb_info(environment, information, &numberOfProvidedArguments, arguments.data(), nullptr, nullptr) != napi_ok) {
+		
+			// Throw error
+			throw runtime_error("Getting arguments failed");
+		}
+		
+		// Create operation from the arguments
+		unique_ptr<AsyncOperation> operation(new AsyncOperation(environment));
+		setup(*operation, arguments.data());
+		
+		// Return starting operation
+		return AsyncOperation::start(move(operation));
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Throw error
+		napi_throw_type_error(environment, nullptr, error.what() ? error.what() : "");
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Initialize context seed
+void initializeContextSeed() {
+
+	// Check if opening random device failed
+	contextSeed.resize(seedSize());
+	const int randomDevice = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+	if(randomDevice == -1) {
+	
+		// Throw error
+		throw runtime_error("Opening random device failed");
+	}
+	
+	// Go through all bytes in the context seed
+	for(size_t i = 0; i < contextSeed.size();) {
+	
+		// Check if reading from random device failed
+		const ssize_t bytesRead = read(randomDevice, &contextSeed[i], contextSeed.size() - i);
+		if(bytesRead <= 0) {
+		
+			// Check if read was interrupted
+			if(bytesRead == -1 && errno == EINTR) {
+			
+				// Continue
+				continue;
+			}
+			
+			// Close random device
+			close(randomDevice);
+			
+			// Throw error
+			throw runtime_error("Reading from random device failed");
+		}
+		
+		// Update index
+		i += bytesRead;
+	}
+	
+	// Close random device
+	close(randomDevice);
+	
+	// Initialize secp256k1-zkp with the context seed before operations run in parallel on the thread pool
+	const uint8_t secretKey[32] = {};
+	isValidSecretKey(contextSeed.data(), contextSeed.size(), secretKey, sizeof(secretKey));
+}
+
+// Initialize module
+napi_value initializeModule(napi_env environment, napi_value exports) {
+
+	// Try
+	try {
+	
+		// Initialize context seed once for all of the threads that load the module
+		call_once(contextSeedInitialized, initializeContextSeed);
+		
+		// Go through all bindings
+		const napi_property_descriptor bindings[] = {
+			{"isValidPublicKey", nullptr, isValidPublicKeyBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"isValidCommit", nullptr, isValidCommitBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"isValidSingleSignerSignature", nullptr, isValidSingleSignerSignatureBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"verifyBulletproof", nullptr, verifyBulletproofBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"pedersenCommit", nullptr, pedersenCommitBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"pedersenCommitSum", nullptr, pedersenCommitSumBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"pedersenCommitToPublicKey", nullptr, pedersenCommitToPublicKeyBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"addSingleSignerSignatures", nullptr, addSingleSignerSignaturesBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"verifySingleSignerSignature", nullptr, verifySingleSignerSignatureBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"combinePublicKeys", nullptr, combinePublicKeysBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"verifyMessageHashSignature", nullptr, verifyMessageHashSignatureBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"publicKeysFromSecretKeys", nullptr, publicKeysFromSecretKeysBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"pedersenCommits", nullptr, pedersenCommitsBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"executeCommands", nullptr, executeCommandsBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"validateBlock", nullptr, validateBlockBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"sha256Hashes", nullptr, sha256HashesBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"getStats", nullptr, getStatsBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr},
+			{"resetStats", nullptr, resetStatsBinding, nullptr, nullptr, nullptr, napi_enumerable, nullptr}
+		};
+		
+		// Check if adding bindings to the exports failed
+		if(napi_define_properties(environment, exports, sizeof(bindings) / sizeof(bindings[0]), bindings) != napi_ok) {
+		
+			// Throw error
+			throw runtime_error("Adding bindings failed");
+		}
+		
+		// Return exports
+		return exports;
+	}
+	
+	// Catch errors
+	catch(const exception &error) {
+	
+		// Throw error
+		napi_throw_error(environment, nullptr, error.what() ? error.what() : "");
+		
+		// Return nothing
+		return nullptr;
+	}
+}
+
+// Register module
+NAPI_MODULE(NODE_GYP_MODULE_NAME, initializeModule)
@@ -0,0 +1,53 @@
+// Is valid public key
+export function isValidPublicKey(publicKey: Buffer): Promise<boolean>;
+
+// Is valid commit
+export function isValidCommit(commit: Buffer): Promise<boolean>;
+
+// Is valid single-signer signature
+export function isValidSingleSignerSignature(signature: Buffer): Promise<boolean>;
+
+// Verify bulletproof
+export function verifyBulletproof(proof: Buffer, commit: Buffer, extraCommit: Buffer | null): Promise<boolean>;
+
+// Pedersen commit
+export function pedersenCommit(blind: Buffer, value: string): Promise<Buffer>;
+
+// Pedersen commit sum
+export function pedersenCommitSum(positiveCommits: Buffer[], negativeCommits: Buffer[]): Promise<Buffer>;
+
+// Pedersen commit to public key
+export function pedersenCommitToPublicKey(commit: Buffer): Promise<Buffer>;
+
+// Add single-signer signatures
+export function addSingleSignerSignatures(signatures: Buffer[], publicNonceTotal: Buffer): Promise<Buffer>;
+
+// Verify single-signer signature
+export function verifySingleSignerSignature(signature: Buffer, message: Buffer, publicNonce: Buffer | null, publicKey: Buffer, publicKeyTotal: Buffer, isPartial: boolean): Promise<boolean>;
+
+// Combine public keys
+export function combinePublicKeys(publicKeys: Buffer[]): Promise<Buffer>;
+
+// Verify message hash signature
+export function verifyMessageHashSignature(signature: Buffer, messageHash: Buffer, publicKey: Buffer): Promise<boolean>;
+
+// Public keys from secret keys
+export function publicKeysFromSecretKeys(secretKeys: Buffer[]): Promise<Buffer>;
+
+// Pedersen commits
+export function pedersenCommits(blinds: Buffer[], values: string[]): Promise<Buffer>;
+
+// Execute commands
+export function executeCommands(commands: Buffer): Promise<Buffer>;
+
+// Validate block
+export function validateBlock(inputs: Buffer[], outputs: Buffer[], proofs: Buffer[], kernelExcesses: Buffer[], signatures: Buffer[], messages: Buffer[], offset: Buffer, reward: string): Promise<{Result: number, Index: number}>;
+
+// SHA-256 hashes
+export function sha256Hashes(messages: Buffer[]): Promise<Buffer>;
+
+// Get stats
+export function getStats(): {[key: string]: any};
+
+// Reset stats
+export function resetStats(): void;
@@ -0,0 +1,22 @@
+// Use strict
+"use strict";
+
+
+// Requires
+
+// Secp256k1-zkp React Node-API addon
+const addon = require("./build/Release/secp256k1_zkp_react.node");
+
+
+// Exports
+
+// Export addon with stats parsed from JSON
+module.exports = Object.assign({}, addon, {
+
+	// Get stats
+	getStats() {
+	
+		// Return parsing addon's stats
+		return JSON.parse(addon.getStats());
+	}
+});
@@ -0,0 +1,82 @@
+#!/bin/sh
+# Downloads secp256k1-zkp and the NPM package at the commits pinned in dependencies.lock, patches them for the native core, and checks that every target builds against them and that batch operations give the same results as per-item operations
+set -e
+
+cd "$(dirname "$0")/.."
+LOCK_FILE="dependencies.lock"
+
+# Download dependency at its pinned commit
+download() {
+	NAME="$1"
+	REPOSITORY="$2"
+	COMMIT="$(grep "^$NAME " "$LOCK_FILE" 2> /dev/null | cut -d " " -f 2)"
+	rm -rf "./$NAME-master" "./$NAME.zip"
+
+	# Check if the dependency isn't pinned
+	if [ -z "$COMMIT" ]; then
+
+		# Download the dependency's master branch and pin it to the commit that GitHub stores in the archive's comment
+		wget -O "./$NAME.zip" "https://github.com/$REPOSITORY/archive/refs/heads/master.zip"
+		COMMIT="$(unzip -z "./$NAME.zip" | tail -n 1)"
+		echo "$NAME $COMMIT" >> "$LOCK_FILE"
+		echo "Pinned $NAME to $COMMIT in $LOCK_FILE, commit it so that every build uses the same library" >&2
+
+	# Otherwise
+	else
+
+		# Download the dependency at its pinned commit
+		wget -O "./$NAME.zip" "https://github.com/$REPOSITORY/archive/$COMMIT.zip"
+	fi
+
+	# Check that the archive is for the pinned commit
+	if [ "$(unzip -z "./$NAME.zip" | tail -n 1)" != "$COMMIT" ] || [ "$(printf "%s" "$COMMIT" | tr -d "0-9a-f" | wc -c)" -ne 0 ] || [ "${#COMMIT}" -ne 40 ]; then
+		echo "$NAME archive isn't for commit $COMMIT" >&2
+		exit 1
+	fi
+
+	# Extract the dependency into the directory that the builds include it from
+	unzip -q "./$NAME.zip"
+	rm "./$NAME.zip"
+	if [ -d "./$NAME-$COMMIT" ]; then
+		mv "./$NAME-$COMMIT" "./$NAME-master"
+	fi
+}
+
+# Download, build, and patch secp256k1-zkp
+download "secp256k1-zkp" "setavenger/secp256k1-zkp"
+(cd "./secp256k1-zkp-master" && "./autogen.sh" && "./configure" --enable-endomorphism --enable-ecmult-static-precomputation --enable-module-ecdh --enable-experimental --enable-module-generator --enable-module-commitment --enable-module-bulletproof --enable-module-aggsig --with-bignum=no --with-scalar=32bit --with-field=32bit --with-asm=no --disable-benchmark --disable-tests --disable-exhaustive-tests && make)
+find "./secp256k1-zkp-master/" -mindepth 1 -maxdepth 1 ! -name "src" ! -name "include" -exec rm -rf {} +
+rm -rf "./secp256k1-zkp-master/src/asm/" "./secp256k1-zkp-master/src/java/" "./secp256k1-zkp-master/src/.deps/" "./secp256k1-zkp-master/src/.libs/"
+sed -i 's/^static void secp256k1_sha256_transform(\(.*\)) {$/void secp256k1_sha256_transform(\1);\nvoid secp256k1_sha256_transform_portable(\1);\nvoid secp256k1_sha256_transform_portable(\1) {/' "./secp256k1-zkp-master/src/hash_impl.h"
+echo "#include \"../../cpp/secp256k1-zkp-batch.h\"" >> "./secp256k1-zkp-master/src/secp256k1.c"
+
+# Download and patch the NPM package
+download "Secp256k1-zkp-NPM-Package" "setavenger/Secp256k1-zkp-NPM-Package"
+sed -i 's/explicit_bzero(\(.*\),/memset(\1, 0,/g' "./Secp256k1-zkp-NPM-Package-master/main.cpp"
+find "./Secp256k1-zkp-NPM-Package-master/" -mindepth 1 ! -name "main.cpp" -exec rm -rf {} +
+
+# Build the benchmark and run it once since it checks that batch operations give the same results as per-item operations before it measures anything
+cmake -S benchmark -B benchmark/build -D CMAKE_BUILD_TYPE=Release > /dev/null
+cmake --build benchmark/build > /dev/null
+"./benchmark/build/Secp256k1ZkpReactBenchmark" 1 > /dev/null
+
+# Build the Node addon
+(cd node && npm install > /dev/null)
+
+# Build the Android library for arm64 devices if the Android NDK is available
+if [ -n "$ANDROID_NDK_HOME" ]; then
+	cmake -S android -B android/build -D CMAKE_TOOLCHAIN_FILE="$ANDROID_NDK_HOME/build/cmake/android.toolchain.cmake" -D ANDROID_ABI=arm64-v8a -D ANDROID_PLATFORM=android-21 -D CMAKE_BUILD_TYPE=Release > /dev/null
+	cmake --build android/build > /dev/null
+else
+	echo "Skipped building the Android library since ANDROID_NDK_HOME isn't set" >&2
+fi
+
+# Compile the native core and secp256k1-zkp for iOS devices if Xcode is available
+if command -v xcrun > /dev/null 2>&1; then
+	DEFINES="-DUSE_ENDOMORPHISM -DUSE_NUM_NONE -DUSE_FIELD_INV_BUILTIN -DUSE_SCALAR_INV_BUILTIN -DUSE_FIELD_10X26 -DUSE_SCALAR_8X32 -DUSE_ECMULT_STATIC_PRECOMPUTATION -DENABLE_MODULE_ECDH -DENABLE_MODULE_GENERATOR -DENABLE_MODULE_COMMITMENT -DENABLE_MODULE_BULLETPROOF -DENABLE_MODULE_AGGSIG -DENABLE_OPERATION_STATS"
+	INCLUDES="-Icpp -Isecp256k1-zkp-master -Isecp256k1-zkp-master/src -Isecp256k1-zkp-master/include"
+	xcrun --sdk iphoneos clang -arch arm64 -miphoneos-version-min=10.0 -O3 $DEFINES $INCLUDES -c "./secp256k1-zkp-master/src/secp256k1.c" -o /dev/null
+	xcrun --sdk iphoneos clang++ -arch arm64 -miphoneos-version-min=10.0 -std=c++11 -O3 $DEFINES $INCLUDES -c "./cpp/secp256k1-zkp-react.cpp" -o /dev/null
+else
+	echo "Skipped compiling for iOS since Xcode isn't available" >&2
+fi
@@ -20,6 +20,62 @@ export default class Secp256k1Zkp {
     static NO_PUBLIC_NONCE = null;
     // No public nonce total
     static NO_PUBLIC_NONCE_TOTAL = null;
+    // Scalar add
+    static SCALAR_ADD = 0;
+    // Scalar subtract
+    static SCALAR_SUBTRACT = 1;
+    // Scalar multiply
+    static SCALAR_MULTIPLY = 2;
+    // Scalar negate
+    static SCALAR_NEGATE = 3;
+    // Scalar inverse
+    static SCALAR_INVERSE = 4;
+    // Block valid
+    static BLOCK_VALID = 0;
+    // Block invalid input
+    static BLOCK_INVALID_INPUT = 1;
+    // Block invalid output
+    static BLOCK_INVALID_OUTPUT = 2;
+    // Block invalid kernel excess
+    static BLOCK_INVALID_KERNEL_EXCESS = 3;
+    // Block invalid proof
+    static BLOCK_INVALID_PROOF = 4;
+    // Block invalid signature
+    static BLOCK_INVALID_SIGNATURE = 5;
+    // Block unbalanced
+    static BLOCK_UNBALANCED = 6;
+    // Commit size
+    static COMMIT_SIZE = 33;
+    // Command operations in the same order as the native commands
+    static COMMAND_OPERATIONS = [
+        "isValidSecretKey",
+        "isValidPublicKey",
+        "isValidCommit",
+        "isValidSingleSignerSignature",
+        "publicKeyFromSecretKey",
+        "publicKeyFromData",
+        "uncompressPublicKey",
+        "secretKeyTweakAdd",
+        "publicKeyTweakAdd",
+        "secretKeyTweakMultiply",
+        "publicKeyTweakMultiply",
+        "sharedSecretKeyFromSecretKeyAndPublicKey",
+        "pedersenCommit",
+        "blindSwitch",
+        "pedersenCommitToPublicKey",
+        "publicKeyToPedersenCommit",
+        "singleSignerSignatureFromData",
+        "compactSingleSignerSignature",
+        "uncompactSingleSignerSignature",
+        "createMessageHashSignature",
+        "verifyMessageHashSignature"
+    ];
+    // Command argument data
+    static COMMAND_ARGUMENT_DATA = 0;
+    // Command argument reference
+    static COMMAND_ARGUMENT_REFERENCE = 1;
+    // Command argument header size
+    static COMMAND_ARGUMENT_HEADER_SIZE = 5;
     // Blind switch
     static async blindSwitch(blind, value) {
         // Try
@@ -463,4 +519,690 @@ export default class Secp256k1Zkp {
             return Secp256k1Zkp.OPERATION_FAILED;
         }
     }
+    // Create bulletproof session
+    static async createBulletproofSession(blind, value, commit, nonce, privateNonce, extraCommit, message) {
+        // Try
+        try {
+            // Return creating bulletproof session with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.createBulletproofSession((blind !== null) ? blind.toString("hex") : null, value, commit.toString("hex"), nonce.toString("hex"), (privateNonce !== null) ? privateNonce.toString("hex") : null, extraCommit.toString("hex"), message.toString("hex"));
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Bulletproof session round one
+    static async bulletproofSessionRoundOne(session) {
+        // Try
+        try {
+            // Performing round one with the bulletproof session with secp256k1-zkp React module
+            const { TOne, TTwo } = await NativeModules.Secp256k1ZkpReact.bulletproofSessionRoundOne(session);
+            // Return round one data
+            return {
+                // T one
+                TOne: Buffer.from(TOne, "hex"),
+                // T two
+                TTwo: Buffer.from(TTwo, "hex")
+            };
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Bulletproof session round two
+    static async bulletproofSessionRoundTwo(session, tOne, tTwo) {
+        // Try
+        try {
+            // Return performing round two with the bulletproof session with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.bulletproofSessionRoundTwo(session, tOne.toString("hex"), tTwo.toString("hex")), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Bulletproof session finalize
+    static async bulletproofSessionFinalize(session, tauX) {
+        // Try
+        try {
+            // Return finalizing the bulletproof session with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.bulletproofSessionFinalize(session, tauX.toString("hex")), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Destroy bulletproof session
+    static async destroyBulletproofSession(session) {
+        // Try
+        try {
+            // Return destroying bulletproof session with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.destroyBulletproofSession(session);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Create aggsig session
+    static async createAggsigSession(message, publicKeyTotal, publicNonceTotal) {
+        // Try
+        try {
+            // Return creating aggsig session with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.createAggsigSession(message.toString("hex"), publicKeyTotal.toString("hex"), publicNonceTotal.toString("hex"));
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Aggsig session partial sign
+    static async aggsigSessionPartialSign(session, secretKey, secretNonce) {
+        // Try
+        try {
+            // Return creating partial signature with the aggsig session with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.aggsigSessionPartialSign(session, secretKey.toString("hex"), secretNonce.toString("hex")), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Aggsig session partial verify
+    static async aggsigSessionPartialVerify(session, signature, publicKey) {
+        // Try
+        try {
+            // Return if partial signature is verified with the aggsig session with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.aggsigSessionPartialVerify(session, signature.toString("hex"), publicKey.toString("hex"));
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Aggsig session aggregate
+    static async aggsigSessionAggregate(session, signatures) {
+        // Try
+        try {
+            // Return aggregating signatures with the aggsig session with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.aggsigSessionAggregate(session, signatures.map((signature) => {
+                // Return signature as a hex string
+                return signature.toString("hex");
+            })), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Aggsig session verify
+    static async aggsigSessionVerify(session, signature) {
+        // Try
+        try {
+            // Return if signature is verified with the aggsig session with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.aggsigSessionVerify(session, signature.toString("hex"));
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Destroy aggsig session
+    static async destroyAggsigSession(session) {
+        // Try
+        try {
+            // Return destroying aggsig session with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.destroyAggsigSession(session);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Create nonce pair
+    static async createNoncePair() {
+        // Try
+        try {
+            // Getting nonce pair with secp256k1-zkp React module
+            const { SecretNonce, PublicNonce } = await NativeModules.Secp256k1ZkpReact.createNoncePair();
+            // Return nonce pair
+            return {
+                // Secret nonce
+                SecretNonce: Buffer.from(SecretNonce, "hex"),
+                // Public nonce
+                PublicNonce: Buffer.from(PublicNonce, "hex")
+            };
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Derive child secret keys
+    static async deriveChildSecretKeys(secretKey, chainCode, startIndex, numberOfIndices, isHardened) {
+        // Try
+        try {
+            // Return deriving child secret keys with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.deriveChildSecretKeys(secretKey.toString("hex"), chainCode.toString("hex"), startIndex, numberOfIndices, isHardened), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Derive child public keys
+    static async deriveChildPublicKeys(publicKey, chainCode, startIndex, numberOfIndices) {
+        // Try
+        try {
+            // Return deriving child public keys with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.deriveChildPublicKeys(publicKey.toString("hex"), chainCode.toString("hex"), startIndex, numberOfIndices), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Public keys from secret keys
+    static async publicKeysFromSecretKeys(secretKeys) {
+        // Try
+        try {
+            // Return getting public keys from secret keys with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.publicKeysFromSecretKeys(secretKeys.map((secretKey) => {
+                // Return secret key as a hex string
+                return secretKey.toString("hex");
+            })), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Pedersen commits
+    static async pedersenCommits(blinds, values) {
+        // Try
+        try {
+            // Return performing Pedersen commits with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.pedersenCommits(blinds.map((blind) => {
+                // Return blind as a hex string
+                return blind.toString("hex");
+            }), values), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Blind switches
+    static async blindSwitches(blinds, values) {
+        // Try
+        try {
+            // Return performing blind switches with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.blindSwitches(blinds.map((blind) => {
+                // Return blind as a hex string
+                return blind.toString("hex");
+            }), values), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Shared secret keys from secret key and public keys
+    static async sharedSecretKeysFromSecretKeyAndPublicKeys(secretKey, publicKeys) {
+        // Try
+        try {
+            // Return getting shared secret keys from secret key and public keys with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.sharedSecretKeysFromSecretKeyAndPublicKeys(secretKey.toString("hex"), publicKeys.map((publicKey) => {
+                // Return public key as a hex string
+                return publicKey.toString("hex");
+            })), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Create commit accumulator
+    static async createCommitAccumulator() {
+        // Try
+        try {
+            // Return creating commit accumulator with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.createCommitAccumulator();
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Commit accumulator add
+    static async commitAccumulatorAdd(accumulator, commits) {
+        // Try
+        try {
+            // Return adding commits to the commit accumulator with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.commitAccumulatorAdd(accumulator, commits.map((commit) => {
+                // Return commit as a hex string
+                return commit.toString("hex");
+            }));
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Commit accumulator subtract
+    static async commitAccumulatorSubtract(accumulator, commits) {
+        // Try
+        try {
+            // Return subtracting commits from the commit accumulator with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.commitAccumulatorSubtract(accumulator, commits.map((commit) => {
+                // Return commit as a hex string
+                return commit.toString("hex");
+            }));
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Commit accumulator checkpoint
+    static async commitAccumulatorCheckpoint(accumulator) {
+        // Try
+        try {
+            // Return creating commit accumulator checkpoint with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.commitAccumulatorCheckpoint(accumulator);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Commit accumulator restore
+    static async commitAccumulatorRestore(accumulator, checkpoint) {
+        // Try
+        try {
+            // Return restoring commit accumulator with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.commitAccumulatorRestore(accumulator, checkpoint);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Commit accumulator total
+    static async commitAccumulatorTotal(accumulator) {
+        // Try
+        try {
+            // Return getting commit accumulator total with secp256k1-zkp React module which is an empty buffer if the total is zero
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.commitAccumulatorTotal(accumulator), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Destroy commit accumulator
+    static async destroyCommitAccumulator(accumulator) {
+        // Try
+        try {
+            // Return destroying commit accumulator with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.destroyCommitAccumulator(accumulator);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Multi scalar multiply
+    static async multiScalarMultiply(points, scalars) {
+        // Try
+        try {
+            // Return performing multi scalar multiply in variable time with secp256k1-zkp React module which is an empty buffer if the result is infinity
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.multiScalarMultiply(points.map((point) => {
+                // Return point as a hex string
+                return point.toString("hex");
+            }), scalars.map((scalar) => {
+                // Return scalar as a hex string
+                return scalar.toString("hex");
+            })), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Scalar batch inverse
+    static async scalarBatchInverse(scalars) {
+        // Try
+        try {
+            // Return performing scalar batch inverse with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.scalarBatchInverse(scalars.map((scalar) => {
+                // Return scalar as a hex string
+                return scalar.toString("hex");
+            })), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Evaluate scalar program
+    static async evaluateScalarProgram(scalars, program) {
+        // Try
+        try {
+            // Return evaluating scalar program with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.evaluateScalarProgram(scalars.map((scalar) => {
+                // Return scalar as a hex string
+                return scalar.toString("hex");
+            }), program.toString("hex")), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Execute commands
+    static async executeCommands(commands) {
+        // Try
+        try {
+            // Go through all commands
+            const encodedCommands = [];
+            for (const command of commands) {
+                // Check if command's operation is invalid
+                const operation = Secp256k1Zkp.COMMAND_OPERATIONS.indexOf(command.operation);
+                if (operation === -1) {
+                    // Throw error
+                    throw new Error("Command operation is invalid");
+                }
+                // Append command's operation and number of arguments to the encoded commands
+                encodedCommands.push(Buffer.from([operation, command.arguments.length]));
+                // Go through all of the command's arguments
+                for (const argument of command.arguments) {
+                    // Check if argument is a reference to a previous command's result
+                    const header = Buffer.alloc(Secp256k1Zkp.COMMAND_ARGUMENT_HEADER_SIZE);
+                    if (typeof argument === "number") {
+                        // Append reference to the encoded commands
+                        header.writeUInt8(Secp256k1Zkp.COMMAND_ARGUMENT_REFERENCE, 0);
+                        header.writeUInt32BE(argument, 1);
+                        encodedCommands.push(header);
+                    }
+                    // Otherwise
+                    else {
+                        // Append data to the encoded commands
+                        const data = (typeof argument === "string") ? Buffer.from(argument, "utf8") : argument;
+                        header.writeUInt8(Secp256k1Zkp.COMMAND_ARGUMENT_DATA, 0);
+                        header.writeUInt32BE(data.length, 1);
+                        encodedCommands.push(header, data);
+                    }
+                }
+            }
+            // Execute commands with secp256k1-zkp React module
+            const results = Buffer.from(await NativeModules.Secp256k1ZkpReact.executeCommands(Buffer.concat(encodedCommands).toString("hex")), "hex");
+            // Go through all results
+            const decodedResults = [];
+            for (let offset = 0; offset < results.length;) {
+                // Get result's status and size
+                const succeeded = results.readUInt8(offset) !== 0;
+                const size = results.readUInt32BE(offset + 1);
+                offset += Secp256k1Zkp.COMMAND_ARGUMENT_HEADER_SIZE;
+                // Append result's data or operation failed if the command failed
+                decodedResults.push(succeeded ? results.subarray(offset, offset + size) : Secp256k1Zkp.OPERATION_FAILED);
+                offset += size;
+            }
+            // Return decoded results
+            return decodedResults;
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Set verification cache capacity
+    static async setVerificationCacheCapacity(capacity) {
+        // Try
+        try {
+            // Return setting verification cache capacity with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.setVerificationCacheCapacity(capacity);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Get verification cache statistics
+    static async getVerificationCacheStatistics() {
+        // Try
+        try {
+            // Return getting verification cache statistics with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.getVerificationCacheStatistics();
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Set thread count
+    static async setThreadCount(count) {
+        // Try
+        try {
+            // Return setting thread count with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.setThreadCount(count);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Open rewind cache
+    static async openRewindCache(path, key) {
+        // Try
+        try {
+            // Return opening rewind cache with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.openRewindCache(path, key.toString("hex"));
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Rewind bulletproof with cache
+    static async rewindBulletproofWithCache(cache, proof, commit, nonce) {
+        // Try
+        try {
+            // Rewinding bulletproof with cache with secp256k1-zkp React module
+            const { Value, Blind, Message } = await NativeModules.Secp256k1ZkpReact.rewindBulletproofWithCache(cache, proof.toString("hex"), commit.toString("hex"), nonce.toString("hex"));
+            // Return bulletproof data
+            return {
+                // Value
+                Value,
+                // Blind
+                Blind: Buffer.from(Blind, "hex"),
+                // Message
+                Message: Buffer.from(Message, "hex")
+            };
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Close rewind cache
+    static async closeRewindCache(cache) {
+        // Try
+        try {
+            // Return closing rewind cache with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.closeRewindCache(cache);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Scan outputs
+    static async scanOutputs(inputPath, startOffset, outputPath, nonce) {
+        // Try
+        try {
+            // Return scanning outputs with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.scanOutputs(inputPath, startOffset, outputPath, nonce.toString("hex"));
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Aggregate transactions
+    static async aggregateTransactions(inputs, outputs, kernelExcesses, offsets, fees) {
+        // Try
+        try {
+            // Aggregating transactions with secp256k1-zkp React module
+            const { Inputs, Outputs, Offset } = await NativeModules.Secp256k1ZkpReact.aggregateTransactions(inputs.map((input) => {
+                // Return input as a hex string
+                return input.toString("hex");
+            }), outputs.map((output) => {
+                // Return output as a hex string
+                return output.toString("hex");
+            }), kernelExcesses.map((kernelExcess) => {
+                // Return kernel excess as a hex string
+                return kernelExcess.toString("hex");
+            }), offsets.map((offset) => {
+                // Return offset as a hex string
+                return offset.toString("hex");
+            }), fees);
+            // Initialize split commits
+            const splitCommits = (commits) => {
+                // Go through all commits
+                const result = [];
+                for (let i = 0; i < commits.length; i += Secp256k1Zkp.COMMIT_SIZE) {
+                    // Append commit to the result
+                    result.push(commits.subarray(i, i + Secp256k1Zkp.COMMIT_SIZE));
+                }
+                // Return result
+                return result;
+            };
+            // Return aggregate data
+            return {
+                // Inputs
+                Inputs: splitCommits(Buffer.from(Inputs, "hex")),
+                // Outputs
+                Outputs: splitCommits(Buffer.from(Outputs, "hex")),
+                // Offset
+                Offset: Buffer.from(Offset, "hex")
+            };
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Validate block
+    static async validateBlock(inputs, outputs, proofs, kernelExcesses, signatures, messages, offset, reward) {
+        // Try
+        try {
+            // Return validating block with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.validateBlock(inputs.map((input) => {
+                // Return input as a hex string
+                return input.toString("hex");
+            }), outputs.map((output) => {
+                // Return output as a hex string
+                return output.toString("hex");
+            }), proofs.map((proof) => {
+                // Return proof as a hex string
+                return proof.toString("hex");
+            }), kernelExcesses.map((kernelExcess) => {
+                // Return kernel excess as a hex string
+                return kernelExcess.toString("hex");
+            }), signatures.map((signature) => {
+                // Return signature as a hex string
+                return signature.toString("hex");
+            }), messages.map((message) => {
+                // Return message as a hex string
+                return message.toString("hex");
+            }), offset.toString("hex"), reward);
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Get stats
+    static async getStats() {
+        // Try
+        try {
+            // Return parsing stats from secp256k1-zkp React module
+            return JSON.parse(await NativeModules.Secp256k1ZkpReact.getStats());
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // Reset stats
+    static async resetStats() {
+        // Try
+        try {
+            // Return resetting stats with secp256k1-zkp React module
+            return await NativeModules.Secp256k1ZkpReact.resetStats();
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
+    // SHA-256 hashes
+    static async sha256Hashes(messages) {
+        // Try
+        try {
+            // Return getting SHA-256 hashes of the messages with secp256k1-zkp React module
+            return Buffer.from(await NativeModules.Secp256k1ZkpReact.sha256Hashes(messages.map((message) => {
+                // Return message as a hex string
+                return message.toString("hex");
+            })), "hex");
+        }
+        // Catch errors
+        catch (error) {
+            // Return operation failed
+            return Secp256k1Zkp.OPERATION_FAILED;
+        }
+    }
 }